@@ -18,7 +18,9 @@
 
 #include <array>
 #include <cstddef>
+#include <iterator>
 #include <map>
+#include <type_traits>
 
 #include <boost/concept_check.hpp>
 #include <boost/core/ignore_unused.hpp>
@@ -477,6 +479,28 @@ struct section_visitor
 
 };
 
+// Computes the turns of overlapping sections with many threads. Returns false if the turns
+// have to be computed sequentially. Specialized for strategies::parallel_turns in
+// get_turns_parallel.hpp so the threads are used only if that strategy is included.
+template <typename Strategy, typename Enable = void>
+struct get_turns_parallel
+{
+    template
+    <
+        typename Geometry1, typename Geometry2,
+        bool Reverse1, bool Reverse2,
+        typename TurnPolicy,
+        typename Box, typename Sections, typename Turns
+    >
+    static inline bool apply(int , Geometry1 const& , Sections const& ,
+                             int , Geometry2 const& , Sections const& ,
+                             Strategy const& ,
+                             Turns& )
+    {
+        return false;
+    }
+};
+
 template
 <
     typename Geometry1, typename Geometry2,
@@ -485,7 +509,6 @@ template
 >
 class get_turns_generic
 {
-
 public:
     template <typename Strategy, typename Turns, typename InterruptPolicy>
     static inline void apply(
@@ -510,6 +533,18 @@ public:
         geometry::sectionalize<Reverse2, dimensions>(geometry2,
                                                      sec2, strategy, 1);
 
+        // The interrupted computation stops at the first turn found sequentially
+        if (! InterruptPolicy::enabled
+            && get_turns_parallel<Strategy>::template apply
+                <
+                    Geometry1, Geometry2, Reverse1, Reverse2, TurnPolicy, box_type
+                >(source_id1, geometry1, sec1,
+                  source_id2, geometry2, sec2,
+                  strategy, turns))
+        {
+            return;
+        }
+
         // ... and then partition them, intersecting overlapping sections in visitor method
         section_visitor
             <
@@ -0,0 +1,171 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_GET_TURNS_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_GET_TURNS_PARALLEL_HPP
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/strategies/parallel_turns.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace get_turns
+{
+
+
+// Gathers the pairs of overlapping sections in the order in which they are visited
+template <typename Section, typename Strategy>
+struct section_pairs_visitor
+{
+    using pair_type = std::pair<Section const*, Section const*>;
+
+    std::vector<pair_type> m_pairs;
+    Strategy const& m_strategy;
+
+    explicit section_pairs_visitor(Strategy const& strategy)
+        : m_strategy(strategy)
+    {}
+
+    inline bool apply(Section const& sec1, Section const& sec2)
+    {
+        if (! detail::disjoint::disjoint_box_box(sec1.bounding_box,
+                                                 sec2.bounding_box,
+                                                 m_strategy) )
+        {
+            m_pairs.emplace_back(&sec1, &sec2);
+        }
+        return true;
+    }
+};
+
+template <typename Strategy>
+struct get_turns_parallel
+    <
+        Strategy,
+        std::enable_if_t<strategies::detail::is_parallel_turns<Strategy>::value>
+    >
+{
+    // The pairs of sections are divided into more chunks than threads to balance the work
+    static const std::size_t chunks_per_thread = 8;
+
+    template
+    <
+        typename Geometry1, typename Geometry2,
+        bool Reverse1, bool Reverse2,
+        typename TurnPolicy,
+        typename Box, typename Sections, typename Turns
+    >
+    static inline bool apply(int source_id1, Geometry1 const& geometry1, Sections const& sec1,
+                             int source_id2, Geometry2 const& geometry2, Sections const& sec2,
+                             Strategy const& strategy,
+                             Turns& turns)
+    {
+        std::size_t const threads = strategy.threads();
+        if (threads <= 1)
+        {
+            return false;
+        }
+
+        using section_type = typename boost::range_value<Sections>::type;
+
+        // First gather the pairs of overlapping sections...
+        section_pairs_visitor<section_type, Strategy> visitor(strategy);
+        geometry::partition
+            <
+                Box
+            >::apply(sec1, sec2, visitor,
+                     detail::section::get_section_box<Strategy>(strategy),
+                     detail::section::overlaps_section_box<Strategy>(strategy));
+
+        auto const& pairs = visitor.m_pairs;
+        std::size_t const chunks_count = (std::min)(pairs.size(), threads * chunks_per_thread);
+        if (chunks_count == 0)
+        {
+            return true;
+        }
+
+        // ... then intersect them in chunks taken by the threads one by one,
+        // storing the turns of each chunk separately...
+        std::vector<Turns> chunks_turns(chunks_count);
+        std::atomic<std::size_t> next_chunk(0);
+        auto worker = [&]()
+        {
+            no_interrupt_policy interrupt_policy;
+            for (std::size_t c = next_chunk++ ; c < chunks_count ; c = next_chunk++)
+            {
+                std::size_t const first = pairs.size() * c / chunks_count;
+                std::size_t const last = pairs.size() * (c + 1) / chunks_count;
+                for (std::size_t i = first ; i < last ; ++i)
+                {
+                    get_turns_in_sections
+                        <
+                            Geometry1,
+                            Geometry2,
+                            Reverse1, Reverse2,
+                            section_type, section_type,
+                            TurnPolicy
+                        >::apply(source_id1, geometry1, *pairs[i].first,
+                                 source_id2, geometry2, *pairs[i].second,
+                                 false, false,
+                                 strategy,
+                                 chunks_turns[c], interrupt_policy);
+                }
+            }
+        };
+
+        std::vector<std::future<void> > futures;
+        std::size_t const threads_count = (std::min)(threads, chunks_count);
+        for (std::size_t t = 1 ; t < threads_count ; ++t)
+        {
+            futures.push_back(std::async(std::launch::async, worker));                      // MAY THROW (thread creation)
+        }
+        worker();
+        for (auto& f : futures)
+        {
+            f.get();                                                                        // MAY THROW (exception thrown in the other thread)
+        }
+
+        // ... and finally append the turns in the order of chunks, i.e. the same order
+        // in which they are found sequentially
+        for (auto& chunk_turns : chunks_turns)
+        {
+            std::move(boost::begin(chunk_turns), boost::end(chunk_turns),
+                      std::back_inserter(turns));
+        }
+
+        return true;
+    }
+};
+
+
+}} // namespace detail::get_turns
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_GET_TURNS_PARALLEL_HPP
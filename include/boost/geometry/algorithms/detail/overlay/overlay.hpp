@@ -19,6 +19,7 @@
 
 #include <deque>
 #include <map>
+#include <type_traits>
 
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
@@ -33,6 +34,7 @@
 #include <boost/geometry/algorithms/detail/overlay/handle_colocations.hpp>
 #include <boost/geometry/algorithms/detail/overlay/is_self_turn.hpp>
 #include <boost/geometry/algorithms/detail/overlay/needs_self_turns.hpp>
+#include <boost/geometry/algorithms/detail/overlay/overlay_phase.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay_type.hpp>
 #include <boost/geometry/algorithms/detail/overlay/traverse.hpp>
 #include <boost/geometry/algorithms/detail/overlay/traversal_info.hpp>
@@ -48,7 +50,10 @@
 #include <boost/geometry/algorithms/detail/overlay/select_rings.hpp>
 #include <boost/geometry/algorithms/detail/overlay/do_reverse.hpp>
 
+#include <boost/geometry/strategies/observed_overlay.hpp>
+
 #include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/type_traits.hpp>
 
 
 namespace boost { namespace geometry
@@ -80,6 +85,33 @@ struct overlay_null_visitor
     template <typename Rings>
     void visit_generated_rings(Rings const& )
     {}
+
+    void visit_phase_start(overlay_phase )
+    {}
+
+    void visit_phase_end(overlay_phase , overlay_counts const& )
+    {}
+};
+
+//! Visitor for overlay, passing the phases to the observer of the strategy
+template <typename Observer>
+struct overlay_observer_visitor : overlay_null_visitor
+{
+    explicit overlay_observer_visitor(Observer& observer)
+        : m_observer(observer)
+    {}
+
+    void visit_phase_start(overlay_phase phase)
+    {
+        m_observer.phase_start(phase);
+    }
+
+    void visit_phase_end(overlay_phase phase, overlay_counts const& counts)
+    {
+        m_observer.phase_end(phase, counts);
+    }
+
+    Observer& m_observer;
 };
 
 template
@@ -255,6 +287,9 @@ struct overlay
             >;
 
         turn_container_type turns;
+        overlay_counts counts;
+
+        visitor.visit_phase_start(overlay_phase::get_turns);
 
         detail::get_turns::no_interrupt_policy policy;
         geometry::get_turns
@@ -283,11 +318,18 @@ struct overlay
         }
 #endif
 
+        counts.turns = turns.size();
+        visitor.visit_phase_end(overlay_phase::get_turns, counts);
+
         cluster_type clusters;
 
         // Handle colocations, gathering clusters and (below) their properties.
+        visitor.visit_phase_start(overlay_phase::handle_colocations);
         detail::overlay::handle_colocations(turns, clusters);
+        counts.clusters = clusters.size();
+        visitor.visit_phase_end(overlay_phase::handle_colocations, counts);
 
+        visitor.visit_phase_start(overlay_phase::enrich_turns);
 
         detail::overlay::enrich_discard_turns<OverlayType>(
             turns, clusters, geometry1, geometry2, strategy);
@@ -314,6 +356,9 @@ struct overlay
 
         get_properties_ahead<Reverse1, Reverse2>(turns, clusters, geometry1, geometry2, strategy);
 
+        visitor.visit_phase_end(overlay_phase::enrich_turns, counts);
+        visitor.visit_phase_start(overlay_phase::traverse);
+
         // Traverse through intersection/turn points and create rings of them.
         // These rings are always in clockwise order.
         // In CCW polygons they are marked as "to be reversed" below.
@@ -334,6 +379,10 @@ struct overlay
 
         get_ring_turn_info<OverlayType>(turn_info_per_ring, turns, clusters);
 
+        counts.traversed_rings = rings.size();
+        visitor.visit_phase_end(overlay_phase::traverse, counts);
+        visitor.visit_phase_start(overlay_phase::select_rings);
+
         using properties = ring_properties
             <
                 point_type,
@@ -358,9 +407,16 @@ struct overlay
             }
         }
 
+        counts.selected_rings = selected_ring_properties.size();
+        visitor.visit_phase_end(overlay_phase::select_rings, counts);
+        visitor.visit_phase_start(overlay_phase::assign_parents);
+
         assign_parents<OverlayType>(geometry1, geometry2,
             rings, selected_ring_properties, strategy);
 
+        visitor.visit_phase_end(overlay_phase::assign_parents, counts);
+        visitor.visit_phase_start(overlay_phase::add_rings);
+
         // NOTE: There is no need to check result area for union because
         // as long as the polygons in the input are valid the resulting
         // polygons should be valid as well.
@@ -368,20 +424,24 @@ struct overlay
         // can be changed with #define. This may be important in non-cartesian CSes.
         // The result may be too big, so the area is negative. In this case either
         // it can be returned or an exception can be thrown.
-        return add_rings<GeometryOut>(selected_ring_properties, geometry1, geometry2, rings, out,
-                                      strategy,
+        out = add_rings<GeometryOut>(selected_ring_properties, geometry1, geometry2, rings, out,
+                                     strategy,
 #if defined(BOOST_GEOMETRY_UNION_THROW_INVALID_OUTPUT_EXCEPTION)
-                                      OverlayType == overlay_union ?
-                                      add_rings_throw_if_reversed
-                                      : add_rings_ignore_unordered
+                                     OverlayType == overlay_union ?
+                                     add_rings_throw_if_reversed
+                                     : add_rings_ignore_unordered
 #elif defined(BOOST_GEOMETRY_UNION_RETURN_INVALID)
-                                      OverlayType == overlay_union ?
-                                      add_rings_add_unordered
-                                      : add_rings_ignore_unordered
+                                     OverlayType == overlay_union ?
+                                     add_rings_add_unordered
+                                     : add_rings_ignore_unordered
 #else
-                                      add_rings_ignore_unordered
+                                     add_rings_ignore_unordered
 #endif
-                                      );
+                                     );
+
+        visitor.visit_phase_end(overlay_phase::add_rings, counts);
+
+        return out;
     }
 
     template <typename OutputIterator, typename Strategy>
@@ -389,10 +449,40 @@ struct overlay
                 Geometry1 const& geometry1, Geometry2 const& geometry2,
                 OutputIterator out,
                 Strategy const& strategy)
+    {
+        return apply_observed(geometry1, geometry2, out, strategy,
+            std::integral_constant
+                <
+                    bool,
+                    strategies::detail::is_observed_overlay<Strategy>::value
+                >());
+    }
+
+private:
+    template <typename OutputIterator, typename Strategy>
+    static inline OutputIterator apply_observed(
+                Geometry1 const& geometry1, Geometry2 const& geometry2,
+                OutputIterator out,
+                Strategy const& strategy,
+                std::false_type)
     {
         overlay_null_visitor visitor;
         return apply(geometry1, geometry2, out, strategy, visitor);
     }
+
+    template <typename OutputIterator, typename Strategy>
+    static inline OutputIterator apply_observed(
+                Geometry1 const& geometry1, Geometry2 const& geometry2,
+                OutputIterator out,
+                Strategy const& strategy,
+                std::true_type)
+    {
+        overlay_observer_visitor
+            <
+                util::remove_cref_t<decltype(strategy.observer())>
+            > visitor(strategy.observer());
+        return apply(geometry1, geometry2, out, strategy, visitor);
+    }
 };
 
 
@@ -0,0 +1,63 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_PHASE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_PHASE_HPP
+
+
+#include <cstddef>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Phases of overlay operations (intersection, union, difference) of areal geometries,
+    in the order of execution.
+*/
+enum class overlay_phase
+{
+    get_turns,          // intersections of the geometries and self intersections
+    handle_colocations, // gathering turns at the same location into clusters
+    enrich_turns,       // discarding, sorting and preparing the turns for traversal
+    traverse,           // creating rings from the turns
+    select_rings,       // selecting the input rings without turns
+    assign_parents,     // assigning holes to exterior rings
+    add_rings           // creating output polygons
+};
+
+static const std::size_t overlay_phase_count = 7;
+
+
+/*!
+\brief Sizes of the data analysed by an overlay operation.
+\details The sizes are reported after each phase. The sizes calculated by later phases are 0.
+*/
+struct overlay_counts
+{
+    std::size_t turns = 0;
+    std::size_t clusters = 0;
+    std::size_t traversed_rings = 0;
+    std::size_t selected_rings = 0;
+
+    overlay_counts& operator+=(overlay_counts const& other)
+    {
+        turns += other.turns;
+        clusters += other.clusters;
+        traversed_rings += other.traversed_rings;
+        selected_rings += other.selected_rings;
+        return *this;
+    }
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_PHASE_HPP
@@ -0,0 +1,217 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_EDGE_GRID_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_EDGE_GRID_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/algorithms/detail/expand_by_epsilon.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+
+// Vertical slabs of equal width. Every slab stores the segments overlapping it in x sorted by
+// their lowest y coordinate, so the segments below a point are at the beginning of its slab.
+// The segments are expanded by epsilon, i.e. segments closer than epsilon to the slab are also
+// stored in it, in order to find the same segments the winding strategy takes into account.
+// Value is a pair of a segment and an additional data.
+template <typename Value>
+class edge_grid
+{
+    using segment_type = typename Value::first_type;
+    using point_type = point_type_t<segment_type>;
+    using coordinate_type = coordinate_type_t<segment_type>;
+    using calculation_type = typename select_most_precise<coordinate_type, double>::type;
+
+    struct entry
+    {
+        coordinate_type min_y;
+        Value value;
+    };
+
+    // The number of stored segments is limited to this number times the number of segments
+    static const std::size_t max_entries_factor = 4;
+
+public:
+    edge_grid()
+        : m_min_x(0)
+        , m_scale(0)
+    {}
+
+    template <typename Values>
+    explicit edge_grid(Values const& values)
+        : m_min_x(0)
+        , m_scale(0)
+    {
+        std::size_t const count = values.size();
+        if (count == 0)
+        {
+            return;
+        }
+
+        std::vector<model::box<point_type>> boxes;
+        boxes.reserve(count);
+        for (Value const& v : values)
+        {
+            model::box<point_type> box;
+            geometry::set<min_corner, 0>(box, (std::min)(geometry::get<0, 0>(v.first), geometry::get<1, 0>(v.first)));
+            geometry::set<min_corner, 1>(box, (std::min)(geometry::get<0, 1>(v.first), geometry::get<1, 1>(v.first)));
+            geometry::set<max_corner, 0>(box, (std::max)(geometry::get<0, 0>(v.first), geometry::get<1, 0>(v.first)));
+            geometry::set<max_corner, 1>(box, (std::max)(geometry::get<0, 1>(v.first), geometry::get<1, 1>(v.first)));
+            detail::expand_by_epsilon(box);
+            boxes.push_back(box);
+        }
+
+        coordinate_type min_x = geometry::get<min_corner, 0>(boxes.front());
+        coordinate_type max_x = geometry::get<max_corner, 0>(boxes.front());
+        for (auto const& box : boxes)
+        {
+            min_x = (std::min)(min_x, geometry::get<min_corner, 0>(box));
+            max_x = (std::max)(max_x, geometry::get<max_corner, 0>(box));
+        }
+
+        m_min_x = min_x;
+
+        // Start with a slab per segment and use less slabs if long segments would be
+        // stored too many times
+        std::size_t slabs = count;
+        for (;;)
+        {
+            set_slabs(slabs, min_x, max_x);
+            if (slabs == 1)
+            {
+                break;
+            }
+
+            std::size_t entries = 0;
+            for (auto const& box : boxes)
+            {
+                entries += slab(geometry::get<max_corner, 0>(box)) - slab(geometry::get<min_corner, 0>(box)) + 1;
+            }
+            if (entries <= max_entries_factor * count)
+            {
+                break;
+            }
+            slabs /= 2;
+        }
+
+        // Counting sort of the segments by slabs
+        m_offsets.assign(m_slabs_count + 1, 0);
+        for (auto const& box : boxes)
+        {
+            std::size_t const last = slab(geometry::get<max_corner, 0>(box));
+            for (std::size_t s = slab(geometry::get<min_corner, 0>(box)); s <= last; ++s)
+            {
+                ++m_offsets[s + 1];
+            }
+        }
+        for (std::size_t s = 0; s < m_slabs_count; ++s)
+        {
+            m_offsets[s + 1] += m_offsets[s];
+        }
+
+        std::vector<std::size_t> positions(m_offsets.begin(), m_offsets.end() - 1);
+        m_entries.resize(m_offsets.back());
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::size_t const last = slab(geometry::get<max_corner, 0>(boxes[i]));
+            for (std::size_t s = slab(geometry::get<min_corner, 0>(boxes[i])); s <= last; ++s)
+            {
+                m_entries[positions[s]++] = entry{geometry::get<min_corner, 1>(boxes[i]), values[i]};
+            }
+        }
+
+        for (std::size_t s = 0; s < m_slabs_count; ++s)
+        {
+            std::sort(m_entries.begin() + m_offsets[s], m_entries.begin() + m_offsets[s + 1],
+                      [](entry const& l, entry const& r) { return l.min_y < r.min_y; });
+        }
+    }
+
+    // Calls the function for the values of the segments which may be crossed by a vertical ray
+    // going down from the point, and for some other ones
+    template <typename Point, typename Function>
+    void for_each_below(Point const& point, Function&& function) const
+    {
+        if (m_entries.empty())
+        {
+            return;
+        }
+
+        std::size_t const s = slab(geometry::get<0>(point));
+        auto const end = m_entries.begin() + m_offsets[s + 1];
+        for (auto it = m_entries.begin() + m_offsets[s]; it != end && ! (geometry::get<1>(point) < it->min_y); ++it)
+        {
+            function(it->value);
+        }
+    }
+
+    void swap(edge_grid & other)
+    {
+        std::swap(m_min_x, other.m_min_x);
+        std::swap(m_scale, other.m_scale);
+        std::swap(m_slabs_count, other.m_slabs_count);
+        m_offsets.swap(other.m_offsets);
+        m_entries.swap(other.m_entries);
+    }
+
+private:
+    void set_slabs(std::size_t & slabs, coordinate_type const& min_x, coordinate_type const& max_x)
+    {
+        calculation_type const width = calculation_type(max_x) - calculation_type(min_x);
+        if (! (width > 0))
+        {
+            slabs = 1;
+        }
+        m_slabs_count = slabs;
+        m_scale = slabs > 1 ? calculation_type(slabs) / width : 0;
+    }
+
+    template <typename T>
+    std::size_t slab(T const& x) const
+    {
+        calculation_type const s = (calculation_type(x) - m_min_x) * m_scale;
+        // also for NaN
+        if (! (s >= 0))
+        {
+            return 0;
+        }
+        return s < calculation_type(m_slabs_count) ? std::size_t(s) : m_slabs_count - 1;
+    }
+
+    calculation_type m_min_x;
+    calculation_type m_scale;
+    std::size_t m_slabs_count = 0;
+    std::vector<std::size_t> m_offsets;
+    std::vector<entry> m_entries;
+};
+
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_EDGE_GRID_HPP
@@ -0,0 +1,417 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_SEGMENT_INDEX_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_SEGMENT_INDEX_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/detail/envelope/interface.hpp>
+#include <boost/geometry/algorithms/detail/point_on_border.hpp>
+#include <boost/geometry/algorithms/detail/prepared/edge_grid.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/iterators/segment_iterator.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+#include <boost/geometry/views/detail/closed_clockwise_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+
+// Calls the function for every areal part, i.e. ring or polygon, of the geometry
+template <typename Geometry, typename Tag = tag_t<Geometry>>
+struct for_each_areal
+{
+    template <typename Function>
+    static inline void apply(Geometry const& geometry, Function&& function)
+    {
+        function(geometry);
+    }
+};
+
+template <typename MultiPolygon>
+struct for_each_areal<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Function>
+    static inline void apply(MultiPolygon const& multi_polygon, Function&& function)
+    {
+        for (auto const& polygon : multi_polygon)
+        {
+            function(polygon);
+        }
+    }
+};
+
+
+// Calls the function for every ring of the polygon, exterior ring first
+template <typename Geometry, typename Tag = tag_t<Geometry>>
+struct for_each_ring
+{
+    template <typename Function>
+    static inline void apply(Geometry const& ring, Function&& function)
+    {
+        function(ring, true);
+    }
+};
+
+template <typename Polygon>
+struct for_each_ring<Polygon, polygon_tag>
+{
+    template <typename Function>
+    static inline void apply(Polygon const& polygon, Function&& function)
+    {
+        function(exterior_ring(polygon), true);
+        for (auto const& ring : interior_rings(polygon))
+        {
+            function(ring, false);
+        }
+    }
+};
+
+
+// Calls the function for every connected part of the geometry
+template <typename Geometry, typename Tag = tag_t<Geometry>>
+struct for_each_part
+{
+    template <typename Function>
+    static inline void apply(Geometry const& geometry, Function&& function)
+    {
+        function(geometry);
+    }
+};
+
+template <typename Geometry>
+struct for_each_part<Geometry, multi_tag>
+{
+    template <typename Function>
+    static inline void apply(Geometry const& geometry, Function&& function)
+    {
+        for (auto const& part : geometry)
+        {
+            function(part);
+        }
+    }
+};
+
+template <typename Geometry>
+struct for_each_part<Geometry, multi_point_tag>
+    : for_each_part<Geometry, multi_tag>
+{};
+
+template <typename Geometry>
+struct for_each_part<Geometry, multi_linestring_tag>
+    : for_each_part<Geometry, multi_tag>
+{};
+
+template <typename Geometry>
+struct for_each_part<Geometry, multi_polygon_tag>
+    : for_each_part<Geometry, multi_tag>
+{};
+
+
+// The index of segments of an areal geometry (ring, polygon or multi-polygon)
+template <typename Geometry, typename Strategy>
+class segment_index
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (util::is_polygonal<Geometry>::value),
+        "Only polygonal geometries can be prepared.",
+        Geometry);
+
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (std::is_same<cs_tag_t<Geometry>, cartesian_tag>::value),
+        "Only cartesian geometries can be prepared.",
+        Geometry);
+
+public:
+    using point_type = point_type_t<Geometry>;
+    using box_type = model::box<point_type>;
+    using segment_type = model::segment<point_type>;
+
+private:
+    // segment and the index of its ring
+    using value_type = std::pair<segment_type, std::size_t>;
+    using parameters_type = index::parameters<index::rstar<16>, Strategy>;
+    using rtree_type = index::rtree<value_type, parameters_type>;
+    using grid_type = edge_grid<value_type>;
+
+    using ring_type = ring_type_t<Geometry>;
+    using point_in_ring_strategy = decltype(std::declval<Strategy>().relate(
+                                        std::declval<point_type>(), std::declval<ring_type>()));
+    using state_type = typename point_in_ring_strategy::state_type;
+
+    struct ring_info
+    {
+        std::size_t polygon;
+        bool exterior;
+    };
+
+    struct ring_state
+    {
+        std::size_t ring;
+        state_type state;
+    };
+
+    // The rings crossed by the query are kept on the stack in most cases
+    using ring_states = boost::container::small_vector<ring_state, 16>;
+
+public:
+    segment_index(Geometry const& geometry, Strategy const& strategy)
+        : m_strategy(strategy)
+        , m_point_in_ring(strategy.relate(point_type(), ring_type()))
+        , m_rtree(parameters_type(index::rstar<16>(), strategy))
+    {
+        std::vector<value_type> const values = segments(geometry);
+        grid_type(values).swap(m_grid);
+        rtree_type(values, parameters_type(index::rstar<16>(), strategy)).swap(m_rtree);
+    }
+
+    // The same as point_in_geometry(), i.e. 1 for interior, 0 for boundary and -1 for exterior,
+    // but only the segments of the grid slab containing the point and lying below it are analysed.
+    // The same as in the winding strategy the ray goes down from the point.
+    template <typename Point>
+    int point_in_geometry(Point const& point) const
+    {
+        if (m_rtree.empty())
+        {
+            return -1;
+        }
+
+        point_in_ring_strategy const& strategy = m_point_in_ring;
+
+        ring_states states;
+        m_grid.for_each_below(point, [&](value_type const& v)
+            {
+                auto it = std::find_if(states.begin(), states.end(), [&](ring_state const& s)
+                {
+                    return s.ring == v.second;
+                });
+                if (it == states.end())
+                {
+                    states.push_back(ring_state{v.second, state_type()});
+                    it = states.end() - 1;
+                }
+                // The segments are not visited in order so the state of the ring
+                // can't be updated after the point is found on the boundary
+                if (strategy.result(it->state) != 0)
+                {
+                    strategy.apply(point, v.first.first, v.first.second, it->state);
+                }
+            });
+
+        // The rings are analysed in the same order as in point_in_geometry()
+        std::sort(states.begin(), states.end(), [](ring_state const& l, ring_state const& r)
+        {
+            return l.ring < r.ring;
+        });
+
+        for (auto it = states.begin(); it != states.end(); )
+        {
+            std::size_t const polygon = m_rings[it->ring].polygon;
+            int code = -1;
+            if (m_rings[it->ring].exterior)
+            {
+                code = strategy.result(it->state);
+                ++it;
+            }
+
+            for ( ; it != states.end() && m_rings[it->ring].polygon == polygon; ++it)
+            {
+                // If 0, return 0 (touch)
+                // If 1 (inside hole) return -1 (outside polygon)
+                // If -1 (outside hole) check other holes if any
+                int const interior_code = strategy.result(it->state);
+                if (code == 1 && interior_code != -1)
+                {
+                    code = -interior_code;
+                }
+            }
+
+            // inside or on the boundary
+            if (code >= 0)
+            {
+                return code;
+            }
+        }
+
+        return -1;
+    }
+
+    // True if the geometry intersects the indexed geometry
+    template <typename OtherGeometry>
+    bool intersects(OtherGeometry const& geometry) const
+    {
+        if (m_rtree.empty())
+        {
+            return false;
+        }
+
+        return intersects(geometry, tag_cast_t<tag_t<OtherGeometry>, pointlike_tag>());
+    }
+
+private:
+    // Gathers the segments of all rings, also fills the informations about the rings
+    std::vector<value_type> segments(Geometry const& geometry)
+    {
+        std::vector<value_type> values;
+        std::size_t polygon = 0;
+        for_each_areal<Geometry>::apply(geometry, [&](auto const& areal)
+        {
+            for_each_ring<util::remove_cref_t<decltype(areal)>>::apply(areal,
+                [&](auto const& ring, bool exterior)
+            {
+                std::size_t const ring_index = m_rings.size();
+                m_rings.push_back(ring_info{polygon, exterior});
+
+                // The same as in point_in_geometry(), too small rings are outside
+                if (boost::size(ring) < core_detail::closure::minimum_ring_size
+                                            <
+                                                geometry::closure<ring_type>::value
+                                            >::value)
+                {
+                    return;
+                }
+
+                detail::closed_clockwise_view<ring_type const> const view(ring);
+                auto it = boost::begin(view);
+                auto const end = boost::end(view);
+                for (auto previous = it++; it != end; ++previous, ++it)
+                {
+                    values.emplace_back(segment_type(*previous, *it), ring_index);
+                }
+            });
+            ++polygon;
+        });
+        return values;
+    }
+
+    template <typename OtherGeometry>
+    bool intersects(OtherGeometry const& geometry, pointlike_tag) const
+    {
+        bool result = false;
+        for_each_part<OtherGeometry>::apply(geometry, [&](point_type_t<OtherGeometry> const& point)
+        {
+            result = result || point_in_geometry(point) >= 0;
+        });
+        return result;
+    }
+
+    template <typename OtherGeometry, typename Tag>
+    bool intersects(OtherGeometry const& geometry, Tag) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (util::is_linear<OtherGeometry>::value || util::is_polygonal<OtherGeometry>::value),
+            "Not implemented for this geometry type.",
+            OtherGeometry);
+
+        // The boundaries intersect
+        for (auto it = geometry::segments_begin(geometry); it != geometry::segments_end(geometry); ++it)
+        {
+            segment_type const segment(*(it->first), *(it->second));
+            if (m_rtree.qbegin(index::intersects(segment)) != m_rtree.qend())
+            {
+                return true;
+            }
+        }
+
+        // Parts of the geometry are inside the indexed geometry
+        bool result = false;
+        for_each_part<OtherGeometry>::apply(geometry, [&](auto const& part)
+        {
+            point_type point;
+            result = result
+                  || (geometry::point_on_border(point, part) && point_in_geometry(point) >= 0);
+        });
+
+        // Parts of the indexed geometry are inside the areal geometry
+        if (! result && util::is_polygonal<OtherGeometry>::value)
+        {
+            box_type const box = geometry::return_envelope<box_type>(geometry, m_strategy);
+            boost::container::small_vector<std::size_t, 16> rings;
+            for (auto it = m_rtree.qbegin(index::intersects(box)); it != m_rtree.qend(); ++it)
+            {
+                if (m_rings[it->second].exterior
+                    && std::find(rings.begin(), rings.end(), it->second) == rings.end())
+                {
+                    if (detail::within::point_in_geometry(it->first.first, geometry, m_strategy) >= 0)
+                    {
+                        return true;
+                    }
+                    rings.push_back(it->second);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    template <typename Segment>
+    bool intersects(Segment const& segment, segment_tag) const
+    {
+        segment_type seg;
+        detail::assign_point_from_index<0>(segment, seg.first);
+        detail::assign_point_from_index<1>(segment, seg.second);
+        return m_rtree.qbegin(index::intersects(seg)) != m_rtree.qend()
+            || point_in_geometry(seg.first) >= 0;
+    }
+
+    template <typename Box>
+    bool intersects(Box const& box, box_tag) const
+    {
+        model::ring<point_type> ring;
+        geometry::convert(box, ring);
+        return intersects(ring, ring_tag());
+    }
+
+    Strategy m_strategy;
+    point_in_ring_strategy m_point_in_ring;
+    std::vector<ring_info> m_rings;
+    // used by point_in_geometry()
+    grid_type m_grid;
+    // used by intersects()
+    rtree_type m_rtree;
+};
+
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_SEGMENT_INDEX_HPP
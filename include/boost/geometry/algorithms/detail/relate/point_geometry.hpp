@@ -39,6 +39,13 @@ struct point_geometry
     {
         int pig = detail::within::point_in_geometry(point, geometry, strategy);
 
+        apply(pig, geometry, result, strategy);
+    }
+
+    // pig is the result of point_in_geometry()
+    template <typename Result, typename Strategy>
+    static inline void apply(int pig, Geometry const& geometry, Result & result, Strategy const& strategy)
+    {
         if ( pig > 0 ) // within
         {
             update<interior, interior, '0', Transpose>(result);
@@ -0,0 +1,104 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_UNARY_UNION_UNARY_UNION_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_UNARY_UNION_UNARY_UNION_PARALLEL_HPP
+
+
+#include <cstddef>
+#include <future>
+#include <type_traits>
+
+#include <boost/geometry/algorithms/unary_union.hpp>
+#include <boost/geometry/strategies/parallel_turns.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace unary_union
+{
+
+
+// The same as merge() but independent subsets of elements are merged by many threads
+template <typename RandomIt, typename MultiPolygon, typename Strategy>
+inline void merge_parallel(RandomIt first, RandomIt last, MultiPolygon& out, Strategy const& strategy,
+                           std::size_t threads)
+{
+    auto const size = last - first;
+    if (threads <= 1 || size <= 2)
+    {
+        merge(first, last, out, strategy);
+        return;
+    }
+
+    RandomIt const mid = split(first, last);
+
+    MultiPolygon m1, m2;
+    std::size_t const threads1 = threads / 2;
+    std::future<void> future = std::async(std::launch::async, [&]()
+    {
+        merge_parallel(first, mid, m1, strategy, threads1);
+    });
+    merge_parallel(mid, last, m2, strategy, threads - threads1);
+    future.get();
+
+    decltype(first->box) box1, box2;
+    envelope(first, mid, box1, strategy);
+    envelope(mid, last, box2, strategy);
+
+    union_subsets(m1, box1, m2, box2, out, strategy);
+}
+
+// The final union is calculated with the parallel strategy, the subsets are merged
+// by many threads with the wrapped strategy
+template <typename Strategy>
+struct merge_all
+    <
+        Strategy,
+        std::enable_if_t<strategies::detail::is_parallel_turns<Strategy>::value>
+    >
+{
+    template <typename RandomIt, typename MultiPolygon>
+    static inline void apply(RandomIt first, RandomIt last, MultiPolygon& out,
+                             Strategy const& strategy)
+    {
+        std::size_t const threads = strategy.threads();
+        if (threads <= 1 || last - first <= 2)
+        {
+            merge(first, last, out, strategy);
+            return;
+        }
+
+        RandomIt const mid = split(first, last);
+
+        MultiPolygon m1, m2;
+        std::size_t const threads1 = threads / 2;
+        std::future<void> future = std::async(std::launch::async, [&]()
+        {
+            merge_parallel(first, mid, m1, strategy.sequential(), threads1);
+        });
+        merge_parallel(mid, last, m2, strategy.sequential(), threads - threads1);
+        future.get();
+
+        decltype(first->box) box1, box2;
+        envelope(first, mid, box1, strategy);
+        envelope(mid, last, box2, strategy);
+
+        union_subsets(m1, box1, m2, box2, out, strategy);
+    }
+};
+
+
+}} // namespace detail::unary_union
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_UNARY_UNION_UNARY_UNION_PARALLEL_HPP
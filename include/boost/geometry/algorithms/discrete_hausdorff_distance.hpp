@@ -44,6 +44,7 @@
 // Note that in order for this to work umbrella strategy has to contain
 // index strategies.
 #ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
+#include <boost/geometry/algorithms/comparable_distance.hpp>
 #include <boost/geometry/index/rtree.hpp>
 #endif // BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
 
@@ -105,35 +106,50 @@ struct range_range
                 Strategies
             >::type result_type;
 
-        typedef typename boost::range_size<Range1>::type size_type;
-
         boost::geometry::detail::throw_on_empty_input(r1);
         boost::geometry::detail::throw_on_empty_input(r2);
 
-        size_type const n = boost::size(r1);
         result_type dis_max = 0;
 
 #ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
         namespace bgi = boost::geometry::index;
-        using point_t = point_type_t<Range1>;
-        using rtree_type = bgi::rtree<point_t, bgi::linear<4> >;
+        using point1_t = point_type_t<Range1>;
+        using point2_t = point_type_t<Range2>;
+        using rtree_type = bgi::rtree<point2_t, bgi::linear<4> >;
         rtree_type rtree(boost::begin(r2), boost::end(r2));
-        point_t res;
-#endif
 
-        for (size_type i = 0 ; i < n ; i++)
+        auto const strategy = strategies.distance(dummy_point(), dummy_point());
+
+        // All nearest neighbours are searched at once, the queries are sorted
+        // and the neighbours of the previous query are reused
+        std::vector<decltype(bgi::nearest(std::declval<point1_t>(), 1))> predicates;
+        predicates.reserve(boost::size(r1));
+        for (auto it = boost::begin(r1); it != boost::end(r1); ++it)
         {
-#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
-            size_type found = rtree.query(bgi::nearest(range::at(r1, i), 1), &res);
-            result_type dis_min = strategy.apply(range::at(r1,i), res);
+            predicates.push_back(bgi::nearest(*it, 1));
+        }
+
+        rtree.batch_query(predicates, [&](std::size_t i, point2_t const& p)
+        {
+            result_type const dis_min = strategy.apply(range::at(r1, i), p);
+            if (dis_min > dis_max)
+            {
+                dis_max = dis_min;
+            }
+        });
 #else
+        typedef typename boost::range_size<Range1>::type size_type;
+
+        size_type const n = boost::size(r1);
+        for (size_type i = 0 ; i < n ; i++)
+        {
             result_type dis_min = point_range::apply(range::at(r1, i), r2, strategies);
-#endif
             if (dis_min > dis_max )
             {
                 dis_max = dis_min;
             }
         }
+#endif
         return dis_max;
     }
 };
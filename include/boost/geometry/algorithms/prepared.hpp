@@ -0,0 +1,316 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_PREPARED_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_PREPARED_HPP
+
+
+#include <memory>
+
+#include <boost/geometry/algorithms/detail/prepared/segment_index.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_geometry.hpp>
+#include <boost/geometry/algorithms/detail/relation/interface.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/strategies/relate/services.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Areal geometry prepared for repeated spatial predicates.
+\ingroup prepared
+\details The segments of the geometry are indexed once, when the object is created. The predicates
+    taking prepared geometry analyse only the segments close to the other geometry instead of
+    all segments of the prepared geometry. This pays off when many small geometries, e.g. points,
+    are tested against the same large geometry.
+
+    The prepared geometry refers to the original geometry which has to outlive it and can't be
+    modified.
+
+    The following algorithms take prepared geometry:
+    \li within(), covered_by() - for pointlike first geometry,
+    \li intersects(), disjoint() - for pointlike, linear and areal other geometry,
+    \li relate(), relation() - for point first geometry.
+
+\tparam Geometry Cartesian ring, polygon or multi-polygon.
+\tparam Strategy Umbrella relate strategy, e.g. strategies::relate::cartesian<>.
+
+\par Example
+\verbatim
+bg::prepared<multi_polygon_t> const prepared_country(country);
+for (point_t const& p : points)
+    if (bg::within(p, prepared_country))
+        ++count;
+\endverbatim
+*/
+template
+<
+    typename Geometry,
+    typename Strategy = typename strategies::relate::services::default_strategy
+        <
+            Geometry, Geometry
+        >::type
+>
+class prepared
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (util::is_polygonal<Geometry>::value),
+        "Only polygonal geometries can be prepared.",
+        Geometry);
+
+    using index_type = detail::prepared::segment_index<Geometry, Strategy>;
+
+public:
+    using geometry_type = Geometry;
+    using strategy_type = Strategy;
+
+    /*!
+    \brief Prepares the geometry.
+
+    \param geometry The geometry, it has to outlive the prepared geometry.
+    \param strategy The strategy used by the predicates.
+    */
+    explicit prepared(Geometry const& geometry, Strategy const& strategy = Strategy())
+        : m_geometry(std::addressof(geometry))
+        , m_strategy(strategy)
+        , m_index(geometry, strategy)
+    {
+        concepts::check<Geometry const>();
+    }
+
+    /*!
+    \brief Returns the prepared geometry.
+    */
+    Geometry const& geometry() const { return *m_geometry; }
+
+    /*!
+    \brief Returns the strategy.
+    */
+    Strategy const& strategy() const { return m_strategy; }
+
+#ifndef DOXYGEN_NO_DETAIL
+    // 1 for interior, 0 for boundary and -1 for exterior
+    template <typename Point>
+    int point_in_geometry(Point const& point) const
+    {
+        return m_index.point_in_geometry(point);
+    }
+
+    template <typename OtherGeometry>
+    bool intersects(OtherGeometry const& geometry) const
+    {
+        return m_index.intersects(geometry);
+    }
+#endif
+
+private:
+    Geometry const* m_geometry;
+    Strategy m_strategy;
+    index_type m_index;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+// Returns true if all points are covered by the geometry and if Within at least one is in the interior
+template <bool Within, typename Point, typename Geometry, typename Strategy>
+inline bool pointlike_within(Point const& point, geometry::prepared<Geometry, Strategy> const& prepared,
+                             point_tag)
+{
+    return prepared.point_in_geometry(point) >= (Within ? 1 : 0);
+}
+
+template <bool Within, typename MultiPoint, typename Geometry, typename Strategy>
+inline bool pointlike_within(MultiPoint const& multi_point, geometry::prepared<Geometry, Strategy> const& prepared,
+                             multi_point_tag)
+{
+    bool found_inside = false;
+    for (auto const& point : multi_point)
+    {
+        int const pig = prepared.point_in_geometry(point);
+        if (pig < 0)
+        {
+            return false;
+        }
+        found_inside = found_inside || pig > 0;
+    }
+    return Within ? found_inside : ! boost::empty(multi_point);
+}
+
+template <typename Point, typename Geometry, typename Strategy, typename Result>
+inline void point_relate(Point const& point, geometry::prepared<Geometry, Strategy> const& prepared,
+                         Result & result)
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (util::is_point<Point>::value),
+        "Only points can be related with prepared geometry.",
+        Point);
+
+    detail::relate::point_geometry
+        <
+            Point, Geometry
+        >::apply(prepared.point_in_geometry(point), prepared.geometry(), result, prepared.strategy());
+}
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Checks if the pointlike geometry is completely inside the prepared geometry.
+\ingroup within
+\param geometry1 Point or multi-point.
+\param geometry2 Prepared geometry.
+\return true if geometry1 is completely contained within geometry2, else false
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline bool within(Geometry1 const& geometry1, prepared<Geometry2, Strategy> const& geometry2)
+{
+    concepts::check<Geometry1 const>();
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (util::is_pointlike<Geometry1>::value),
+        "Not implemented for this geometry type.",
+        Geometry1);
+
+    return detail::prepared::pointlike_within<true>(geometry1, geometry2, tag_t<Geometry1>());
+}
+
+/*!
+\brief Checks if the pointlike geometry is inside or on the border of the prepared geometry.
+\ingroup covered_by
+\param geometry1 Point or multi-point.
+\param geometry2 Prepared geometry.
+\return true if geometry1 is inside of or on the border of geometry2, else false
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline bool covered_by(Geometry1 const& geometry1, prepared<Geometry2, Strategy> const& geometry2)
+{
+    concepts::check<Geometry1 const>();
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (util::is_pointlike<Geometry1>::value),
+        "Not implemented for this geometry type.",
+        Geometry1);
+
+    return detail::prepared::pointlike_within<false>(geometry1, geometry2, tag_t<Geometry1>());
+}
+
+/*!
+\brief Checks if the geometry has at least one intersection with the prepared geometry.
+\ingroup intersects
+\param geometry1 Pointlike, linear or areal geometry.
+\param geometry2 Prepared geometry.
+\return true if there is an intersection, else false
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline bool intersects(Geometry1 const& geometry1, prepared<Geometry2, Strategy> const& geometry2)
+{
+    concepts::check<Geometry1 const>();
+    return geometry2.intersects(geometry1);
+}
+
+/*!
+\brief Checks if the prepared geometry has at least one intersection with the geometry.
+\ingroup intersects
+\param geometry1 Prepared geometry.
+\param geometry2 Pointlike, linear or areal geometry.
+\return true if there is an intersection, else false
+*/
+template <typename Geometry1, typename Strategy, typename Geometry2>
+inline bool intersects(prepared<Geometry1, Strategy> const& geometry1, Geometry2 const& geometry2)
+{
+    concepts::check<Geometry2 const>();
+    return geometry1.intersects(geometry2);
+}
+
+/*!
+\brief Checks if the geometry is disjoint with the prepared geometry.
+\ingroup disjoint
+\param geometry1 Pointlike, linear or areal geometry.
+\param geometry2 Prepared geometry.
+\return true if the geometries are disjoint, else false
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline bool disjoint(Geometry1 const& geometry1, prepared<Geometry2, Strategy> const& geometry2)
+{
+    return ! geometry::intersects(geometry1, geometry2);
+}
+
+/*!
+\brief Checks if the prepared geometry is disjoint with the geometry.
+\ingroup disjoint
+\param geometry1 Prepared geometry.
+\param geometry2 Pointlike, linear or areal geometry.
+\return true if the geometries are disjoint, else false
+*/
+template <typename Geometry1, typename Strategy, typename Geometry2>
+inline bool disjoint(prepared<Geometry1, Strategy> const& geometry1, Geometry2 const& geometry2)
+{
+    return ! geometry::intersects(geometry1, geometry2);
+}
+
+/*!
+\brief Checks relation between the point and the prepared geometry defined by a mask.
+\ingroup relate
+\param geometry1 Point.
+\param geometry2 Prepared geometry.
+\param mask An intersection model mask object.
+\return true if the relation is compatible with the mask, false otherwise.
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy, typename Mask>
+inline bool relate(Geometry1 const& geometry1, prepared<Geometry2, Strategy> const& geometry2,
+                   Mask const& mask)
+{
+    concepts::check<Geometry1 const>();
+
+    typename detail::relate::result_handler_type
+        <
+            Geometry1,
+            Geometry2,
+            Mask
+        >::type handler(mask);
+
+    detail::prepared::point_relate(geometry1, geometry2, handler);
+
+    return handler.result();
+}
+
+/*!
+\brief Calculates the relation between the point and the prepared geometry as defined in DE-9IM.
+\ingroup relation
+\param geometry1 Point.
+\param geometry2 Prepared geometry.
+\return The DE-9IM matrix expressing the relation between geometries.
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline de9im::matrix relation(Geometry1 const& geometry1, prepared<Geometry2, Strategy> const& geometry2)
+{
+    concepts::check<Geometry1 const>();
+
+    typename detail::relate::result_handler_type
+        <
+            Geometry1,
+            Geometry2,
+            de9im::matrix
+        >::type handler;
+
+    detail::prepared::point_relate(geometry1, geometry2, handler);
+
+    return handler.result();
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_PREPARED_HPP
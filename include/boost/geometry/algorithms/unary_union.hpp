@@ -0,0 +1,343 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_UNARY_UNION_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_UNARY_UNION_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/expand_by_epsilon.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/relate/services.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace unary_union
+{
+
+
+// The envelope of a geometry and the iterator to it
+template <typename Box, typename Iterator>
+struct element
+{
+    Box box;
+    Iterator it;
+};
+
+template <typename Box>
+inline double box_center(Box const& box, std::size_t dimension)
+{
+    return dimension == 0
+         ? (double(geometry::get<min_corner, 0>(box)) + double(geometry::get<max_corner, 0>(box))) / 2
+         : (double(geometry::get<min_corner, 1>(box)) + double(geometry::get<max_corner, 1>(box))) / 2;
+}
+
+// Splits the elements into two halves of spatially close geometries. The elements are partially
+// sorted by the centers of their envelopes along the dimension in which the centers are spread
+// the most. Returns the iterator to the first element of the second half.
+template <typename RandomIt>
+inline RandomIt split(RandomIt first, RandomIt last)
+{
+    double min_x = box_center(first->box, 0), max_x = min_x;
+    double min_y = box_center(first->box, 1), max_y = min_y;
+    for (RandomIt it = first; it != last; ++it)
+    {
+        double const x = box_center(it->box, 0);
+        double const y = box_center(it->box, 1);
+        min_x = (std::min)(min_x, x);
+        max_x = (std::max)(max_x, x);
+        min_y = (std::min)(min_y, y);
+        max_y = (std::max)(max_y, y);
+    }
+
+    std::size_t const dimension = max_x - min_x >= max_y - min_y ? 0 : 1;
+    RandomIt const mid = first + (last - first) / 2;
+    using element_t = typename std::iterator_traits<RandomIt>::value_type;
+    std::nth_element(first, mid, last, [&](element_t const& l, element_t const& r)
+    {
+        return box_center(l.box, dimension) < box_center(r.box, dimension);
+    });
+    return mid;
+}
+
+// Calculates the union of the geometries of two subsets of the elements. If the envelopes of
+// the subsets are disjoint the geometries are disjoint too and their union is not calculated.
+template <typename MultiPolygon, typename Box, typename Strategy>
+inline void union_subsets(MultiPolygon& m1, Box const& box1,
+                          MultiPolygon& m2, Box const& box2,
+                          MultiPolygon& out, Strategy const& strategy)
+{
+    if (geometry::disjoint(box1, box2, strategy))
+    {
+        out = std::move(m1);
+        for (auto& polygon : m2)
+        {
+            range::push_back(out, std::move(polygon));
+        }
+    }
+    else
+    {
+        geometry::union_(m1, m2, out, strategy);
+    }
+}
+
+template <typename RandomIt, typename Box, typename Strategy>
+inline void envelope(RandomIt first, RandomIt last, Box& box, Strategy const& strategy)
+{
+    box = first->box;
+    for (RandomIt it = first + 1; it != last; ++it)
+    {
+        geometry::expand(box, it->box, strategy);
+    }
+}
+
+// Calculates the union of the geometries of the elements in a balanced tree of unions
+template <typename RandomIt, typename MultiPolygon, typename Strategy>
+inline void merge(RandomIt first, RandomIt last, MultiPolygon& out, Strategy const& strategy)
+{
+    auto const size = last - first;
+    if (size == 1)
+    {
+        geometry::convert(*(first->it), out);
+        return;
+    }
+
+    RandomIt const mid = split(first, last);
+
+    MultiPolygon m1, m2;
+    merge(first, mid, m1, strategy);
+    merge(mid, last, m2, strategy);
+
+    decltype(first->box) box1, box2;
+    envelope(first, mid, box1, strategy);
+    envelope(mid, last, box2, strategy);
+
+    union_subsets(m1, box1, m2, box2, out, strategy);
+}
+
+// The iterators to the geometries of the range merged separately, the rings or polygons
+template
+<
+    typename Geometry,
+    bool IsMulti = util::is_multi_polygon<typename boost::range_value<Geometry>::type>::value
+>
+struct areal_iterators
+{
+    using iterator = typename boost::range_iterator<Geometry const>::type;
+
+    template <typename Function>
+    static inline void for_each(Geometry const& geometry, Function const& function)
+    {
+        for (iterator it = boost::begin(geometry); it != boost::end(geometry); ++it)
+        {
+            function(it);
+        }
+    }
+};
+
+// The polygons of a multi-polygon may overlap the polygons of other multi-polygons and
+// the polygons of the same multi-polygon aren't merged by union_ so all of them are merged
+// separately
+template <typename Geometry>
+struct areal_iterators<Geometry, true>
+{
+    using iterator = typename boost::range_iterator
+        <
+            typename boost::range_value<Geometry>::type const
+        >::type;
+
+    template <typename Function>
+    static inline void for_each(Geometry const& geometry, Function const& function)
+    {
+        for (auto const& multi : geometry)
+        {
+            for (iterator it = boost::begin(multi); it != boost::end(multi); ++it)
+            {
+                function(it);
+            }
+        }
+    }
+};
+
+// Merges the elements of the geometries. Specialized for strategies::parallel_turns in
+// unary_union_parallel.hpp so the threads are used only if that strategy is included.
+template <typename Strategy, typename Enable = void>
+struct merge_all
+{
+    template <typename RandomIt, typename MultiPolygon>
+    static inline void apply(RandomIt first, RandomIt last, MultiPolygon& out,
+                             Strategy const& strategy)
+    {
+        merge(first, last, out, strategy);
+    }
+};
+
+struct unary_union
+{
+    template <typename Geometry, typename MultiPolygon, typename Strategy>
+    static inline void apply(Geometry const& geometry, MultiPolygon& out, Strategy const& strategy)
+    {
+        using iterators_t = areal_iterators<Geometry>;
+        using iterator_t = typename iterators_t::iterator;
+        using point_t = geometry::point_type_t<typename boost::range_value<Geometry>::type>;
+        using box_t = model::box<point_t>;
+        using element_t = element<box_t, iterator_t>;
+
+        std::vector<element_t> elements;
+        elements.reserve(boost::size(geometry));
+        iterators_t::for_each(geometry, [&](iterator_t it)
+        {
+            if (! geometry::is_empty(*it))
+            {
+                box_t box;
+                geometry::envelope(*it, box, strategy);
+                // Touching geometries have to be merged so their envelopes can't be disjoint
+                detail::expand_by_epsilon(box);
+                elements.push_back(element_t{box, it});
+            }
+        });
+
+        MultiPolygon result;
+        if (! elements.empty())
+        {
+            merge_all<Strategy>::apply(elements.begin(), elements.end(), result, strategy);
+        }
+        out = std::move(result);
+    }
+};
+
+
+}} // namespace detail::unary_union
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace resolve_strategy
+{
+
+template <typename Strategy>
+struct unary_union
+{
+    template <typename Geometry, typename MultiPolygon>
+    static void apply(Geometry const& geometry, MultiPolygon& out, Strategy const& strategy)
+    {
+        detail::unary_union::unary_union::apply(geometry, out, strategy);
+    }
+};
+
+template <>
+struct unary_union<default_strategy>
+{
+    template <typename Geometry, typename MultiPolygon>
+    static void apply(Geometry const& geometry, MultiPolygon& out, default_strategy)
+    {
+        using value_type = typename boost::range_value<Geometry>::type;
+        using strategy_type = typename strategies::relate::services::default_strategy
+            <
+                value_type, value_type
+            >::type;
+
+        detail::unary_union::unary_union::apply(geometry, out, strategy_type());
+    }
+};
+
+} // namespace resolve_strategy
+
+
+/*!
+\brief Calculates the union of all areal geometries of a range or a multi-polygon.
+\ingroup union
+\details The geometries are merged in a balanced tree of unions. The geometries close
+    to each other are merged first, so the sizes of intermediate results are small
+    compared to merging the geometries one by one. The unions of subsets having disjoint
+    envelopes are not calculated, their polygons are just gathered. The polygons of
+    multi-polygons stored in the range are merged separately so the polygons of the same
+    multi-polygon are dissolved too.
+
+    If the strategy is strategies::parallel_turns then independent subsets are merged
+    by many threads using the wrapped strategy and the final union is calculated with
+    the parallel strategy.
+\tparam Geometry Multi-polygon or range of rings, polygons or multi-polygons.
+\tparam MultiPolygon Multi-polygon.
+\tparam Strategy Umbrella relate strategy, e.g. strategies::relate::cartesian<>.
+\param geometry Geometries to merge.
+\param out The union of all geometries.
+\param strategy The strategy.
+
+\par Example
+\verbatim
+std::vector<polygon_t> parcels = ...;
+multi_polygon_t dissolved;
+bg::unary_union(parcels, dissolved, bg::strategies::parallel_turns<bg::strategies::relate::cartesian<> >());
+\endverbatim
+*/
+template <typename Geometry, typename MultiPolygon, typename Strategy>
+inline void unary_union(Geometry const& geometry, MultiPolygon& out, Strategy const& strategy)
+{
+    using value_type = typename boost::range_value<Geometry>::type;
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (util::is_areal<value_type>::value),
+        "Only ranges of areal geometries are supported.",
+        Geometry);
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (util::is_multi_polygon<MultiPolygon>::value),
+        "The output has to be a multi-polygon.",
+        MultiPolygon);
+
+    concepts::check<value_type const>();
+    concepts::check<MultiPolygon>();
+
+    resolve_strategy::unary_union<Strategy>::apply(geometry, out, strategy);
+}
+
+/*!
+\brief Calculates the union of all areal geometries of a range or a multi-polygon.
+\ingroup union
+\tparam Geometry Multi-polygon or range of rings, polygons or multi-polygons.
+\tparam MultiPolygon Multi-polygon.
+\param geometry Geometries to merge.
+\param out The union of all geometries.
+*/
+template <typename Geometry, typename MultiPolygon>
+inline void unary_union(Geometry const& geometry, MultiPolygon& out)
+{
+    geometry::unary_union(geometry, out, default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_UNARY_UNION_HPP
@@ -104,6 +104,7 @@
 #include <boost/geometry/algorithms/sym_difference.hpp>
 #include <boost/geometry/algorithms/touches.hpp>
 #include <boost/geometry/algorithms/transform.hpp>
+#include <boost/geometry/algorithms/unary_union.hpp>
 #include <boost/geometry/algorithms/union.hpp>
 #include <boost/geometry/algorithms/unique.hpp>
 #include <boost/geometry/algorithms/within.hpp>
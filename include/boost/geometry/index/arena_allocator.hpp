@@ -0,0 +1,200 @@
+// Boost.Geometry Index
+//
+// The allocator carving nodes from large slabs
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_ARENA_ALLOCATOR_HPP
+#define BOOST_GEOMETRY_INDEX_ARENA_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include <boost/geometry/index/detail/arena.hpp>
+#include <boost/geometry/index/detail/exception.hpp>
+#include <boost/geometry/index/detail/rtree/node/variant_static.hpp>
+#include <boost/geometry/index/detail/rtree/options.hpp>
+#include <boost/geometry/index/detail/rtree/pack_create.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The allocator carving nodes from large slabs of memory.
+
+It may be passed as the Allocator of the rtree in order to avoid many small allocations
+of nodes. The nodes are carved from slabs one after another and the memory of the removed
+nodes is reused for new nodes of the same size. The slabs are released at once when the
+last copy of the allocator is destroyed, e.g. together with the rtree.
+
+The copies of the allocator share the slabs so the rtrees created from the same allocator,
+e.g. copied, swapped or assigned, use the same memory. The allocator is not thread-safe,
+the rtrees sharing the slabs can't be modified concurrently and it shouldn't be used with
+concurrent_rtree. The rtree created with parallel_packing and this allocator is created by
+one thread.
+
+\par Example
+\verbatim
+typedef bgi::rtree<Value, bgi::rstar<16>, bgi::indexable<Value>,
+                   bgi::equal_to<Value>, bgi::arena_allocator<Value>> rtree_t;
+rtree_t rt(values);
+\endverbatim
+
+\tparam T   The type of allocated objects.
+*/
+template <typename T>
+class arena_allocator
+{
+    template <typename U>
+    friend class arena_allocator;
+    template <typename Allocators, typename Enable>
+    friend struct detail::rtree::release_nodes;
+
+public:
+    typedef T value_type;
+    typedef T * pointer;
+    typedef T const* const_pointer;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    // the slabs are shared so the allocator is propagated together with the nodes
+    typedef std::true_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef arena_allocator<U> other;
+    };
+
+    /*!
+    \brief The constructor creating the new slabs.
+
+    \param slab_size    The size of a slab in bytes.
+
+    \par Throws
+    If allocation throws.
+    */
+    explicit arena_allocator(std::size_t slab_size = 1024 * 1024)
+        : m_arena(std::make_shared<detail::arena>(slab_size))
+    {
+        static_assert(alignof(T) <= detail::arena::alignment, "Overaligned types are not supported.");
+    }
+
+    /*!
+    \brief The copy constructor sharing the slabs.
+
+    The allocator is not moved so the moved-from container could still be used.
+    */
+    arena_allocator(arena_allocator const& other)
+        : m_arena(other.m_arena)
+    {}
+
+    /*!
+    \brief The constructor of rebound allocator sharing the slabs.
+    */
+    template <typename U>
+    arena_allocator(arena_allocator<U> const& other)
+        : m_arena(other.m_arena)
+    {
+        static_assert(alignof(T) <= detail::arena::alignment, "Overaligned types are not supported.");
+    }
+
+    arena_allocator & operator=(arena_allocator const& other)
+    {
+        m_arena = other.m_arena;
+        return *this;
+    }
+
+    T * allocate(std::size_t n)
+    {
+        if (n > (std::size_t(-1) / sizeof(T)))
+        {
+            detail::throw_length_error("too many objects");
+        }
+        return static_cast<T *>(m_arena->allocate(n * sizeof(T)));                          // MAY THROW
+    }
+
+    void deallocate(T * ptr, std::size_t n)
+    {
+        m_arena->deallocate(ptr, n * sizeof(T));
+    }
+
+    /*!
+    \brief Returns the number of slabs allocated so far.
+    */
+    std::size_t slabs_count() const
+    {
+        return m_arena->slabs_count();
+    }
+
+    /*!
+    \brief Returns the size of a slab in bytes.
+    */
+    std::size_t slab_size() const
+    {
+        return m_arena->slab_size();
+    }
+
+    template <typename U>
+    bool operator==(arena_allocator<U> const& other) const
+    {
+        return m_arena == other.m_arena;
+    }
+
+    template <typename U>
+    bool operator!=(arena_allocator<U> const& other) const
+    {
+        return m_arena != other.m_arena;
+    }
+
+private:
+    std::shared_ptr<detail::arena> m_arena;
+};
+
+namespace detail { namespace rtree {
+
+// The arena is not thread-safe so the nodes can't be created by many threads
+template <typename T, typename Value, typename Parameters, typename Box, typename NodeTag>
+struct is_thread_safe_allocators
+    <
+        allocators<index::arena_allocator<T>, Value, Parameters, Box, NodeTag>
+    >
+{
+    static const bool value = false;
+};
+
+// The static nodes store the elements inside so if the elements are trivially destructible
+// destroying the nodes does nothing. If the rtree holds the only copy of the allocator and
+// all nodes are stored in slabs they are released together with the allocator.
+template <typename T, typename Value, typename Parameters, typename Box>
+struct release_nodes
+    <
+        allocators<index::arena_allocator<T>, Value, Parameters, Box, node_variant_static_tag>,
+        std::enable_if_t
+            <
+                std::is_trivially_destructible<Value>::value
+                && std::is_trivially_destructible<Box>::value
+            >
+    >
+{
+    typedef allocators<index::arena_allocator<T>, Value, Parameters, Box, node_variant_static_tag> allocators_type;
+
+    static inline bool apply(allocators_type const& allocs)
+    {
+        std::shared_ptr<detail::arena> const& arena = allocs.node_allocator().m_arena;
+        return arena.use_count() == 1 && arena->in_slabs();
+    }
+};
+
+}} // namespace detail::rtree
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_ARENA_ALLOCATOR_HPP
@@ -0,0 +1,752 @@
+// Boost.Geometry Index
+//
+// R-tree with concurrent readers and snapshots
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_CONCURRENT_RTREE_HPP
+#define BOOST_GEOMETRY_INDEX_CONCURRENT_RTREE_HPP
+
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/index/detail/config_begin.hpp>
+
+#include <boost/geometry/index/detail/rtree/concurrent/build.hpp>
+#include <boost/geometry/index/detail/rtree/concurrent/modify.hpp>
+#include <boost/geometry/index/detail/rtree/concurrent/node.hpp>
+#include <boost/geometry/index/detail/rtree/concurrent/query.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The R-tree spatial index which may be queried while it's modified.
+
+The nodes of the tree are immutable and shared between versions of the tree. Insertion and
+removal copy the nodes on the path from the root to the modified node, the rest of the nodes
+is shared with the previous version, and then the new version is published atomically.
+
+Readers query the snapshot of the tree returned by snapshot(). The snapshot is a reference to one
+version of the tree so it's cheap to take and to hold and it isn't affected by modifications
+published after it was taken. Queries don't lock anything and may be performed from any number
+of threads at the same time. The nodes are released when the last snapshot referencing them is
+destroyed, in the thread destroying it.
+
+Insertions and removals may be called from any thread, they're serialized with a mutex.
+If a range of values is inserted or removed all of them are published at once, readers
+see either none or all of them. Modifying the tree with ranges is also faster because the
+nodes created by the same modification are not copied again.
+
+Overflowing nodes are split in half in the order of the Hilbert index of their elements
+regardless of the algorithm chosen with Parameters, the Parameters define the maximum and
+minimum numbers of elements in nodes. The tree created from a range of Values or from an rtree
+has the same structure as the rtree.
+
+\tparam Value           The type of objects stored in the container.
+\tparam Parameters      Compile-time parameters used to create the tree.
+\tparam IndexableGetter The function object extracting Indexable from Value.
+\tparam EqualTo         The function object comparing objects of type Value.
+\tparam Allocator       The allocator used to allocate/deallocate memory and construct/destroy nodes and Values.
+*/
+template
+<
+    typename Value,
+    typename Parameters,
+    typename IndexableGetter = index::indexable<Value>,
+    typename EqualTo = index::equal_to<Value>,
+    typename Allocator = boost::container::new_allocator<Value>
+>
+class concurrent_rtree
+{
+public:
+    /*! \brief The type of the rtree from which the concurrent_rtree may be created. */
+    typedef index::rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> rtree_type;
+
+    /*! \brief The type of Value stored in the container. */
+    typedef Value value_type;
+    /*! \brief R-tree parameters type. */
+    typedef Parameters parameters_type;
+    /*! \brief The function object extracting Indexable from Value. */
+    typedef IndexableGetter indexable_getter;
+    /*! \brief The function object comparing objects of type Value. */
+    typedef EqualTo value_equal;
+    /*! \brief The type of allocator used by the container. */
+    typedef Allocator allocator_type;
+
+    /*! \brief The Indexable type to which Value is translated. */
+    typedef typename rtree_type::indexable_type indexable_type;
+    /*! \brief The Box type used by the R-tree. */
+    typedef typename rtree_type::bounds_type bounds_type;
+
+private:
+    typedef detail::rtree::concurrent::members
+        <
+            Value, Parameters, IndexableGetter, EqualTo, Allocator, bounds_type
+        > members_type;
+    typedef detail::rtree::concurrent::version<members_type> version_type;
+
+public:
+    /*! \brief Unsigned integral type used by the container. */
+    typedef typename members_type::size_type size_type;
+
+    /*!
+    \brief The read-only snapshot of the concurrent_rtree.
+
+    The snapshot references one version of the tree. It may be copied, it's cheap to copy,
+    and queried from any thread.
+    */
+    class snapshot_type
+    {
+        friend class concurrent_rtree;
+
+        explicit snapshot_type(std::shared_ptr<version_type const> const& v)
+            : m_version(v)
+        {}
+
+    public:
+        /*!
+        \brief The constructor of an empty snapshot.
+
+        \par Throws
+        Nothing.
+        */
+        snapshot_type() = default;
+
+        /*!
+        \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
+
+        The same predicates as in the rtree can be passed. For the information about predicates
+        which may be passed see rtree::query().
+
+        \par Example
+        \verbatim
+        snapshot.query(bgi::intersects(box), std::back_inserter(result));
+        snapshot.query(bgi::nearest(pt, 5) && bgi::intersects(box), std::back_inserter(result));
+        \endverbatim
+
+        \par Throws
+        If Value copy constructor or copy assignment throws.
+        If predicates copy throws.
+
+        \param predicates   Predicates.
+        \param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+        \return             The number of values found.
+        */
+        template <typename Predicates, typename OutIter>
+        size_type query(Predicates const& predicates, OutIter out_it) const
+        {
+            return m_version && m_version->root
+                 ? query_dispatch(predicates, out_it)
+                 : 0;
+        }
+
+        /*!
+        \brief Returns the number of stored values.
+
+        \return         The number of stored values.
+
+        \par Throws
+        Nothing.
+        */
+        size_type size() const
+        {
+            return m_version ? m_version->values_count : 0;
+        }
+
+        /*!
+        \brief Query if the snapshot is empty.
+
+        \return         true if the snapshot is empty.
+
+        \par Throws
+        Nothing.
+        */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /*!
+        \brief Returns the box able to contain all values stored in the snapshot.
+
+        If the snapshot is empty the result of \c geometry::assign_inverse() is returned.
+
+        \return     The box able to contain all values stored in the snapshot or an invalid box if
+                    there are no values in the snapshot.
+
+        \par Throws
+        Nothing.
+        */
+        bounds_type bounds() const
+        {
+            bounds_type result;
+            if (m_version && m_version->root)
+            {
+                result = detail::rtree::concurrent::node_box(*m_version->root,
+                                                            m_version->leafs_level,
+                                                            *m_version->members);
+            }
+            else
+            {
+                geometry::assign_inverse(result);
+            }
+            return result;
+        }
+
+    private:
+        template
+        <
+            typename Predicates, typename OutIter,
+            std::enable_if_t<(detail::predicates_count_distance<Predicates>::value == 0), int> = 0
+        >
+        size_type query_dispatch(Predicates const& predicates, OutIter out_it) const
+        {
+            detail::rtree::concurrent::spatial_query<members_type, Predicates, OutIter>
+                query(*m_version->members, predicates, out_it);
+            return query.apply(*m_version);
+        }
+
+        template
+        <
+            typename Predicates, typename OutIter,
+            std::enable_if_t<(detail::predicates_count_distance<Predicates>::value > 0), int> = 0
+        >
+        size_type query_dispatch(Predicates const& predicates, OutIter out_it) const
+        {
+            BOOST_GEOMETRY_STATIC_ASSERT((detail::predicates_count_distance<Predicates>::value == 1),
+                                         "Only one distance predicate can be passed.",
+                                         Predicates);
+
+            detail::rtree::concurrent::distance_query<members_type, Predicates>
+                distance_v(*m_version->members, m_version->values_count, predicates);
+            return distance_v.apply(*m_version, out_it);
+        }
+
+        std::shared_ptr<version_type const> m_version;
+    };
+
+    /*!
+    \brief The constructor.
+
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    If allocator copy constructor throws.
+    If allocation throws.
+    */
+    inline explicit concurrent_rtree(parameters_type const& parameters = parameters_type(),
+                                     indexable_getter const& getter = indexable_getter(),
+                                     value_equal const& equal = value_equal(),
+                                     allocator_type const& allocator = allocator_type())
+        : m_members(std::make_shared<members_type>(getter, equal, parameters, allocator))
+        , m_generation(0)
+    {
+        m_version.store(std::make_shared<version_type>(m_members));
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using packing algorithm.
+
+    \param first        The beginning of the range of Values.
+    \param last         The end of the range of Values.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    */
+    template <typename Iterator>
+    inline concurrent_rtree(Iterator first, Iterator last,
+                            parameters_type const& parameters = parameters_type(),
+                            indexable_getter const& getter = indexable_getter(),
+                            value_equal const& equal = value_equal(),
+                            allocator_type const& allocator = allocator_type())
+        : m_members(std::make_shared<members_type>(getter, equal, parameters, allocator))
+        , m_generation(0)
+    {
+        build(rtree_type(first, last, parameters, getter, equal, allocator));
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using packing algorithm.
+
+    \param rng          The range of Values.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    */
+    template <typename Range>
+    inline explicit concurrent_rtree(Range const& rng,
+                                     parameters_type const& parameters = parameters_type(),
+                                     indexable_getter const& getter = indexable_getter(),
+                                     value_equal const& equal = value_equal(),
+                                     allocator_type const& allocator = allocator_type())
+        : m_members(std::make_shared<members_type>(getter, equal, parameters, allocator))
+        , m_generation(0)
+    {
+        build(rtree_type(::boost::begin(rng), ::boost::end(rng), parameters, getter, equal, allocator));
+    }
+
+    /*!
+    \brief The constructor.
+
+    The structure of the rtree is copied so the nodes of the concurrent_rtree are the same.
+
+    \param tree         The rtree.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor throws.
+    \li If allocation throws.
+    */
+    inline explicit concurrent_rtree(rtree_type const& tree)
+        : m_members(std::make_shared<members_type>(tree.indexable_get(), tree.value_eq(),
+                                                   tree.parameters(), tree.get_allocator()))
+        , m_generation(0)
+    {
+        build(tree);
+    }
+
+    concurrent_rtree(concurrent_rtree const&) = delete;
+    concurrent_rtree & operator=(concurrent_rtree const&) = delete;
+
+    /*!
+    \brief Returns the snapshot of the current version of the tree.
+
+    \par Throws
+    Nothing.
+
+    \return     The snapshot.
+    */
+    snapshot_type snapshot() const
+    {
+        return snapshot_type(m_version.load());
+    }
+
+    /*!
+    \brief Insert a value to the index.
+
+    \param value    The value which will be stored in the container.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \par Exception-safety
+    strong
+    */
+    inline void insert(value_type const& value)
+    {
+        modify([&](modify_type & modify_v)
+        {
+            modify_v.insert(value);                                                         // MAY THROW (A, V: copy)
+            return size_type(1);
+        });
+    }
+
+    /*!
+    \brief Insert a range of values to the index.
+
+    The values are published at once.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \par Exception-safety
+    strong
+    */
+    template <typename Iterator>
+    inline void insert(Iterator first, Iterator last)
+    {
+        modify([&](modify_type & modify_v)
+        {
+            size_type count = 0;
+            for (; first != last ; ++first, ++count)
+            {
+                modify_v.insert(*first);                                                    // MAY THROW (A, V: copy)
+            }
+            return count;
+        });
+    }
+
+    /*!
+    \brief Insert a value created using convertible object or a range of values to the index.
+
+    \param conv_or_rng      An object of type convertible to value_type or a range of values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \par Exception-safety
+    strong
+    */
+    template <typename ConvertibleOrRange>
+    inline void insert(ConvertibleOrRange const& conv_or_rng)
+    {
+        typedef std::is_convertible<ConvertibleOrRange, value_type> is_conv_t;
+        typedef range::detail::is_range<ConvertibleOrRange> is_range_t;
+        BOOST_GEOMETRY_STATIC_ASSERT((is_conv_t::value || is_range_t::value),
+            "The argument has to be convertible to Value type or be a Range.",
+            ConvertibleOrRange);
+
+        this->insert_dispatch(conv_or_rng, is_conv_t());
+    }
+
+    /*!
+    \brief Remove a value from the container.
+
+    This method removes only one value from the container.
+
+    \param value    The value which will be removed from the container.
+
+    \return         1 if the value was removed, 0 otherwise.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \par Exception-safety
+    strong
+    */
+    inline size_type remove(value_type const& value)
+    {
+        return modify([&](modify_type & modify_v)
+        {
+            return modify_v.remove(value) ? size_type(1) : size_type(0);                    // MAY THROW (A, V: copy)
+        });
+    }
+
+    /*!
+    \brief Remove a range of values from the container.
+
+    This method removes one value equal to each value passed in the range. The values are
+    published at once.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \return         The number of removed values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \par Exception-safety
+    strong
+    */
+    template <typename Iterator>
+    inline size_type remove(Iterator first, Iterator last)
+    {
+        return modify([&](modify_type & modify_v)
+        {
+            size_type count = 0;
+            for (; first != last ; ++first)
+            {
+                if (modify_v.remove(*first))                                                // MAY THROW (A, V: copy)
+                {
+                    ++count;
+                }
+            }
+            return count;
+        });
+    }
+
+    /*!
+    \brief Remove value corresponding to an object convertible to it or a range of values from the container.
+
+    \param conv_or_rng      The object of type convertible to value_type or a range of values.
+
+    \return         The number of removed values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \par Exception-safety
+    strong
+    */
+    template <typename ConvertibleOrRange>
+    inline size_type remove(ConvertibleOrRange const& conv_or_rng)
+    {
+        typedef std::is_convertible<ConvertibleOrRange, value_type> is_conv_t;
+        typedef range::detail::is_range<ConvertibleOrRange> is_range_t;
+        BOOST_GEOMETRY_STATIC_ASSERT((is_conv_t::value || is_range_t::value),
+            "The argument has to be convertible to Value type or be a Range.",
+            ConvertibleOrRange);
+
+        return this->remove_dispatch(conv_or_rng, is_conv_t());
+    }
+
+    /*!
+    \brief Removes all values stored in the container.
+
+    The snapshots taken before are not affected.
+
+    \par Throws
+    If allocation throws.
+    */
+    inline void clear()
+    {
+        std::shared_ptr<version_type const> empty = std::make_shared<version_type>(m_members); // MAY THROW (A)
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_version.store(empty);
+    }
+
+    /*!
+    \brief Finds values meeting passed predicates in the current version of the tree.
+
+    It's equivalent to <tt>snapshot().query(predicates, out_it)</tt>.
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If predicates copy throws.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it) const
+    {
+        return snapshot().query(predicates, out_it);
+    }
+
+    /*!
+    \brief Returns the number of values stored in the current version of the tree.
+
+    \return         The number of stored values.
+
+    \par Throws
+    Nothing.
+    */
+    inline size_type size() const
+    {
+        return snapshot().size();
+    }
+
+    /*!
+    \brief Query if the current version of the tree is empty.
+
+    \return         true if the container is empty.
+
+    \par Throws
+    Nothing.
+    */
+    inline bool empty() const
+    {
+        return snapshot().empty();
+    }
+
+    /*!
+    \brief Returns the box able to contain all values stored in the current version of the tree.
+
+    If the container is empty the result of \c geometry::assign_inverse() is returned.
+
+    \return     The box able to contain all values stored in the container or an invalid box if
+                there are no values in the container.
+
+    \par Throws
+    Nothing.
+    */
+    inline bounds_type bounds() const
+    {
+        return snapshot().bounds();
+    }
+
+    /*!
+    \brief Returns parameters.
+
+    \return     The parameters object.
+
+    \par Throws
+    Nothing.
+    */
+    inline parameters_type parameters() const
+    {
+        return m_members->parameters();
+    }
+
+    /*!
+    \brief Returns function retrieving Indexable from Value.
+
+    \return     The indexable_getter object.
+
+    \par Throws
+    Nothing.
+    */
+    indexable_getter indexable_get() const
+    {
+        return m_members->indexable_getter();
+    }
+
+    /*!
+    \brief Returns function comparing Values
+
+    \return     The value_equal function.
+
+    \par Throws
+    Nothing.
+    */
+    value_equal value_eq() const
+    {
+        return m_members->equal_to();
+    }
+
+    /*!
+    \brief Returns allocator used by the concurrent_rtree.
+
+    \return     The allocator.
+
+    \par Throws
+    If allocator copy constructor throws.
+    */
+    allocator_type get_allocator() const
+    {
+        return m_members->get_allocator();
+    }
+
+private:
+    typedef detail::rtree::concurrent::modify<members_type> modify_type;
+
+    void build(rtree_type const& tree)
+    {
+        std::shared_ptr<version_type> v = std::make_shared<version_type>(m_members);      // MAY THROW (A)
+
+        if (! tree.empty())
+        {
+            detail::rtree::utilities::view<rtree_type> const tree_view(tree);
+            detail::rtree::concurrent::build
+                <
+                    typename detail::rtree::utilities::view<rtree_type>::members_holder,
+                    members_type
+                > build_v(*m_members, m_generation);
+
+            build_v.apply(tree_view, *v);                                                   // MAY THROW (A, V: copy)
+            v->values_count = tree.size();
+        }
+
+        m_version.store(v);
+    }
+
+    // The function modifies the copy of the current version which is published if anything
+    // was modified. The nodes of the new generation are modified in place.
+    template <typename Function>
+    size_type modify(Function && f)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::shared_ptr<version_type> v
+            = std::make_shared<version_type>(*m_version.load());                            // MAY THROW (A)
+
+        ++m_generation;
+        modify_type modify_v(*v, *m_members, m_generation);
+        size_type const result = f(modify_v);                                               // MAY THROW (A, V: copy)
+
+        if (0 < result)
+        {
+            m_version.store(std::move(v));
+        }
+
+        return result;
+    }
+
+    template <typename ValueConvertible>
+    inline void insert_dispatch(ValueConvertible const& val_conv,
+                                std::true_type /*is_convertible*/)
+    {
+        this->insert(value_type(val_conv));
+    }
+
+    template <typename Range>
+    inline void insert_dispatch(Range const& rng,
+                                std::false_type /*is_convertible*/)
+    {
+        this->insert(boost::const_begin(rng), boost::const_end(rng));
+    }
+
+    template <typename ValueConvertible>
+    inline size_type remove_dispatch(ValueConvertible const& val_conv,
+                                     std::true_type /*is_convertible*/)
+    {
+        return this->remove(value_type(val_conv));
+    }
+
+    template <typename Range>
+    inline size_type remove_dispatch(Range const& rng,
+                                     std::false_type /*is_convertible*/)
+    {
+        return this->remove(boost::const_begin(rng), boost::const_end(rng));
+    }
+
+    std::shared_ptr<members_type const> m_members;
+    detail::rtree::concurrent::atomic_shared_ptr<version_type const> m_version;
+
+    std::mutex m_mutex;
+    size_type m_generation;
+};
+
+/*!
+\brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
+
+It calls <tt>concurrent_rtree::query(Predicates const&, OutIter)</tt>.
+
+\ingroup rtree_functions
+
+\param tree         The concurrent_rtree.
+\param predicates   Predicates.
+\param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+\return             The number of values found.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+          typename Predicates, typename OutIter> inline
+typename concurrent_rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::size_type
+query(concurrent_rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
+      Predicates const& predicates,
+      OutIter out_it)
+{
+    return tree.query(predicates, out_it);
+}
+
+}}} // namespace boost::geometry::index
+
+#include <boost/geometry/index/detail/config_end.hpp>
+
+#endif // BOOST_GEOMETRY_INDEX_CONCURRENT_RTREE_HPP
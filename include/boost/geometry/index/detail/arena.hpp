@@ -0,0 +1,168 @@
+// Boost.Geometry Index
+//
+// Arena of memory blocks carved from large slabs
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_ARENA_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_ARENA_HPP
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/index/detail/assert.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail {
+
+// The blocks are carved from slabs one after another. The deallocated blocks are stored in
+// the lists of free blocks of the same size and reused. The slabs are released at once when
+// the arena is destroyed. Blocks bigger than 1/8 of the slab are allocated separately.
+class arena
+{
+    // a free block stores the pointer to the next free block of the same size
+    struct free_block
+    {
+        free_block * next;
+    };
+
+public:
+    static const std::size_t alignment = alignof(std::max_align_t);
+
+    explicit arena(std::size_t slab_size)
+        : m_slab_size(round_up(slab_size < 64 * alignment ? 64 * alignment : slab_size))
+        , m_current(nullptr)
+        , m_left(0)
+        , m_separate_count(0)
+    {}
+
+    ~arena()
+    {
+        for (void * slab : m_slabs)
+        {
+            ::operator delete(slab);
+        }
+    }
+
+    arena(arena const&) = delete;
+    arena & operator=(arena const&) = delete;
+
+    void * allocate(std::size_t size)
+    {
+        size = block_size(size);
+        if (size > m_slab_size / 8)
+        {
+            void * result = ::operator new(size);                                           // MAY THROW
+            ++m_separate_count;
+            return result;
+        }
+
+        free_block *& head = free_list(size);                                               // MAY THROW
+        if (head != nullptr)
+        {
+            free_block * result = head;
+            head = result->next;
+            return result;
+        }
+
+        if (m_left < size)
+        {
+            m_slabs.reserve(m_slabs.size() + 1);                                            // MAY THROW
+            // the rest of the current slab is not used
+            m_current = static_cast<char *>(::operator new(m_slab_size));                   // MAY THROW
+            m_left = m_slab_size;
+            m_slabs.push_back(m_current);
+        }
+
+        void * result = m_current;
+        m_current += size;
+        m_left -= size;
+        return result;
+    }
+
+    void deallocate(void * ptr, std::size_t size)
+    {
+        size = block_size(size);
+        if (size > m_slab_size / 8)
+        {
+            BOOST_GEOMETRY_INDEX_ASSERT(0 < m_separate_count, "invalid deallocation");
+            ::operator delete(ptr);
+            --m_separate_count;
+            return;
+        }
+
+        free_block * block = static_cast<free_block *>(ptr);
+        free_block *& head = find_free_list(size);
+        block->next = head;
+        head = block;
+    }
+
+    std::size_t slab_size() const
+    {
+        return m_slab_size;
+    }
+
+    std::size_t slabs_count() const
+    {
+        return m_slabs.size();
+    }
+
+    // True if all allocated blocks are stored in slabs so they are released with the arena
+    bool in_slabs() const
+    {
+        return m_separate_count == 0;
+    }
+
+private:
+    static std::size_t round_up(std::size_t size)
+    {
+        return (size + alignment - 1) / alignment * alignment;
+    }
+
+    static std::size_t block_size(std::size_t size)
+    {
+        return round_up(size < sizeof(free_block) ? sizeof(free_block) : size);
+    }
+
+    // there are only several sizes of nodes so the lists are searched linearly
+    free_block *& free_list(std::size_t size)
+    {
+        for (auto & l : m_free_lists)
+        {
+            if (l.first == size)
+            {
+                return l.second;
+            }
+        }
+        m_free_lists.push_back(std::make_pair(size, static_cast<free_block *>(nullptr)));  // MAY THROW
+        return m_free_lists.back().second;
+    }
+
+    // the list was created when the block was allocated
+    free_block *& find_free_list(std::size_t size)
+    {
+        auto it = m_free_lists.begin();
+        while (it->first != size)
+        {
+            ++it;
+            BOOST_GEOMETRY_INDEX_ASSERT(it != m_free_lists.end(), "invalid deallocation");
+        }
+        return it->second;
+    }
+
+    std::size_t m_slab_size;
+    std::vector<void *> m_slabs;
+    char * m_current;
+    std::size_t m_left;
+    std::vector<std::pair<std::size_t, free_block *> > m_free_lists;
+    std::size_t m_separate_count;
+};
+
+}}}} // namespace boost::geometry::index::detail
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_ARENA_HPP
@@ -0,0 +1,224 @@
+// Boost.Geometry Index
+//
+// Spatial join predicates definition and checks.
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_JOIN_PREDICATES_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_JOIN_PREDICATES_HPP
+
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/geometry/algorithms/detail/distance/interface.hpp>
+#include <boost/geometry/algorithms/detail/intersects/interface.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/util/select_most_precise.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail {
+
+namespace predicates {
+
+// ------------------------------------------------------------------ //
+// join predicates
+// ------------------------------------------------------------------ //
+
+struct join_intersects {};
+
+template <typename T>
+struct join_within_distance
+{
+    join_within_distance(T const& d)
+        : distance(d)
+    {}
+
+    T distance;
+};
+
+} // namespace predicates
+
+// ------------------------------------------------------------------ //
+// join_predicate_check
+// ------------------------------------------------------------------ //
+
+// The predicates are checked for pairs of Indexables and for pairs of node boxes.
+// If the boxes of nodes doesn't meet the predicate then Indexables stored in these
+// nodes doesn't meet it either. bounds() is called only for pairs of boxes.
+// Distances between cartesian Points and Boxes are compared without the square root.
+
+// Coordinates of the bounds of Points and Boxes.
+template <typename Geometry, typename Tag = tag_t<Geometry> >
+struct join_bounds_access
+{
+    static const bool is_supported = false;
+};
+
+template <typename Point>
+struct join_bounds_access<Point, point_tag>
+{
+    static const bool is_supported = true;
+
+    template <std::size_t I>
+    static inline coordinate_type_t<Point> get_min(Point const& p) { return geometry::get<I>(p); }
+    template <std::size_t I>
+    static inline coordinate_type_t<Point> get_max(Point const& p) { return geometry::get<I>(p); }
+};
+
+template <typename Box>
+struct join_bounds_access<Box, box_tag>
+{
+    static const bool is_supported = true;
+
+    template <std::size_t I>
+    static inline coordinate_type_t<Box> get_min(Box const& b) { return geometry::get<min_corner, I>(b); }
+    template <std::size_t I>
+    static inline coordinate_type_t<Box> get_max(Box const& b) { return geometry::get<max_corner, I>(b); }
+};
+
+// The squared distance between cartesian Points or Boxes.
+template <typename T, std::size_t I, std::size_t N>
+struct join_comparable_distance
+{
+    template <typename G1, typename G2>
+    static inline T apply(G1 const& g1, G2 const& g2)
+    {
+        typedef join_bounds_access<G1> access1;
+        typedef join_bounds_access<G2> access2;
+
+        // at most one of the differences is positive
+        T const diff1 = T(access2::template get_min<I>(g2)) - T(access1::template get_max<I>(g1));
+        T const diff2 = T(access1::template get_min<I>(g1)) - T(access2::template get_max<I>(g2));
+        T const diff = (std::max)((std::max)(diff1, diff2), T(0));
+
+        return diff * diff + join_comparable_distance<T, I + 1, N>::apply(g1, g2);
+    }
+};
+
+template <typename T, std::size_t N>
+struct join_comparable_distance<T, N, N>
+{
+    template <typename G1, typename G2>
+    static inline T apply(G1 const&, G2 const&)
+    {
+        return 0;
+    }
+};
+
+template <typename Predicate>
+struct join_predicate_check
+{
+    BOOST_GEOMETRY_STATIC_ASSERT_FALSE(
+        "Not implemented for this Predicate type.",
+        Predicate);
+};
+
+template <>
+struct join_predicate_check<predicates::join_intersects>
+{
+    template <typename G1, typename G2, typename Strategy>
+    static inline bool apply(predicates::join_intersects const&,
+                             G1 const& g1, G2 const& g2, Strategy const& s)
+    {
+        return geometry::intersects(g1, g2, s);
+    }
+
+    template <typename Box1, typename Box2, typename Strategy>
+    static inline bool bounds(predicates::join_intersects const& p,
+                              Box1 const& b1, Box2 const& b2, Strategy const& s)
+    {
+        return apply(p, b1, b2, s);
+    }
+};
+
+template <typename T>
+struct join_predicate_check<predicates::join_within_distance<T> >
+{
+    template <typename G1, typename G2, typename Strategy>
+    static inline bool apply(predicates::join_within_distance<T> const& p,
+                             G1 const& g1, G2 const& g2, Strategy const& s)
+    {
+        typedef std::integral_constant
+            <
+                bool,
+                std::is_same<cs_tag_t<G1>, cartesian_tag>::value
+                && join_bounds_access<G1>::is_supported
+                && join_bounds_access<G2>::is_supported
+            > use_comparable;
+
+        return apply(p, g1, g2, s, use_comparable());
+    }
+
+    template <typename Box1, typename Box2, typename Strategy>
+    static inline bool bounds(predicates::join_within_distance<T> const& p,
+                              Box1 const& b1, Box2 const& b2, Strategy const& s)
+    {
+        return apply(p, b1, b2, s);
+    }
+
+private:
+    template <typename G1, typename G2, typename Strategy>
+    static inline bool apply(predicates::join_within_distance<T> const& p,
+                             G1 const& g1, G2 const& g2, Strategy const& s,
+                             std::false_type)
+    {
+        return geometry::distance(g1, g2, s) <= p.distance;
+    }
+
+    // compare squared distances to avoid the square root, a negative distance
+    // is checked before squaring so both versions agree
+    template <typename G1, typename G2, typename Strategy>
+    static inline bool apply(predicates::join_within_distance<T> const& p,
+                             G1 const& g1, G2 const& g2, Strategy const&,
+                             std::true_type)
+    {
+        if (p.distance < T(0))
+        {
+            return false;
+        }
+
+        typedef typename select_most_precise
+            <
+                T, coordinate_type_t<G1>, coordinate_type_t<G2>
+            >::type calc_t;
+
+        calc_t const d = p.distance;
+        return join_comparable_distance
+                <
+                    calc_t, 0, dimension<G1>::value
+                >::apply(g1, g2) <= d * d;
+    }
+};
+
+template <typename Predicate>
+struct is_join_predicate
+{
+    static const bool value = false;
+};
+
+template <>
+struct is_join_predicate<predicates::join_intersects>
+{
+    static const bool value = true;
+};
+
+template <typename T>
+struct is_join_predicate<predicates::join_within_distance<T> >
+{
+    static const bool value = true;
+};
+
+}}}} // namespace boost::geometry::index::detail
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_JOIN_PREDICATES_HPP
@@ -492,6 +492,171 @@ struct predicate_check<predicates::path<Linestring>, bounds_tag>
     }
 };
 
+// ------------------------------------------------------------------ //
+// predicates_check for full bounds
+// ------------------------------------------------------------------ //
+
+// True only if all values in the bounds surely meet the predicate,
+// false doesn't mean that there are values not meeting the predicate.
+
+// NOT NEGATED
+// value_tag        full_bounds_tag
+// ---------------------------
+// contains(I,G)    FALSE
+// covered_by(I,G)  covered_by(I,G)
+// covers(I,G)      FALSE
+// disjoint(I,G)    !intersects(I,G)
+// intersects(I,G)  covered_by(I,G)
+// overlaps(I,G)    FALSE
+// touches(I,G)     FALSE
+// within(I,G)      FALSE
+
+// NEGATED
+// value_tag        full_bounds_tag
+// ---------------------------
+// !contains(I,G)   FALSE
+// !covered_by(I,G) !intersects(I,G)
+// !covers(I,G)     FALSE
+// !disjoint(I,G)   covered_by(I,G)
+// !intersects(I,G) !intersects(I,G)
+// !overlaps(I,G)   FALSE
+// !touches(I,G)    FALSE
+// !within(I,G)     !intersects(I,G)
+
+template <typename Fun, bool Negated>
+struct predicate_check<predicates::satisfies<Fun, Negated>, full_bounds_tag>
+{
+    template <typename Value, typename Box, typename Strategy>
+    static bool apply(predicates::satisfies<Fun, Negated> const&, Value const&, Box const&, Strategy const&)
+    {
+        return false;
+    }
+};
+
+template <bool Covered>
+struct full_bounds_check
+{
+    template <typename Pred, typename Indexable, typename Strategy>
+    static inline bool apply(Pred const& p, Indexable const& i, Strategy const& s)
+    {
+        return spatial_predicate_call<predicates::covered_by_tag>::apply(i, p.geometry, s);
+    }
+};
+
+template <>
+struct full_bounds_check<false>
+{
+    template <typename Pred, typename Indexable, typename Strategy>
+    static inline bool apply(Pred const& p, Indexable const& i, Strategy const& s)
+    {
+        return !spatial_predicate_call<predicates::intersects_tag>::apply(i, p.geometry, s);
+    }
+};
+
+// spatial predicate - default
+template <typename Geometry, typename Tag, bool Negated>
+struct predicate_check<predicates::spatial_predicate<Geometry, Tag, Negated>, full_bounds_tag>
+{
+    typedef predicates::spatial_predicate<Geometry, Tag, Negated> Pred;
+
+    template <typename Value, typename Indexable, typename Strategy>
+    static inline bool apply(Pred const& , Value const&, Indexable const& , Strategy const& )
+    {
+        return false;
+    }
+};
+
+// spatial predicate - covered_by
+template <typename Geometry>
+struct predicate_check<predicates::spatial_predicate<Geometry, predicates::covered_by_tag, false>, full_bounds_tag>
+{
+    typedef predicates::spatial_predicate<Geometry, predicates::covered_by_tag, false> Pred;
+
+    template <typename Value, typename Indexable, typename Strategy>
+    static inline bool apply(Pred const& p, Value const&, Indexable const& i, Strategy const& s)
+    {
+        return full_bounds_check<true>::apply(p, i, s);
+    }
+};
+
+// spatial predicate - disjoint
+template <typename Geometry>
+struct predicate_check<predicates::spatial_predicate<Geometry, predicates::disjoint_tag, false>, full_bounds_tag>
+{
+    typedef predicates::spatial_predicate<Geometry, predicates::disjoint_tag, false> Pred;
+
+    template <typename Value, typename Indexable, typename Strategy>
+    static inline bool apply(Pred const& p, Value const&, Indexable const& i, Strategy const& s)
+    {
+        return full_bounds_check<false>::apply(p, i, s);
+    }
+};
+
+// spatial predicate - intersects
+template <typename Geometry>
+struct predicate_check<predicates::spatial_predicate<Geometry, predicates::intersects_tag, false>, full_bounds_tag>
+{
+    typedef predicates::spatial_predicate<Geometry, predicates::intersects_tag, false> Pred;
+
+    template <typename Value, typename Indexable, typename Strategy>
+    static inline bool apply(Pred const& p, Value const&, Indexable const& i, Strategy const& s)
+    {
+        return full_bounds_check<true>::apply(p, i, s);
+    }
+};
+
+// negated spatial predicate - covered_by
+template <typename Geometry>
+struct predicate_check<predicates::spatial_predicate<Geometry, predicates::covered_by_tag, true>, full_bounds_tag>
+{
+    typedef predicates::spatial_predicate<Geometry, predicates::covered_by_tag, true> Pred;
+
+    template <typename Value, typename Indexable, typename Strategy>
+    static inline bool apply(Pred const& p, Value const&, Indexable const& i, Strategy const& s)
+    {
+        return full_bounds_check<false>::apply(p, i, s);
+    }
+};
+
+// negated spatial predicate - disjoint
+template <typename Geometry>
+struct predicate_check<predicates::spatial_predicate<Geometry, predicates::disjoint_tag, true>, full_bounds_tag>
+{
+    typedef predicates::spatial_predicate<Geometry, predicates::disjoint_tag, true> Pred;
+
+    template <typename Value, typename Indexable, typename Strategy>
+    static inline bool apply(Pred const& p, Value const&, Indexable const& i, Strategy const& s)
+    {
+        return full_bounds_check<true>::apply(p, i, s);
+    }
+};
+
+// negated spatial predicate - intersects
+template <typename Geometry>
+struct predicate_check<predicates::spatial_predicate<Geometry, predicates::intersects_tag, true>, full_bounds_tag>
+{
+    typedef predicates::spatial_predicate<Geometry, predicates::intersects_tag, true> Pred;
+
+    template <typename Value, typename Indexable, typename Strategy>
+    static inline bool apply(Pred const& p, Value const&, Indexable const& i, Strategy const& s)
+    {
+        return full_bounds_check<false>::apply(p, i, s);
+    }
+};
+
+// negated spatial predicate - within
+template <typename Geometry>
+struct predicate_check<predicates::spatial_predicate<Geometry, predicates::within_tag, true>, full_bounds_tag>
+{
+    typedef predicates::spatial_predicate<Geometry, predicates::within_tag, true> Pred;
+
+    template <typename Value, typename Indexable, typename Strategy>
+    static inline bool apply(Pred const& p, Value const&, Indexable const& i, Strategy const& s)
+    {
+        return full_bounds_check<false>::apply(p, i, s);
+    }
+};
+
 // ------------------------------------------------------------------ //
 // predicates_length
 // ------------------------------------------------------------------ //
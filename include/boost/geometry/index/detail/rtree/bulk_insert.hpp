@@ -0,0 +1,475 @@
+// Boost.Geometry Index
+//
+// R-tree bulk insertion
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_BULK_INSERT_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_BULK_INSERT_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/algorithms/centroid.hpp>
+
+#include <boost/geometry/index/detail/assert.hpp>
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/rtree/node/node_elements.hpp>
+#include <boost/geometry/index/detail/rtree/node/subtree_destroyer.hpp>
+#include <boost/geometry/index/detail/rtree/pack_hilbert.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/insert.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
+
+// Bulk insertion
+//
+// The elements are passed down the tree in groups. In each internal node every element of
+// the group is assigned to the child requiring the smallest content enlargement, as in the
+// linear and quadratic R-trees, and the group is divided between the children. When a group
+// reaches a node of the target level its elements are added to the node at once. If the node
+// overflows, its old and new elements are sorted by the Hilbert index of their centroids and
+// distributed evenly between the node and new siblings, as in pack_hilbert, so each node is
+// split at most once no matter how many elements it receives. The siblings are added to the
+// parent the same way after all of its children are processed. If the root overflows the
+// tree grows, possibly by more than one level.
+//
+// The nodes created by a split are filled halfway between Min and Max elements so there is
+// room for the next deltas.
+//
+// The elements are values if relative_level is 0 or internal node elements (subtrees) of
+// height relative_level otherwise. They're moved into the tree.
+
+template <typename MembersHolder>
+class bulk_insert
+{
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename allocators_type::node_pointer node_pointer;
+    typedef typename allocators_type::size_type size_type;
+
+    typedef typename rtree::elements_type<internal_node>::type internal_elements;
+    typedef typename internal_elements::value_type internal_element;
+
+    typedef typename geometry::point_type<box_type>::type point_type;
+    static const std::size_t dimension = geometry::dimension<point_type>::value;
+
+    typedef rtree::subtree_destroyer<MembersHolder> subtree_destroyer;
+
+    // the index of a child or the Hilbert index and the index of an element
+    typedef std::pair<std::uint64_t, size_type> entry_type;
+    typedef std::vector<entry_type> entries_type;
+    typedef typename entries_type::iterator entry_iterator;
+
+    typedef std::vector<internal_element> siblings_type;
+
+    static_assert(0 < dimension && dimension <= 64, "Unsupported dimension.");
+
+    // the same as in pack_hilbert
+    static const std::size_t bits = 64 / dimension < 16 ? 64 / dimension : 16;
+
+public:
+    inline bulk_insert(node_pointer & root,
+                       size_type & leafs_level,
+                       parameters_type const& parameters,
+                       translator_type const& translator,
+                       allocators_type & allocators)
+        : m_root(root)
+        , m_leafs_level(leafs_level)
+        , m_parameters(parameters)
+        , m_translator(translator)
+        , m_allocators(allocators)
+    {}
+
+    // If an exception is thrown the subtrees which weren't inserted are destroyed
+    template <typename Elements>
+    inline void apply(Elements & elements, size_type relative_level)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_root, "The root must exist");
+        BOOST_GEOMETRY_INDEX_ASSERT(relative_level <= m_leafs_level, "unexpected level");
+
+        typedef std::is_same<typename Elements::value_type, value_type> is_value_t;
+
+        if ( elements.empty() )
+            return;
+
+        siblings_type siblings;
+
+        BOOST_TRY
+        {
+            entries_type entries;
+            entries.reserve(elements.size());                                                       // MAY THROW (A)
+            for ( size_type i = 0 ; i < elements.size() ; ++i )
+                entries.push_back(entry_type(0, i));
+
+            box_type root_box = insert_elements(m_root, 0, m_leafs_level - relative_level,
+                                                entries.begin(), entries.end(),
+                                                elements, siblings);                                // MAY THROW (V, E: alloc, copy, N: alloc)
+
+            // the root was split, grow the tree
+            while ( ! siblings.empty() )
+            {
+                grow(root_box, siblings);                                                           // MAY THROW (E: alloc, N: alloc)
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            rtree::destroy_elements<MembersHolder>::apply(siblings, m_allocators);
+            destroy_remaining(elements, is_value_t());
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+private:
+    template <typename Elements>
+    box_type insert_elements(node_pointer n, size_type level, size_type target_level,
+                             entry_iterator first, entry_iterator last,
+                             Elements & elements, siblings_type & siblings)
+    {
+        typedef std::is_same<typename Elements::value_type, value_type> is_value_t;
+
+        if ( level == target_level )
+        {
+            return insert_to_target(n, first, last, elements, siblings, is_value_t());              // MAY THROW (V, E: alloc, copy, N: alloc)
+        }
+
+        internal_node & in = rtree::get<internal_node>(*n);
+        internal_elements & children = rtree::elements(in);
+
+        BOOST_GEOMETRY_INDEX_ASSERT(! children.empty(), "internal node can't be empty");
+
+        auto const& strategy = index::detail::get_strategy(m_parameters);
+
+        // assign elements to children, the boxes of children are expanded on the way
+        // so the following elements see the previous ones
+        for ( entry_iterator it = first ; it != last ; ++it )
+        {
+            auto const& indexable = rtree::element_indexable(elements[it->second], m_translator);
+            size_type const i = choose_next_node<MembersHolder, choose_by_content_diff_tag>
+                                    ::apply(in, indexable, m_parameters, 0);
+            index::detail::expand(children[i].first, indexable, strategy);
+            it->first = i;
+        }
+
+        sort_by_child(first, last, children.size());                                              // MAY THROW (A)
+
+        siblings_type children_siblings;
+
+        BOOST_TRY
+        {
+            while ( first != last )
+            {
+                size_type const i = static_cast<size_type>(first->first);
+                entry_iterator group_last = first;
+                for ( ; group_last != last && group_last->first == i ; ++group_last ) {}
+
+                children[i].first = insert_elements(children[i].second, level + 1, target_level,
+                                                     first, group_last,
+                                                     elements, children_siblings);                  // MAY THROW (V, E: alloc, copy, N: alloc)
+                first = group_last;
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            rtree::destroy_elements<MembersHolder>::apply(children_siblings, m_allocators);
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        return add_elements(in, children_siblings, siblings);                                       // MAY THROW (E: alloc, N: alloc)
+    }
+
+    // Counting sort of the entries by the indexes of children
+    void sort_by_child(entry_iterator first, entry_iterator last, size_type children_count)
+    {
+        m_counts.assign(children_count + 1, 0);                                                     // MAY THROW (A)
+        for ( entry_iterator it = first ; it != last ; ++it )
+            ++m_counts[it->first + 1];
+        for ( size_type i = 1 ; i < children_count ; ++i )
+            m_counts[i] += m_counts[i - 1];
+
+        m_sorted_entries.resize(static_cast<size_type>(std::distance(first, last)));               // MAY THROW (A)
+        for ( entry_iterator it = first ; it != last ; ++it )
+            m_sorted_entries[m_counts[it->first]++] = *it;
+
+        std::copy(m_sorted_entries.begin(), m_sorted_entries.end(), first);
+    }
+
+    template <typename Elements, typename IsValue>
+    box_type insert_to_target(node_pointer n, entry_iterator first, entry_iterator last,
+                              Elements & elements, siblings_type & siblings,
+                              IsValue const& is_value)
+    {
+        typedef typename std::conditional<IsValue::value, leaf, internal_node>::type node_type;
+        typedef typename rtree::elements_type<node_type>::type elements_type;
+
+        node_type & target = rtree::get<node_type>(*n);
+        elements_type & target_elements = rtree::elements(target);
+        size_type const count = static_cast<size_type>(std::distance(first, last));
+
+        // the elements fit in the node
+        if ( target_elements.size() + count <= m_parameters.get_max_elements() )
+        {
+            for ( ; first != last ; ++first )
+            {
+                target_elements.push_back(std::move(elements[first->second]));                     // MAY THROW (V: copy)
+                release(elements[first->second], is_value);
+            }
+
+            return node_box(target);
+        }
+
+        Elements new_elements;
+        new_elements.reserve(count);                                                                // MAY THROW (A)
+        for ( ; first != last ; ++first )
+        {
+            new_elements.push_back(std::move(elements[first->second]));                            // MAY THROW (V: copy)
+            release(elements[first->second], is_value);
+        }
+
+        return add_elements(target, new_elements, siblings);                                        // MAY THROW (V, E: alloc, copy, N: alloc)
+    }
+
+    void grow(box_type & root_box, siblings_type & siblings)
+    {
+        siblings_type new_elements;
+        BOOST_TRY
+        {
+            new_elements.reserve(siblings.size() + 1);                                              // MAY THROW (A)
+        }
+        BOOST_CATCH(...)
+        {
+            rtree::destroy_elements<MembersHolder>::apply(siblings, m_allocators);
+            siblings.clear();
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        new_elements.push_back(internal_element(root_box, m_root));
+        new_elements.insert(new_elements.end(), siblings.begin(), siblings.end());
+        siblings.clear();
+
+        // the new root is set before the elements are added to it
+        // so the old root is owned by new_elements or by the new root
+        node_pointer new_root = 0;
+        BOOST_TRY
+        {
+            new_root = rtree::create_node<allocators_type, internal_node>::apply(m_allocators);     // MAY THROW (A)
+        }
+        BOOST_CATCH(...)
+        {
+            // the old root is still owned by the tree
+            rtree::destroy_elements<MembersHolder>::apply(new_elements.begin() + 1, new_elements.end(), m_allocators);
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        m_root = new_root;
+        ++m_leafs_level;
+
+        root_box = add_elements(rtree::get<internal_node>(*new_root), new_elements, siblings);      // MAY THROW (E: alloc, N: alloc)
+    }
+
+    // Adds elements to the node, if the node overflows the elements are distributed between
+    // the node and new siblings. Returns the box of the node.
+    // The elements are owned by new_elements until they're added to the nodes.
+    template <typename Node, typename Elements>
+    box_type add_elements(Node & n, Elements & new_elements, siblings_type & siblings)
+    {
+        typedef typename rtree::elements_type<Node>::type elements_type;
+        typedef std::is_same<typename Elements::value_type, value_type> is_value_t;
+
+        elements_type & elements = rtree::elements(n);
+
+        BOOST_TRY
+        {
+            if ( elements.size() + new_elements.size() <= m_parameters.get_max_elements() )
+            {
+                for ( size_type i = 0 ; i < new_elements.size() ; ++i )
+                {
+                    elements.push_back(std::move(new_elements[i]));                                 // MAY THROW (V: copy)
+                    release(new_elements[i], is_value_t());
+                }
+
+                return node_box(n);
+            }
+
+            // overflow, the new elements and the elements of the node are distributed
+            new_elements.reserve(elements.size() + new_elements.size());                            // MAY THROW (A)
+            for ( size_type i = 0 ; i < elements.size() ; ++i )
+                new_elements.push_back(std::move(elements[i]));                                     // MAY THROW (V: copy)
+            elements.clear();
+
+            return split(n, new_elements, siblings);                                                // MAY THROW (V: copy, E: alloc, N: alloc)
+        }
+        BOOST_CATCH(...)
+        {
+            destroy_remaining(new_elements, is_value_t());
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+    template <typename Node, typename Elements>
+    box_type split(Node & n, Elements & new_elements, siblings_type & siblings)
+    {
+        typedef typename rtree::elements_type<Node>::type elements_type;
+        typedef std::is_same<typename Elements::value_type, value_type> is_value_t;
+
+        size_type const count = new_elements.size();
+        size_type const nodes_count = calculate_nodes_count(count);
+
+        entries_type entries;
+        entries.reserve(count);                                                                     // MAY THROW (A)
+        calculate_hilbert_indexes(new_elements, entries);
+        std::sort(entries.begin(), entries.end(), pack_utils::hilbert_entries_comparer());
+
+        siblings.reserve(siblings.size() + nodes_count - 1);                                        // MAY THROW (A)
+
+        box_type result;
+        entry_iterator it = entries.begin();
+        for ( size_type i = 0 ; i < nodes_count ; ++i )
+        {
+            // the node is reused for the first part
+            node_pointer sibling = 0;
+            if ( 0 < i )
+                sibling = rtree::create_node<allocators_type, Node>::apply(m_allocators);          // MAY THROW (A)
+            subtree_destroyer auto_remover(sibling, m_allocators);
+            Node & dst = 0 < i ? rtree::get<Node>(*sibling) : n;
+            elements_type & elements = rtree::elements(dst);
+
+            size_type const node_size = calculate_node_size(count, nodes_count, i);
+            for ( size_type j = 0 ; j < node_size ; ++j, ++it )
+            {
+                elements.push_back(std::move(new_elements[it->second]));                            // MAY THROW (V: copy)
+                release(new_elements[it->second], is_value_t());
+            }
+
+            box_type const box = node_box(dst);
+            if ( 0 < i )
+            {
+                siblings.push_back(internal_element(box, sibling));
+                auto_remover.release();
+            }
+            else
+            {
+                result = box;
+            }
+        }
+
+        return result;
+    }
+
+    // The number of nodes between which the elements are distributed so the nodes contain
+    // (Max + Min) / 2 elements on average and between Min and Max elements.
+    size_type calculate_nodes_count(size_type count) const
+    {
+        size_type const max_count = m_parameters.get_max_elements();
+        size_type const min_count = m_parameters.get_min_elements();
+        size_type const fill_count = (max_count + min_count + 1) / 2;
+
+        size_type const lowest = (count + max_count - 1) / max_count;
+        size_type const highest = count / min_count;
+        size_type const result = (count + fill_count - 1) / fill_count;
+        return result < lowest ? lowest : result > highest ? highest : result;
+    }
+
+    // The number of elements in i-th node if count elements are distributed evenly between nodes
+    static inline size_type calculate_node_size(size_type count, size_type nodes_count, size_type i)
+    {
+        return count / nodes_count + (i < count % nodes_count ? 1 : 0);
+    }
+
+    template <typename Elements>
+    void calculate_hilbert_indexes(Elements const& elements, entries_type & entries) const
+    {
+        auto const& strategy = index::detail::get_strategy(m_parameters);
+
+        std::vector<point_type> centroids;
+        centroids.reserve(elements.size());                                                         // MAY THROW (A)
+
+        box_type centroids_box;
+        for ( size_type i = 0 ; i < elements.size() ; ++i )
+        {
+            point_type pt;
+            geometry::centroid(rtree::element_indexable(elements[i], m_translator), pt, strategy);
+            if ( i == 0 )
+                detail::bounds(pt, centroids_box, strategy);
+            else
+                detail::expand(centroids_box, pt, strategy);
+            centroids.push_back(pt);
+        }
+
+        for ( size_type i = 0 ; i < elements.size() ; ++i )
+        {
+            std::uint64_t cell[dimension];
+            pack_utils::hilbert_cell<0, dimension>::apply(centroids[i], centroids_box, bits, cell);
+            entries.push_back(entry_type(pack_utils::hilbert_index<dimension>::apply(cell, bits), i));
+        }
+    }
+
+    box_type node_box(leaf const& n) const
+    {
+        return rtree::values_box<box_type>(rtree::elements(n).begin(), rtree::elements(n).end(),
+                                           m_translator, index::detail::get_strategy(m_parameters));
+    }
+
+    box_type node_box(internal_node const& n) const
+    {
+        return rtree::elements_box<box_type>(rtree::elements(n).begin(), rtree::elements(n).end(),
+                                             m_translator, index::detail::get_strategy(m_parameters));
+    }
+
+    static inline void release(value_type & , std::true_type /*is_value*/) {}
+
+    static inline void release(internal_element & el, std::false_type /*is_value*/)
+    {
+        el.second = 0;
+    }
+
+    template <typename Elements>
+    void destroy_remaining(Elements & , std::true_type /*is_value*/) {}
+
+    template <typename Elements>
+    void destroy_remaining(Elements & elements, std::false_type /*is_value*/)
+    {
+        for ( size_type i = 0 ; i < elements.size() ; ++i )
+        {
+            if ( elements[i].second )
+            {
+                visitors::destroy<MembersHolder>::apply(elements[i].second, m_allocators);
+                elements[i].second = 0;
+            }
+        }
+    }
+
+    node_pointer & m_root;
+    size_type & m_leafs_level;
+
+    parameters_type const& m_parameters;
+    translator_type const& m_translator;
+    allocators_type & m_allocators;
+
+    std::vector<size_type> m_counts;
+    entries_type m_sorted_entries;
+};
+
+}}}}} // namespace boost::geometry::index::detail::rtree
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_BULK_INSERT_HPP
@@ -0,0 +1,533 @@
+// Boost.Geometry Index
+//
+// R-tree bulk removal
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_BULK_REMOVE_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_BULK_REMOVE_HPP
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/index/detail/assert.hpp>
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/rtree/bulk_insert.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
+
+// Bulk removal
+//
+// The values are passed down the tree in groups, each child gets the values of the group
+// which weren't removed yet and are covered by its box, so each node is visited once.
+// In the leafs one stored value equal to each value of the group is removed. Nodes which
+// underflow are detached from their parents and after the traversal the elements of all of
+// them are inserted back with bulk_insert, level by level starting from the highest one.
+// Finally the tree is shortened if the root has only one child.
+//
+// The values may also be removed if they meet predicates. Then only the children which boxes
+// meet the predicates are traversed and all values meeting them are removed from the leafs.
+// The values may also be extracted. Then they're moved out of the leafs and the whole subtrees
+// which all values surely meet the predicates are detached without traversing them.
+
+template <typename MembersHolder>
+class bulk_remove
+{
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename allocators_type::node_pointer node_pointer;
+    typedef typename allocators_type::size_type size_type;
+
+    typedef typename rtree::elements_type<internal_node>::type internal_elements;
+    typedef typename internal_elements::value_type internal_element;
+    typedef typename rtree::elements_type<leaf>::type leaf_elements;
+
+    // the height of a node counted from the leafs level (1 for leafs) and the node
+    typedef std::vector<std::pair<size_type, node_pointer> > underflow_nodes;
+
+public:
+    inline bulk_remove(node_pointer & root,
+                       size_type & leafs_level,
+                       parameters_type const& parameters,
+                       translator_type const& translator,
+                       allocators_type & allocators)
+        : m_root(root)
+        , m_leafs_level(leafs_level)
+        , m_parameters(parameters)
+        , m_translator(translator)
+        , m_allocators(allocators)
+        , m_values(0)
+        , m_removed_count(0)
+    {}
+
+    // Removes one stored value equal to each of the values, returns the number of removed values
+    template <typename Values>
+    inline size_type apply(Values const& values)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_root, "The root must exist");
+
+        if ( values.empty() )
+            return 0;
+
+        m_values = &values[0];
+        m_removed.assign(values.size(), false);                                                     // MAY THROW (A)
+        m_group.reserve(values.size());                                                             // MAY THROW (A)
+        for ( size_type i = 0 ; i < values.size() ; ++i )
+            m_group.push_back(i);
+
+        return apply_removal([&]() {
+            remove_values(m_root, 0, 0, values.size());                                            // MAY THROW (V: copy, E: alloc)
+        });
+    }
+
+    // Removes all stored values meeting predicates, returns the number of removed values
+    template <typename Predicates, typename UnaryPredicate>
+    inline size_type apply_if(Predicates const& predicates, UnaryPredicate const& fun)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_root, "The root must exist");
+
+        no_extraction extraction;
+        return apply_removal([&]() {
+            remove_values_if(m_root, 0, predicates, fun, extraction);                              // MAY THROW (V: copy, E: alloc)
+        });
+    }
+
+    // Moves all stored values meeting predicates to values and the subtrees which all values
+    // meet them to subtrees, returns the number of extracted values
+    template <typename Predicates, typename Subtrees>
+    inline size_type apply_extract(Predicates const& predicates,
+                                   Subtrees & subtrees, std::vector<value_type> & values)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_root, "The root must exist");
+
+        extraction<Subtrees> extract_v(subtrees, values);
+        return apply_removal([&]() {
+            remove_values_if(m_root, 0, predicates, always(), extract_v);                          // MAY THROW (V: copy, E: alloc)
+        });
+    }
+
+private:
+    struct always
+    {
+        bool operator()(value_type const&) const { return true; }
+    };
+
+    // The removed values are destroyed
+    struct no_extraction
+    {
+        static const bool moves_subtrees = false;
+
+        void value(value_type &) {}
+        void subtree(size_type, node_pointer) {}
+    };
+
+    // The removed values and subtrees are moved to the containers
+    template <typename Subtrees>
+    struct extraction
+    {
+        static const bool moves_subtrees = true;
+
+        extraction(Subtrees & s, std::vector<value_type> & v)
+            : subtrees(s), values(v)
+        {}
+
+        void value(value_type & v)
+        {
+            values.push_back(std::move(v));                                                         // MAY THROW (V: copy, E: alloc)
+        }
+
+        void subtree(size_type height, node_pointer n)
+        {
+            subtrees.push_back(std::make_pair(height, n));                                          // MAY THROW (A)
+        }
+
+        Subtrees & subtrees;
+        std::vector<value_type> & values;
+    };
+
+    template <typename RemoveFunction>
+    inline size_type apply_removal(RemoveFunction const& remove_function)
+    {
+        BOOST_TRY
+        {
+            remove_function();                                                                      // MAY THROW (V: copy, E: alloc)
+
+            reinsert_underflowed_nodes_elements();                                                  // MAY THROW (V, E: alloc, copy, N: alloc)
+
+            shorten();
+        }
+        BOOST_CATCH(...)
+        {
+            for ( typename underflow_nodes::iterator it = m_underflowed_nodes.begin() ;
+                  it != m_underflowed_nodes.end() ; ++it )
+            {
+                if ( it->second )
+                    visitors::destroy<MembersHolder>::apply(it->second, m_allocators);
+            }
+            m_underflowed_nodes.clear();
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        return m_removed_count;
+    }
+
+    // The group of values is stored in m_group[first, last), returns true if a value was removed
+    bool remove_values(node_pointer n, size_type level, size_type first, size_type last)
+    {
+        auto const& strategy = index::detail::get_strategy(m_parameters);
+
+        if ( level == m_leafs_level )
+        {
+            leaf_elements & elements = rtree::elements(rtree::get<leaf>(*n));
+
+            bool modified = false;
+            for ( size_type i = first ; i < last && ! elements.empty() ; ++i )
+            {
+                size_type const v = m_group[i];
+                if ( m_removed[v] )
+                    continue;
+
+                for ( typename leaf_elements::iterator it = elements.begin() ; it != elements.end() ; ++it )
+                {
+                    if ( m_translator.equals(*it, m_values[v], strategy) )
+                    {
+                        rtree::move_from_back(elements, it);                                        // MAY THROW (V: copy)
+                        elements.pop_back();
+                        m_removed[v] = true;
+                        ++m_removed_count;
+                        modified = true;
+                        break;
+                    }
+                }
+            }
+            return modified;
+        }
+
+        internal_elements & children = rtree::elements(rtree::get<internal_node>(*n));
+
+        bool modified = false;
+        for ( size_type i = 0 ; i < children.size() ; )
+        {
+            // the group of the child is stored after the group of the node
+            size_type const child_first = m_group.size();
+            for ( size_type j = first ; j < last ; ++j )
+            {
+                size_type const v = m_group[j];
+                if ( ! m_removed[v]
+                  && index::detail::covered_by_bounds(m_translator(m_values[v]), children[i].first, strategy) )
+                {
+                    m_group.push_back(v);                                                           // MAY THROW (A)
+                }
+            }
+            size_type const child_last = m_group.size();
+
+            bool const child_modified = child_first < child_last
+                                     && remove_values(children[i].second, level + 1,
+                                                      child_first, child_last);                     // MAY THROW (V: copy, E: alloc)
+            m_group.resize(child_first);
+
+            if ( child_modified )
+            {
+                modified = true;
+
+                // the last child is moved to i-th position, it's checked in the next iteration
+                if ( detach_underflowed(children, i, level) )                                       // MAY THROW (A)
+                    continue;
+            }
+
+            ++i;
+        }
+        return modified;
+    }
+
+    // Removes the values meeting predicates, returns true if a value was removed
+    template <typename Predicates, typename UnaryPredicate, typename Extraction>
+    bool remove_values_if(node_pointer n, size_type level,
+                          Predicates const& predicates, UnaryPredicate const& fun,
+                          Extraction & extraction)
+    {
+        namespace id = index::detail;
+
+        auto const& strategy = index::detail::get_strategy(m_parameters);
+
+        if ( level == m_leafs_level )
+        {
+            leaf_elements & elements = rtree::elements(rtree::get<leaf>(*n));
+
+            bool modified = false;
+            for ( typename leaf_elements::iterator it = elements.begin() ; it != elements.end() ; )
+            {
+                // if value meets predicates
+                if ( id::predicates_check<id::value_tag>(predicates, *it, m_translator(*it), strategy)
+                  && fun(*it) )
+                {
+                    extraction.value(*it);                                                          // MAY THROW (V: copy, E: alloc)
+
+                    // the last value is moved to this position, it's checked in the next iteration
+                    rtree::move_from_back(elements, it);                                            // MAY THROW (V: copy)
+                    elements.pop_back();
+                    ++m_removed_count;
+                    modified = true;
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            return modified;
+        }
+
+        internal_elements & children = rtree::elements(rtree::get<internal_node>(*n));
+
+        bool modified = false;
+        for ( size_type i = 0 ; i < children.size() ; )
+        {
+            // if all values of the node meet predicates (0 is dummy value)
+            if ( Extraction::moves_subtrees
+              && id::predicates_check<id::full_bounds_tag>(predicates, 0, children[i].first, strategy) )
+            {
+                extraction.subtree(m_leafs_level - level, children[i].second);                      // MAY THROW (A)
+                m_removed_count += values_count(children[i].second, level + 1);
+                modified = true;
+
+                // the last child is moved to i-th position, it's checked in the next iteration
+                rtree::move_from_back(children, children.begin() + i);
+                children.pop_back();
+                continue;
+            }
+
+            // if node meets predicates (0 is dummy value)
+            if ( id::predicates_check<id::bounds_tag>(predicates, 0, children[i].first, strategy)
+              && remove_values_if(children[i].second, level + 1, predicates, fun, extraction) )     // MAY THROW (V: copy, E: alloc)
+            {
+                modified = true;
+
+                // the last child is moved to i-th position, it's checked in the next iteration
+                if ( detach_underflowed(children, i, level) )                                       // MAY THROW (A)
+                    continue;
+            }
+
+            ++i;
+        }
+        return modified;
+    }
+
+    // If the modified i-th child underflows it's detached and its elements are reinserted later,
+    // otherwise its box is adjusted, returns true if the child was detached
+    bool detach_underflowed(internal_elements & children, size_type i, size_type level)
+    {
+        if ( elements_count(children[i].second, level + 1) < m_parameters.get_min_elements() )
+        {
+            m_underflowed_nodes.push_back(std::make_pair(m_leafs_level - level,
+                                                         children[i].second));                      // MAY THROW (A)
+            rtree::move_from_back(children, children.begin() + i);
+            children.pop_back();
+            return true;
+        }
+
+        children[i].first = node_box(children[i].second, level + 1);
+        return false;
+    }
+
+    void reinsert_underflowed_nodes_elements()
+    {
+        // empty nodes are destroyed, internal nodes may be empty if all of their children
+        // were detached
+        for ( size_type i = 0 ; i < m_underflowed_nodes.size() ; )
+        {
+            std::pair<size_type, node_pointer> & p = m_underflowed_nodes[i];
+            if ( elements_count(p.second, m_leafs_level + 1 - p.first) == 0 )
+            {
+                visitors::destroy<MembersHolder>::apply(p.second, m_allocators);
+                p = m_underflowed_nodes.back();
+                m_underflowed_nodes.pop_back();
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        if ( m_underflowed_nodes.empty() )
+            return;
+
+        BOOST_GEOMETRY_INDEX_ASSERT(0 < m_leafs_level, "the root must be an internal node");
+
+        // all children of the root were detached, the highest node becomes the root
+        if ( rtree::elements(rtree::get<internal_node>(*m_root)).empty() )
+        {
+            typename underflow_nodes::iterator highest
+                = std::max_element(m_underflowed_nodes.begin(), m_underflowed_nodes.end(),
+                                   height_less());
+
+            rtree::destroy_node<allocators_type, internal_node>::apply(m_allocators, m_root);
+            m_root = highest->second;
+            m_leafs_level = highest->first - 1;
+            highest->second = 0;
+        }
+
+        // begin with levels closer to the root
+        std::sort(m_underflowed_nodes.begin(), m_underflowed_nodes.end(), height_greater());
+
+        bulk_insert<MembersHolder> insert_v(m_root, m_leafs_level, m_parameters, m_translator, m_allocators);
+
+        typename underflow_nodes::iterator first = m_underflowed_nodes.begin();
+        while ( first != m_underflowed_nodes.end() )
+        {
+            size_type const height = first->first;
+            typename underflow_nodes::iterator last = first;
+            for ( ; last != m_underflowed_nodes.end() && last->first == height ; ++last ) {}
+
+            if ( height == 1 )
+            {
+                std::vector<value_type> elements;
+                take_elements<leaf>(first, last, elements);                                        // MAY THROW (V: copy, E: alloc)
+                insert_v.apply(elements, 0);                                                        // MAY THROW (V, E: alloc, copy, N: alloc)
+            }
+            else
+            {
+                std::vector<internal_element> elements;
+                take_elements<internal_node>(first, last, elements);                               // MAY THROW (E: alloc)
+                insert_v.apply(elements, height - 1);                                               // MAY THROW (E: alloc, N: alloc)
+            }
+
+            first = last;
+        }
+
+        m_underflowed_nodes.clear();
+    }
+
+    // Moves the elements of the nodes to the container and destroys the nodes
+    template <typename Node, typename It, typename Elements>
+    void take_elements(It first, It last, Elements & elements)
+    {
+        size_type count = 0;
+        for ( It it = first ; it != last ; ++it )
+        {
+            if ( it->second )
+                count += rtree::elements(rtree::get<Node>(*it->second)).size();
+        }
+        elements.reserve(count);                                                                    // MAY THROW (A)
+
+        for ( It it = first ; it != last ; ++it )
+        {
+            if ( ! it->second )
+                continue;
+
+            typename rtree::elements_type<Node>::type & node_elements
+                = rtree::elements(rtree::get<Node>(*it->second));
+            for ( size_type i = 0 ; i < node_elements.size() ; ++i )
+                elements.push_back(std::move(node_elements[i]));                                    // MAY THROW (V: copy)
+            node_elements.clear();
+
+            rtree::destroy_node<allocators_type, Node>::apply(m_allocators, it->second);
+            it->second = 0;
+        }
+    }
+
+    void shorten()
+    {
+        while ( 0 < m_leafs_level )
+        {
+            internal_elements & children = rtree::elements(rtree::get<internal_node>(*m_root));
+            if ( 1 < children.size() )
+                break;
+
+            node_pointer root_to_destroy = m_root;
+            if ( children.empty() )
+            {
+                m_root = 0;
+                m_leafs_level = 0;
+            }
+            else
+            {
+                m_root = children[0].second;
+                --m_leafs_level;
+            }
+
+            rtree::destroy_node<allocators_type, internal_node>::apply(m_allocators, root_to_destroy);
+        }
+    }
+
+    size_type elements_count(node_pointer n, size_type level) const
+    {
+        return level == m_leafs_level
+             ? rtree::elements(rtree::get<leaf>(*n)).size()
+             : rtree::elements(rtree::get<internal_node>(*n)).size();
+    }
+
+    size_type values_count(node_pointer n, size_type level) const
+    {
+        if ( level == m_leafs_level )
+            return rtree::elements(rtree::get<leaf>(*n)).size();
+
+        internal_elements const& children = rtree::elements(rtree::get<internal_node>(*n));
+        size_type result = 0;
+        for ( size_type i = 0 ; i < children.size() ; ++i )
+            result += values_count(children[i].second, level + 1);
+        return result;
+    }
+
+    box_type node_box(node_pointer n, size_type level) const
+    {
+        auto const& strategy = index::detail::get_strategy(m_parameters);
+
+        if ( level == m_leafs_level )
+        {
+            leaf_elements const& elements = rtree::elements(rtree::get<leaf>(*n));
+            return rtree::values_box<box_type>(elements.begin(), elements.end(), m_translator, strategy);
+        }
+        else
+        {
+            internal_elements const& elements = rtree::elements(rtree::get<internal_node>(*n));
+            return rtree::elements_box<box_type>(elements.begin(), elements.end(), m_translator, strategy);
+        }
+    }
+
+    struct height_less
+    {
+        template <typename Pair>
+        bool operator()(Pair const& l, Pair const& r) const { return l.first < r.first; }
+    };
+
+    struct height_greater
+    {
+        template <typename Pair>
+        bool operator()(Pair const& l, Pair const& r) const { return l.first > r.first; }
+    };
+
+    node_pointer & m_root;
+    size_type & m_leafs_level;
+
+    parameters_type const& m_parameters;
+    translator_type const& m_translator;
+    allocators_type & m_allocators;
+
+    value_type const* m_values;
+    std::vector<bool> m_removed;
+    std::vector<size_type> m_group;
+    size_type m_removed_count;
+
+    underflow_nodes m_underflowed_nodes;
+};
+
+}}}}} // namespace boost::geometry::index::detail::rtree
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_BULK_REMOVE_HPP
@@ -0,0 +1,84 @@
+// Boost.Geometry Index
+//
+// R-tree persistent nodes building
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_CONCURRENT_BUILD_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_CONCURRENT_BUILD_HPP
+
+#include <boost/geometry/index/detail/rtree/concurrent/node.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace concurrent {
+
+// Copies the nodes of the rtree into the persistent nodes of the generation
+template <typename MembersHolder, typename Members>
+class build
+    : public MembersHolder::visitor_const
+{
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename Members::size_type size_type;
+    typedef typename Members::node_pointer node_pointer;
+
+public:
+    build(Members const& members, size_type generation)
+        : m_members(members)
+        , m_generation(generation)
+    {}
+
+    template <typename RtreeView>
+    void apply(RtreeView const& view, version<Members> & v)
+    {
+        view.apply_visitor(*this);                                                          // MAY THROW (A, V: copy)
+        v.root = m_result;
+        v.leafs_level = view.depth();
+    }
+
+    void operator()(internal_node const& n)
+    {
+        auto const& elements = rtree::elements(n);
+
+        std::shared_ptr<typename Members::internal_node> result
+            = m_members.template create_node<typename Members::internal_node>(m_generation); // MAY THROW (A)
+        result->elements.reserve(elements.size());                                          // MAY THROW (A)
+
+        for (auto const& p : elements)
+        {
+            rtree::apply_visitor(*this, *p.second);                                         // MAY THROW (A, V: copy)
+            result->elements.push_back(typename Members::internal_element(p.first, m_result));
+        }
+
+        m_result = result;
+    }
+
+    void operator()(leaf const& n)
+    {
+        auto const& elements = rtree::elements(n);
+
+        std::shared_ptr<typename Members::leaf> result
+            = m_members.template create_node<typename Members::leaf>(m_generation);         // MAY THROW (A)
+        result->elements.assign(elements.begin(), elements.end());                          // MAY THROW (A, V: copy)
+
+        m_result = result;
+    }
+
+private:
+    Members const& m_members;
+    size_type m_generation;
+    node_pointer m_result;
+};
+
+}}} // namespace detail::rtree::concurrent
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_CONCURRENT_BUILD_HPP
@@ -0,0 +1,433 @@
+// Boost.Geometry Index
+//
+// R-tree persistent insertion and removal with path copying
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_CONCURRENT_MODIFY_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_CONCURRENT_MODIFY_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/algorithms/centroid.hpp>
+
+#include <boost/geometry/index/detail/assert.hpp>
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/rtree/concurrent/node.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/rtree/options.hpp>
+#include <boost/geometry/index/detail/rtree/pack_hilbert.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/insert.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace concurrent {
+
+// Modifies the version which isn't published yet. The nodes on the path from the root to
+// the modified node are copied unless they were created by the same generation.
+//
+// Insertion chooses the child with the smallest content enlargement as in linear and
+// quadratic R-trees. Overflowing nodes are split in half in the order of the Hilbert index
+// of the centroids of their elements, as in bulk_insert.
+//
+// Removal searches the value read-only first so nothing is copied if the value isn't stored.
+// Underflowing nodes are detached from the path and their elements are inserted back at
+// their levels, then the tree is shortened if needed.
+//
+// If an exception is thrown the version may be left in an inconsistent state so it should be
+// discarded. The published versions are never modified.
+
+template <typename Members>
+class modify
+{
+    typedef typename Members::value_type value_type;
+    typedef typename Members::box_type box_type;
+    typedef typename Members::parameters_type parameters_type;
+    typedef typename Members::translator_type translator_type;
+    typedef typename Members::size_type size_type;
+
+    typedef typename Members::node node;
+    typedef typename Members::node_pointer node_pointer;
+    typedef typename Members::internal_node internal_node;
+    typedef typename Members::leaf leaf;
+    typedef typename Members::internal_element internal_element;
+
+    typedef concurrent::version<Members> version_type;
+
+    typedef typename geometry::point_type<box_type>::type point_type;
+    static const std::size_t dimension = geometry::dimension<point_type>::value;
+
+    // the Hilbert index and the index of an element
+    typedef std::pair<std::uint64_t, size_type> entry_type;
+
+    // the level of a node and the node
+    typedef std::vector<std::pair<size_type, node_pointer> > orphans_type;
+
+    static_assert(0 < dimension && dimension <= 64, "Unsupported dimension.");
+
+    // the same as in pack_hilbert
+    static const std::size_t bits = 64 / dimension < 16 ? 64 / dimension : 16;
+
+public:
+    modify(version_type & version, Members const& members, size_type generation)
+        : m_version(version)
+        , m_members(members)
+        , m_generation(generation)
+    {}
+
+    void insert(value_type const& value)
+    {
+        insert_element(value, 0);                                                           // MAY THROW (A, V: copy)
+        ++m_version.values_count;
+    }
+
+    // Removes one stored value equal to the value, returns true if the value was removed
+    bool remove(value_type const& value)
+    {
+        if (! m_version.root)
+        {
+            return false;
+        }
+
+        m_path.clear();
+        if (! find(*m_version.root, m_version.leafs_level,
+                   m_members.translator()(value), value))                                   // MAY THROW (A)
+        {
+            return false;
+        }
+
+        orphans_type orphans;
+        remove_on_path(m_version.root, m_version.leafs_level, 0, orphans);                 // MAY THROW (A, V: copy)
+        --m_version.values_count;
+
+        reinsert(orphans);                                                                  // MAY THROW (A, V: copy)
+
+        shorten();
+
+        return true;
+    }
+
+private:
+    // Inserts the value (level 0) or the subtree into the node of the level
+    template <typename Element>
+    void insert_element(Element const& el, size_type level)
+    {
+        if (! m_version.root)
+        {
+            BOOST_GEOMETRY_INDEX_ASSERT(level == 0, "only values can be inserted into an empty tree");
+            m_version.root = m_members.template create_node<leaf>(m_generation);            // MAY THROW (A)
+            m_version.leafs_level = 0;
+        }
+
+        box_type sibling_box;
+        node_pointer sibling;
+        insert_element(m_version.root, m_version.leafs_level, el, level,
+                       sibling_box, sibling);                                               // MAY THROW (A, V: copy)
+
+        // the root was split, the tree grows
+        if (sibling)
+        {
+            std::shared_ptr<internal_node> new_root
+                = m_members.template create_node<internal_node>(m_generation);              // MAY THROW (A)
+            new_root->elements.push_back(
+                internal_element(concurrent::node_box(*m_version.root, m_version.leafs_level, m_members),
+                                 m_version.root));                                          // MAY THROW (A)
+            new_root->elements.push_back(internal_element(sibling_box, sibling));            // MAY THROW (A)
+            m_version.root = new_root;
+            ++m_version.leafs_level;
+        }
+    }
+
+    // If the node is split the new sibling is returned in sibling
+    template <typename Element>
+    void insert_element(node_pointer & ptr, size_type node_level,
+                        Element const& el, size_type level,
+                        box_type & sibling_box, node_pointer & sibling)
+    {
+        typedef std::conditional_t
+            <
+                rtree::is_leaf_element<Element>::value, leaf, internal_node
+            > target_node;
+
+        if (node_level == level)
+        {
+            target_node & n = concurrent::writable_node<target_node>(ptr, m_members,
+                                                                     m_generation);         // MAY THROW (A, V: copy)
+            n.elements.push_back(el);                                                       // MAY THROW (A, V: copy)
+            if (m_members.parameters().get_max_elements() < n.elements.size())
+            {
+                split(n, sibling_box, sibling);                                             // MAY THROW (A, V: copy)
+            }
+            return;
+        }
+
+        BOOST_GEOMETRY_INDEX_ASSERT(level < node_level, "unexpected level");
+
+        internal_node & n = concurrent::writable_node<internal_node>(ptr, m_members,
+                                                                     m_generation);         // MAY THROW (A, V: copy)
+
+        auto const& indexable = rtree::element_indexable(el, m_members.translator());
+        size_type const i = rtree::choose_next_node
+            <
+                Members, choose_by_content_diff_tag
+            >::apply(n, indexable, m_members.parameters(), 0);
+
+        index::detail::expand(n.elements[i].first, indexable,
+                              index::detail::get_strategy(m_members.parameters()));
+
+        box_type child_sibling_box;
+        node_pointer child_sibling;
+        insert_element(n.elements[i].second, node_level - 1, el, level,
+                       child_sibling_box, child_sibling);                                   // MAY THROW (A, V: copy)
+
+        if (child_sibling)
+        {
+            n.elements[i].first = concurrent::node_box(*n.elements[i].second, node_level - 1, m_members);
+            n.elements.push_back(internal_element(child_sibling_box, child_sibling));       // MAY THROW (A)
+            if (m_members.parameters().get_max_elements() < n.elements.size())
+            {
+                split(n, sibling_box, sibling);                                             // MAY THROW (A)
+            }
+        }
+    }
+
+    template <typename Node>
+    void split(Node & n, box_type & sibling_box, node_pointer & sibling)
+    {
+        typedef typename Node::elements_type elements_type;
+
+        auto const& strategy = index::detail::get_strategy(m_members.parameters());
+        translator_type const& tr = m_members.translator();
+
+        std::vector<entry_type> entries;
+        calculate_hilbert_indexes(n.elements, entries);                                     // MAY THROW (A)
+        std::sort(entries.begin(), entries.end(), pack_utils::hilbert_entries_comparer());
+
+        std::shared_ptr<Node> new_node = m_members.template create_node<Node>(m_generation); // MAY THROW (A)
+
+        elements_type elements(n.elements.get_allocator());
+        elements.swap(n.elements);
+
+        size_type const count = entries.size();
+        size_type const half = count / 2;
+        n.elements.reserve(half);                                                           // MAY THROW (A)
+        new_node->elements.reserve(count - half);                                           // MAY THROW (A)
+        for (size_type j = 0 ; j < count ; ++j)
+        {
+            elements_type & dst = j < half ? n.elements : new_node->elements;
+            dst.push_back(std::move(elements[entries[j].second]));                          // MAY THROW (V: copy)
+        }
+
+        sibling_box = rtree::elements_box<box_type>(new_node->elements.begin(),
+                                                    new_node->elements.end(), tr, strategy);
+        sibling = new_node;
+    }
+
+    template <typename Elements>
+    void calculate_hilbert_indexes(Elements const& elements, std::vector<entry_type> & entries) const
+    {
+        auto const& strategy = index::detail::get_strategy(m_members.parameters());
+
+        std::vector<point_type> centroids;
+        centroids.reserve(elements.size());                                                 // MAY THROW (A)
+        entries.reserve(elements.size());                                                   // MAY THROW (A)
+
+        box_type centroids_box;
+        for (size_type i = 0 ; i < elements.size() ; ++i)
+        {
+            point_type pt;
+            geometry::centroid(rtree::element_indexable(elements[i], m_members.translator()),
+                               pt, strategy);
+            if (i == 0)
+            {
+                detail::bounds(pt, centroids_box, strategy);
+            }
+            else
+            {
+                detail::expand(centroids_box, pt, strategy);
+            }
+            centroids.push_back(pt);
+        }
+
+        for (size_type i = 0 ; i < elements.size() ; ++i)
+        {
+            std::uint64_t cell[dimension];
+            pack_utils::hilbert_cell<0, dimension>::apply(centroids[i], centroids_box, bits, cell);
+            entries.push_back(entry_type(pack_utils::hilbert_index<dimension>::apply(cell, bits), i));
+        }
+    }
+
+    // Stores the indexes of children on the path to the value and the index of the value
+    template <typename Indexable>
+    bool find(node const& n, size_type node_level, Indexable const& indexable, value_type const& value)
+    {
+        auto const& strategy = index::detail::get_strategy(m_members.parameters());
+
+        if (node_level == 0)
+        {
+            auto const& elements = concurrent::get<leaf>(n).elements;
+            for (size_type i = 0 ; i < elements.size() ; ++i)
+            {
+                if (m_members.translator().equals(elements[i], value, strategy))
+                {
+                    m_path.push_back(i);                                                    // MAY THROW (A)
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        auto const& elements = concurrent::get<internal_node>(n).elements;
+        for (size_type i = 0 ; i < elements.size() ; ++i)
+        {
+            if (index::detail::covered_by_bounds(indexable, elements[i].first, strategy))
+            {
+                m_path.push_back(i);                                                        // MAY THROW (A)
+                if (find(*elements[i].second, node_level - 1, indexable, value))
+                {
+                    return true;
+                }
+                m_path.pop_back();
+            }
+        }
+        return false;
+    }
+
+    void remove_on_path(node_pointer & ptr, size_type node_level, size_type depth,
+                        orphans_type & orphans)
+    {
+        size_type const i = m_path[depth];
+
+        if (node_level == 0)
+        {
+            leaf & n = concurrent::writable_node<leaf>(ptr, m_members, m_generation);        // MAY THROW (A, V: copy)
+            rtree::move_from_back(n.elements, n.elements.begin() + i);                      // MAY THROW (V: copy)
+            n.elements.pop_back();
+            return;
+        }
+
+        internal_node & n = concurrent::writable_node<internal_node>(ptr, m_members,
+                                                                     m_generation);         // MAY THROW (A)
+        remove_on_path(n.elements[i].second, node_level - 1, depth + 1, orphans);           // MAY THROW (A, V: copy)
+
+        // underflow occured - the child is detached and its elements are reinserted later
+        if (elements_count(*n.elements[i].second, node_level - 1)
+                < m_members.parameters().get_min_elements())
+        {
+            orphans.push_back(std::make_pair(node_level - 1, n.elements[i].second));        // MAY THROW (A)
+            rtree::move_from_back(n.elements, n.elements.begin() + i);
+            n.elements.pop_back();
+        }
+        else
+        {
+            n.elements[i].first = concurrent::node_box(*n.elements[i].second, node_level - 1, m_members);
+        }
+    }
+
+    void reinsert(orphans_type & orphans)
+    {
+        // empty nodes are dropped
+        orphans.erase(std::remove_if(orphans.begin(), orphans.end(), is_empty()),
+                      orphans.end());
+
+        if (orphans.empty())
+        {
+            return;
+        }
+
+        // all children of the root were detached, the highest node becomes the root
+        // the nodes are stored bottom-up so the highest one is the last one
+        if (0 < m_version.leafs_level
+            && concurrent::get<internal_node>(*m_version.root).elements.empty())
+        {
+            m_version.root = orphans.back().second;
+            m_version.leafs_level = orphans.back().first;
+            orphans.pop_back();
+        }
+
+        // begin with levels closer to the root
+        for (size_type i = orphans.size() ; 0 < i ; --i)
+        {
+            size_type const level = orphans[i - 1].first;
+            node const& n = *orphans[i - 1].second;
+            if (level == 0)
+            {
+                for (value_type const& v : concurrent::get<leaf>(n).elements)
+                {
+                    insert_element(v, 0);                                                   // MAY THROW (A, V: copy)
+                }
+            }
+            else
+            {
+                for (internal_element const& el : concurrent::get<internal_node>(n).elements)
+                {
+                    insert_element(el, level);                                              // MAY THROW (A)
+                }
+            }
+        }
+    }
+
+    void shorten()
+    {
+        while (0 < m_version.leafs_level)
+        {
+            auto const& children = concurrent::get<internal_node>(*m_version.root).elements;
+            if (1 < children.size())
+            {
+                return;
+            }
+
+            if (children.empty())
+            {
+                m_version.root.reset();
+                m_version.leafs_level = 0;
+                return;
+            }
+
+            node_pointer child = children[0].second;
+            m_version.root = child;
+            --m_version.leafs_level;
+        }
+
+        if (concurrent::get<leaf>(*m_version.root).elements.empty())
+        {
+            m_version.root.reset();
+        }
+    }
+
+    static size_type elements_count(node const& n, size_type node_level)
+    {
+        return node_level == 0
+             ? concurrent::get<leaf>(n).elements.size()
+             : concurrent::get<internal_node>(n).elements.size();
+    }
+
+    struct is_empty
+    {
+        template <typename Pair>
+        bool operator()(Pair const& p) const
+        {
+            return elements_count(*p.second, p.first) == 0;
+        }
+    };
+
+    version_type & m_version;
+    Members const& m_members;
+    size_type m_generation;
+
+    std::vector<size_type> m_path;
+};
+
+}}} // namespace detail::rtree::concurrent
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_CONCURRENT_MODIFY_HPP
@@ -0,0 +1,244 @@
+// Boost.Geometry Index
+//
+// R-tree persistent nodes shared between versions of the concurrent rtree
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_CONCURRENT_NODE_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_CONCURRENT_NODE_HPP
+
+#include <atomic>
+#include <memory>
+
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/vector.hpp>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/translator.hpp>
+#include <boost/geometry/index/parameters.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace concurrent {
+
+// The nodes are immutable once they're reachable from a published version so the versions
+// may share subtrees. The nodes are owned by shared pointers and are destroyed when the last
+// version referencing them is released.
+//
+// Each node stores the generation of the modification which created it. A writer may modify
+// the nodes of its own generation in place because they're not reachable from any published
+// version. Other nodes are copied first (path copying), see writable_node().
+//
+// Levels are counted from the leafs (reverse levels), 0 is the level of leafs.
+
+template <typename SizeType>
+struct node
+{
+    explicit node(SizeType g) : generation(g) {}
+
+    SizeType generation;
+};
+
+template <typename Elements, typename SizeType>
+struct elements_node
+    : public node<SizeType>
+{
+    typedef Elements elements_type;
+
+    template <typename Allocator>
+    elements_node(SizeType g, Allocator const& alloc)
+        : node<SizeType>(g), elements(alloc)
+    {}
+
+    elements_node(SizeType g, elements_node const& other)
+        : node<SizeType>(g), elements(other.elements)
+    {}
+
+    elements_type elements;
+};
+
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo,
+          typename Allocator, typename Box>
+struct members
+    : public detail::translator<IndexableGetter, EqualTo>
+    , public Parameters
+{
+    typedef Value value_type;
+    typedef Parameters parameters_type;
+    typedef Box box_type;
+    typedef detail::translator<IndexableGetter, EqualTo> translator_type;
+
+    typedef boost::container::allocator_traits<Allocator> allocator_traits_type;
+    typedef typename allocator_traits_type::template rebind_alloc<Value> value_allocator_type;
+    typedef boost::container::allocator_traits<value_allocator_type> value_allocator_traits;
+    typedef typename value_allocator_traits::size_type size_type;
+
+    typedef concurrent::node<size_type> node;
+    typedef std::shared_ptr<node> node_pointer;
+
+    typedef rtree::ptr_pair<Box, node_pointer> internal_element;
+    typedef elements_node
+        <
+            boost::container::vector
+                <
+                    internal_element,
+                    typename allocator_traits_type::template rebind_alloc<internal_element>
+                >,
+            size_type
+        > internal_node;
+    typedef elements_node
+        <
+            boost::container::vector<Value, value_allocator_type>,
+            size_type
+        > leaf;
+
+    members(IndexableGetter const& ind_get, EqualTo const& val_eq,
+            Parameters const& parameters, Allocator const& alloc)
+        : translator_type(ind_get, val_eq)
+        , Parameters(parameters)
+        , allocator(alloc)
+    {}
+
+    translator_type const& translator() const { return *this; }
+
+    IndexableGetter const& indexable_getter() const { return *this; }
+    EqualTo const& equal_to() const { return *this; }
+
+    Parameters const& parameters() const { return *this; }
+
+    Allocator get_allocator() const { return Allocator(allocator); }
+
+    template <typename Node>
+    std::shared_ptr<Node> create_node(size_type generation) const
+    {
+        typedef typename allocator_traits_type::template rebind_alloc<Node> node_allocator_type;
+        return std::allocate_shared<Node>(node_allocator_type(allocator),
+                                          generation, allocator);                           // MAY THROW (A)
+    }
+
+    template <typename Node>
+    std::shared_ptr<Node> copy_node(Node const& n, size_type generation) const
+    {
+        typedef typename allocator_traits_type::template rebind_alloc<Node> node_allocator_type;
+        return std::allocate_shared<Node>(node_allocator_type(allocator),
+                                          generation, n);                                   // MAY THROW (A, V: copy)
+    }
+
+    value_allocator_type allocator;
+};
+
+// The state of the tree, it's immutable once published
+template <typename Members>
+struct version
+{
+    typedef typename Members::node_pointer node_pointer;
+    typedef typename Members::size_type size_type;
+
+    version(std::shared_ptr<Members const> const& m)
+        : members(m), root(), leafs_level(0), values_count(0)
+    {}
+
+    std::shared_ptr<Members const> members;
+    node_pointer root;
+    size_type leafs_level;
+    size_type values_count;
+};
+
+template <typename Node, typename SizeType> inline
+Node const& get(node<SizeType> const& n)
+{
+    return static_cast<Node const&>(n);
+}
+
+template <typename Node, typename SizeType> inline
+Node & get(node<SizeType> & n)
+{
+    return static_cast<Node &>(n);
+}
+
+// Returns the node which may be modified by the writer of the generation, the node is copied
+// and the pointer replaced with the copy if needed
+template <typename Node, typename Members> inline
+Node & writable_node(typename Members::node_pointer & ptr, Members const& members,
+                     typename Members::size_type generation)
+{
+    if (ptr->generation != generation)
+    {
+        ptr = members.copy_node(concurrent::get<Node>(*ptr), generation);                   // MAY THROW (A, V: copy)
+    }
+    return concurrent::get<Node>(*ptr);
+}
+
+template <typename Members> inline
+typename Members::box_type node_box(typename Members::node const& n,
+                                    typename Members::size_type reverse_level,
+                                    Members const& members)
+{
+    typedef typename Members::box_type box_type;
+    typedef typename Members::internal_node internal_node;
+    typedef typename Members::leaf leaf;
+
+    auto const& strategy = index::detail::get_strategy(members.parameters());
+
+    if (reverse_level == 0)
+    {
+        auto const& elements = concurrent::get<leaf>(n).elements;
+        return rtree::values_box<box_type>(elements.begin(), elements.end(),
+                                           members.translator(), strategy);
+    }
+    else
+    {
+        auto const& elements = concurrent::get<internal_node>(n).elements;
+        return rtree::elements_box<box_type>(elements.begin(), elements.end(),
+                                             members.translator(), strategy);
+    }
+}
+
+// The pointer to the current version, loads and stores are atomic
+template <typename T>
+class atomic_shared_ptr
+{
+public:
+    atomic_shared_ptr() = default;
+    atomic_shared_ptr(atomic_shared_ptr const&) = delete;
+    atomic_shared_ptr & operator=(atomic_shared_ptr const&) = delete;
+
+#ifdef __cpp_lib_atomic_shared_ptr
+    std::shared_ptr<T> load() const
+    {
+        return m_ptr.load(std::memory_order_acquire);
+    }
+
+    void store(std::shared_ptr<T> ptr)
+    {
+        m_ptr.store(std::move(ptr), std::memory_order_release);
+    }
+
+private:
+    std::atomic<std::shared_ptr<T>> m_ptr;
+#else
+    std::shared_ptr<T> load() const
+    {
+        return std::atomic_load_explicit(&m_ptr, std::memory_order_acquire);
+    }
+
+    void store(std::shared_ptr<T> ptr)
+    {
+        std::atomic_store_explicit(&m_ptr, std::move(ptr), std::memory_order_release);
+    }
+
+private:
+    std::shared_ptr<T> m_ptr;
+#endif
+};
+
+}}} // namespace detail::rtree::concurrent
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_CONCURRENT_NODE_HPP
@@ -0,0 +1,233 @@
+// Boost.Geometry Index
+//
+// R-tree persistent nodes spatial and distance (knn) query implementation
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_CONCURRENT_QUERY_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_CONCURRENT_QUERY_HPP
+
+#include <algorithm>
+#include <memory>
+
+#include <boost/geometry/index/detail/distance_predicates.hpp>
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/rtree/concurrent/node.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/distance_query.hpp>
+#include <boost/geometry/index/detail/translator.hpp>
+#include <boost/geometry/index/parameters.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace concurrent {
+
+template <typename Members, typename Predicates, typename OutIter>
+class spatial_query
+{
+    typedef typename Members::parameters_type parameters_type;
+    typedef typename Members::translator_type translator_type;
+    typedef typename Members::size_type size_type;
+
+    typedef typename Members::node node;
+    typedef typename Members::internal_node internal_node;
+    typedef typename Members::leaf leaf;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+public:
+    spatial_query(Members const& members, Predicates const& p, OutIter out_it)
+        : m_tr(members.translator())
+        , m_strategy(index::detail::get_strategy(members.parameters()))
+        , m_pred(p)
+        , m_out_iter(out_it)
+        , m_found_count(0)
+    {}
+
+    size_type apply(version<Members> const& v)
+    {
+        apply(*v.root, v.leafs_level);
+        return m_found_count;
+    }
+
+private:
+    void apply(node const& n, size_type node_level)
+    {
+        namespace id = index::detail;
+
+        if (node_level == 0)
+        {
+            for (auto const& v : concurrent::get<leaf>(n).elements)
+            {
+                // if value meets predicates
+                if (id::predicates_check<id::value_tag>(m_pred, v, m_tr(v), m_strategy))
+                {
+                    *m_out_iter = v;
+                    ++m_out_iter;
+                    ++m_found_count;
+                }
+            }
+        }
+        else
+        {
+            for (auto const& p : concurrent::get<internal_node>(n).elements)
+            {
+                // if node meets predicates (0 is dummy value)
+                if (id::predicates_check<id::bounds_tag>(m_pred, 0, p.first, m_strategy))
+                {
+                    apply(*p.second, node_level - 1);
+                }
+            }
+        }
+    }
+
+    translator_type const& m_tr;
+    strategy_type m_strategy;
+
+    Predicates const& m_pred;
+    OutIter m_out_iter;
+
+    size_type m_found_count;
+};
+
+template <typename Members, typename Predicates>
+class distance_query
+{
+    typedef typename Members::value_type value_type;
+    typedef typename Members::box_type box_type;
+    typedef typename Members::parameters_type parameters_type;
+    typedef typename Members::translator_type translator_type;
+    typedef typename Members::size_type size_type;
+
+    typedef typename Members::node node;
+    typedef typename Members::internal_node internal_node;
+    typedef typename Members::leaf leaf;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    typedef index::detail::predicates_element
+        <
+            index::detail::predicates_find_distance<Predicates>::value, Predicates
+        > nearest_predicate_access;
+    typedef typename nearest_predicate_access::type nearest_predicate_type;
+    typedef typename indexable_type<translator_type>::type indexable_type;
+
+    typedef index::detail::calculate_distance<nearest_predicate_type, indexable_type, strategy_type, value_tag> calculate_value_distance;
+    typedef index::detail::calculate_distance<nearest_predicate_type, box_type, strategy_type, bounds_tag> calculate_node_distance;
+    typedef typename calculate_value_distance::result_type value_distance_type;
+    typedef typename calculate_node_distance::result_type node_distance_type;
+
+    struct branch_data
+    {
+        branch_data(node_distance_type d, size_type rl, node const* p)
+            : distance(d), reverse_level(rl), ptr(p)
+        {}
+
+        node_distance_type distance;
+        size_type reverse_level;
+        node const* ptr;
+    };
+    using branches_type = visitors::priority_queue<branch_data, visitors::branch_data_comp>;
+
+public:
+    distance_query(Members const& members, size_type values_count, Predicates const& pred)
+        : m_tr(members.translator())
+        , m_strategy(index::detail::get_strategy(members.parameters()))
+        , m_pred(pred)
+        , m_result((std::min)(values_count, size_type(max_count())))
+    {}
+
+    template <typename OutIter>
+    size_type apply(version<Members> const& v, OutIter out_it)
+    {
+        namespace id = index::detail;
+
+        if (max_count() <= 0)
+        {
+            return 0;
+        }
+
+        node const* ptr = v.root.get();
+        size_type reverse_level = v.leafs_level;
+
+        for (;;)
+        {
+            if (reverse_level > 0)
+            {
+                // fill array of nodes meeting predicates
+                for (auto const& p : concurrent::get<internal_node>(*ptr).elements)
+                {
+                    node_distance_type node_distance; // for distance predicate
+
+                    // if current node meets predicates (0 is dummy value)
+                    if (id::predicates_check<id::bounds_tag>(m_pred, 0, p.first, m_strategy)
+                        // and if distance is ok
+                        && calculate_node_distance::apply(predicate(), p.first, m_strategy, node_distance)
+                        // and if current node is closer than the furthest neighbor
+                        && ! m_result.ignore_branch(node_distance))
+                    {
+                        // add current node's data into the list
+                        m_branches.push(branch_data(node_distance, reverse_level - 1, p.second.get()));
+                    }
+                }
+            }
+            else
+            {
+                // search leaf for closest value meeting predicates
+                for (auto const& v : concurrent::get<leaf>(*ptr).elements)
+                {
+                    value_distance_type value_distance; // for distance predicate
+
+                    // if value meets predicates
+                    if (id::predicates_check<id::value_tag>(m_pred, v, m_tr(v), m_strategy)
+                        // and if distance is ok
+                        && calculate_value_distance::apply(predicate(), m_tr(v), m_strategy, value_distance))
+                    {
+                        // store value
+                        m_result.store(value_distance, std::addressof(v));
+                    }
+                }
+            }
+
+            if (m_branches.empty()
+                || m_result.ignore_branch(m_branches.top().distance))
+            {
+                break;
+            }
+
+            ptr = m_branches.top().ptr;
+            reverse_level = m_branches.top().reverse_level;
+            m_branches.pop();
+        }
+
+        return m_result.finish(out_it);
+    }
+
+private:
+    std::size_t max_count() const
+    {
+        return nearest_predicate_access::get(m_pred).count;
+    }
+
+    nearest_predicate_type const& predicate() const
+    {
+        return nearest_predicate_access::get(m_pred);
+    }
+
+    translator_type const& m_tr;
+    strategy_type m_strategy;
+
+    Predicates const& m_pred;
+
+    branches_type m_branches;
+    visitors::distance_query_result<value_distance_type, value_type> m_result;
+};
+
+}}} // namespace detail::rtree::concurrent
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_CONCURRENT_QUERY_HPP
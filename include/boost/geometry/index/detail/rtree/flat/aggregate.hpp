@@ -0,0 +1,237 @@
+// Boost.Geometry Index
+//
+// R-tree flat representation count and aggregate queries implementation
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_AGGREGATE_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_AGGREGATE_HPP
+
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/index/detail/assert.hpp>
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/parameters.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace flat {
+
+// The children of consecutive entries are stored consecutively so the values of the subtree
+// of an entry are stored in a contiguous range. It's found by following the first and the
+// last children down to the values.
+template <typename Members>
+inline std::pair<typename Members::size_type, typename Members::size_type>
+    subtree_values(Members const& members, typename Members::size_type i)
+{
+    typename Members::size_type first = i;
+    typename Members::size_type last = i + 1;
+    while (! members.is_value(first))
+    {
+        first = members.first[first];
+        last = members.first[last];
+    }
+    return std::make_pair(first, last);
+}
+
+// The aggregates of the values of subtrees of all entries
+template <typename T, typename Transform, typename Reduce>
+struct aggregates
+{
+    aggregates(T const& i, Transform const& t, Reduce const& r)
+        : init(i), transform(t), reduce(r)
+    {}
+
+    template <typename Members>
+    void build(Members const& members)
+    {
+        typedef typename Members::size_type size_type;
+
+        entries.assign(members.entries_count, init);                                        // MAY THROW (A, T: copy)
+
+        // the children are stored after the parents
+        for (size_type i = members.entries_count ; i > 0 ; --i)
+        {
+            entries[i - 1] = apply(members, members.first[i - 1], members.first[i]);        // MAY THROW (T)
+        }
+    }
+
+    template <typename Members>
+    T apply(Members const& members,
+            typename Members::size_type first, typename Members::size_type last) const
+    {
+        T result = init;
+        for (typename Members::size_type i = first ; i < last ; ++i)
+        {
+            result = members.is_value(i)
+                   ? reduce(result, transform(members.value(i)))
+                   : reduce(result, entries[i]);
+        }
+        return result;
+    }
+
+    T init;
+    Transform transform;
+    Reduce reduce;
+
+    std::vector<T> entries;
+};
+
+// Counts the values meeting predicates, the values of the nodes fully meeting predicates
+// are counted without traversing them
+template <typename Members, typename Predicates>
+struct count_query
+{
+    typedef typename Members::parameters_type parameters_type;
+    typedef typename Members::translator_type translator_type;
+    typedef typename Members::size_type size_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    count_query(Members const& members, Predicates const& p)
+        : m_members(members)
+        , m_strategy(index::detail::get_strategy(members.parameters()))
+        , m_pred(p)
+    {}
+
+    size_type apply() const
+    {
+        return apply(0, m_members.root_count);
+    }
+
+private:
+    // [first, last) are global indexes of children of a node
+    size_type apply(size_type first, size_type last) const
+    {
+        namespace id = index::detail;
+
+        size_type result = 0;
+        if (m_members.is_value(first))
+        {
+            translator_type const& tr = m_members.translator();
+            for (size_type i = first ; i < last ; ++i)
+            {
+                auto const& v = m_members.value(i);
+                // if value meets predicates
+                if (id::predicates_check<id::value_tag>(m_pred, v, tr(v), m_strategy))
+                {
+                    ++result;
+                }
+            }
+        }
+        else
+        {
+            for (size_type i = first ; i < last ; ++i)
+            {
+                auto const b = m_members.box(i);
+                // if node meets predicates (0 is dummy value)
+                if (id::predicates_check<id::bounds_tag>(m_pred, 0, b, m_strategy))
+                {
+                    // if all values of the node meet predicates
+                    if (id::predicates_check<id::full_bounds_tag>(m_pred, 0, b, m_strategy))
+                    {
+                        auto const values = subtree_values(m_members, i);
+                        result += values.second - values.first;
+                    }
+                    else
+                    {
+                        result += apply(m_members.first[i], m_members.first[i + 1]);
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    Members const& m_members;
+    strategy_type m_strategy;
+
+    Predicates const& m_pred;
+};
+
+// Reduces the values meeting predicates, the aggregates of the nodes fully meeting predicates
+// are used without traversing them
+template <typename Members, typename Predicates, typename Aggregates>
+struct aggregate_query
+{
+    typedef typename Members::parameters_type parameters_type;
+    typedef typename Members::translator_type translator_type;
+    typedef typename Members::size_type size_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    aggregate_query(Members const& members, Predicates const& p, Aggregates const& a)
+        : m_members(members)
+        , m_strategy(index::detail::get_strategy(members.parameters()))
+        , m_pred(p)
+        , m_aggregates(a)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(a.entries.size() == members.entries_count,
+                                    "aggregates of different tree");
+    }
+
+    template <typename T>
+    void apply(T & result) const
+    {
+        apply(0, m_members.root_count, result);
+    }
+
+private:
+    // [first, last) are global indexes of children of a node
+    template <typename T>
+    void apply(size_type first, size_type last, T & result) const
+    {
+        namespace id = index::detail;
+
+        if (m_members.is_value(first))
+        {
+            translator_type const& tr = m_members.translator();
+            for (size_type i = first ; i < last ; ++i)
+            {
+                auto const& v = m_members.value(i);
+                // if value meets predicates
+                if (id::predicates_check<id::value_tag>(m_pred, v, tr(v), m_strategy))
+                {
+                    result = m_aggregates.reduce(result, m_aggregates.transform(v));
+                }
+            }
+        }
+        else
+        {
+            for (size_type i = first ; i < last ; ++i)
+            {
+                auto const b = m_members.box(i);
+                // if node meets predicates (0 is dummy value)
+                if (id::predicates_check<id::bounds_tag>(m_pred, 0, b, m_strategy))
+                {
+                    // if all values of the node meet predicates
+                    if (id::predicates_check<id::full_bounds_tag>(m_pred, 0, b, m_strategy))
+                    {
+                        result = m_aggregates.reduce(result, m_aggregates.entries[i]);
+                    }
+                    else
+                    {
+                        apply(m_members.first[i], m_members.first[i + 1], result);
+                    }
+                }
+            }
+        }
+    }
+
+    Members const& m_members;
+    strategy_type m_strategy;
+
+    Predicates const& m_pred;
+    Aggregates const& m_aggregates;
+};
+
+}}} // namespace detail::rtree::flat
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_AGGREGATE_HPP
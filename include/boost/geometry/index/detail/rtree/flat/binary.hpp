@@ -0,0 +1,305 @@
+// Boost.Geometry Index
+//
+// R-tree flat representation binary format
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_BINARY_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_BINARY_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <ostream>
+#include <type_traits>
+
+#include <boost/geometry/index/detail/exception.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace flat {
+
+// The binary format is the flat representation written as it is stored in memory so it can
+// be mapped and queried in place. There are no pointers, only offsets and indexes.
+//
+// binary_header
+// padding
+// indexes      - entries_count + 1 indexes if entries_count > 0, otherwise none
+// padding
+// coordinates  - 2 * dimension * entries_count coordinates
+// padding
+// values       - values_count values
+//
+// Offsets are relative to the beginning of the header and aligned to binary_alignment.
+// The types of indexes, coordinates and values are checked only by size so the data has
+// to be read with the same types and on a platform with the same byte order.
+
+static const std::size_t binary_alignment = 64;
+static const std::uint32_t binary_version = 1;
+static const std::uint32_t binary_byte_order = 0x01020304;
+
+struct binary_header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t dimension;
+    std::uint32_t coordinate_size;
+    std::uint32_t index_size;
+    std::uint32_t value_size;
+    std::uint64_t values_count;
+    std::uint64_t entries_count;
+    std::uint64_t root_count;
+    std::uint64_t indexes_offset;
+    std::uint64_t coordinates_offset;
+    std::uint64_t values_offset;
+    std::uint64_t size;
+};
+
+inline const char * binary_magic()
+{
+    return "BGIFLAT";
+}
+
+inline std::uint64_t binary_align(std::uint64_t offset)
+{
+    return (offset + binary_alignment - 1) / binary_alignment * binary_alignment;
+}
+
+template <typename Value>
+struct is_binary_value
+{
+    static const bool value = std::is_trivially_copy_constructible<Value>::value
+                           && std::is_trivially_destructible<Value>::value;
+};
+
+template <typename Members>
+inline binary_header make_binary_header(Members const& members)
+{
+    typedef typename Members::size_type size_type;
+    typedef typename Members::coordinate_type coordinate_type;
+    typedef typename Members::value_type value_type;
+
+    binary_header header;
+    std::memset(&header, 0, sizeof(binary_header));
+    std::memcpy(header.magic, binary_magic(), sizeof(header.magic));
+    header.version = binary_version;
+    header.byte_order = binary_byte_order;
+    header.dimension = Members::dimension;
+    header.coordinate_size = sizeof(coordinate_type);
+    header.index_size = sizeof(size_type);
+    header.value_size = sizeof(value_type);
+    header.values_count = members.values.size();
+    header.entries_count = members.entries_count;
+    header.root_count = members.root_count;
+
+    std::uint64_t const indexes_count = members.entries_count > 0 ? members.entries_count + 1 : 0;
+    header.indexes_offset = binary_align(sizeof(binary_header));
+    header.coordinates_offset = binary_align(header.indexes_offset
+                                             + indexes_count * sizeof(size_type));
+    header.values_offset = binary_align(header.coordinates_offset
+                                        + 2 * Members::dimension * members.entries_count
+                                            * sizeof(coordinate_type));
+    header.size = header.values_offset + members.values.size() * sizeof(value_type);
+    return header;
+}
+
+inline void write_binary_padding(std::ostream & os, std::uint64_t & offset, std::uint64_t next)
+{
+    static const char zeros[binary_alignment] = {};
+    os.write(zeros, static_cast<std::streamsize>(next - offset));
+    offset = next;
+}
+
+template <typename T>
+inline void write_binary_array(std::ostream & os, std::uint64_t & offset, T const* data, std::uint64_t count)
+{
+    if (count > 0)
+    {
+        os.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(count * sizeof(T)));
+        offset += count * sizeof(T);
+    }
+}
+
+template <typename T>
+struct is_binary_without_padding
+#ifdef __cpp_lib_has_unique_object_representations
+    : std::has_unique_object_representations<T>
+#else
+    : std::false_type
+#endif
+{};
+
+// The values may contain padding bytes. In order to write the same data for the same values
+// they are assigned to objects created in a zeroed buffer unless the type has no padding.
+// The padding stays zeroed if the assignment copies the members one by one, like in
+// std::pair, otherwise the padding is copied with the value.
+template <typename T>
+inline void write_binary_values(std::ostream & os, std::uint64_t & offset, T const* data, std::uint64_t count,
+                                std::true_type /*no padding*/)
+{
+    write_binary_array(os, offset, data, count);
+}
+
+template <typename T>
+inline void copy_binary_value(void * ptr, T const& value, std::true_type /*assignable*/)
+{
+    *(::new (ptr) T) = value;
+}
+
+template <typename T>
+inline void copy_binary_value(void * ptr, T const& value, std::false_type /*assignable*/)
+{
+    ::new (ptr) T(value);
+}
+
+template <typename T>
+inline void write_binary_values(std::ostream & os, std::uint64_t & offset, T const* data, std::uint64_t count,
+                                std::false_type /*no padding*/)
+{
+    typedef std::integral_constant
+        <
+            bool, std::is_default_constructible<T>::value && std::is_copy_assignable<T>::value
+        > assignable;
+
+    static const std::uint64_t buffer_count = 64;
+    alignas(T) unsigned char buffer[buffer_count * sizeof(T)];
+    while (count > 0)
+    {
+        std::uint64_t const n = (std::min)(count, buffer_count);
+        std::memset(buffer, 0, sizeof(buffer));
+        for (std::uint64_t i = 0; i < n; ++i)
+        {
+            copy_binary_value(buffer + i * sizeof(T), data[i], assignable());
+        }
+        write_binary_array(os, offset, reinterpret_cast<T const*>(buffer), n);
+        data += n;
+        count -= n;
+    }
+}
+
+template <typename Members>
+inline void write_binary(std::ostream & os, Members const& members)
+{
+    binary_header const header = make_binary_header(members);
+    std::uint64_t offset = 0;
+
+    write_binary_array(os, offset, &header, 1);
+    write_binary_padding(os, offset, header.indexes_offset);
+    write_binary_array(os, offset, members.first.data(), members.first.size());
+    write_binary_padding(os, offset, header.coordinates_offset);
+    write_binary_array(os, offset, members.coordinates.data(), members.coordinates.size());
+    write_binary_padding(os, offset, header.values_offset);
+    write_binary_values(os, offset, members.values.data(), members.values.size(),
+                        is_binary_without_padding<typename Members::value_type>());
+}
+
+// True if count elements of element_size bytes starting at offset fit in size bytes
+inline bool binary_fits(std::uint64_t offset, std::uint64_t count, std::uint64_t element_size,
+                        std::uint64_t size)
+{
+    return offset <= size && count <= (size - offset) / element_size;
+}
+
+// Checks the indexes of the first children of entries. The children of the root are stored
+// at the beginning so the children of the first entry start at root_count. Every entry has
+// at least one child and the children of entries are stored after them so there are no
+// cycles. The children of an entry are either entries or values and the last index is the
+// end of values.
+template <typename SizeType>
+inline bool check_binary_indexes(SizeType const* first, std::uint64_t entries_count,
+                                 std::uint64_t values_count, std::uint64_t root_count)
+{
+    if (entries_count == 0)
+    {
+        return true;
+    }
+
+    if (first[0] != root_count)
+    {
+        return false;
+    }
+
+    for (std::uint64_t i = 0; i < entries_count; ++i)
+    {
+        if (first[i] >= first[i + 1]
+            || (first[i] < entries_count && first[i + 1] > entries_count))
+        {
+            return false;
+        }
+    }
+
+    return first[entries_count] == entries_count + values_count;
+}
+
+// Checks the header and the layout of the data, throws std::invalid_argument if the data
+// can't be used as the flat representation with the Members types.
+template <typename Members>
+inline binary_header const& check_binary(void const* data, std::size_t size)
+{
+    typedef typename Members::size_type size_type;
+    typedef typename Members::coordinate_type coordinate_type;
+    typedef typename Members::value_type value_type;
+
+    std::uintptr_t const address = reinterpret_cast<std::uintptr_t>(data);
+    if (data == nullptr || size < sizeof(binary_header) || address % binary_alignment != 0)
+    {
+        index::detail::throw_invalid_argument("flat rtree data is too small or not aligned");
+    }
+
+    binary_header const& header = *static_cast<binary_header const*>(data);
+    if (std::memcmp(header.magic, binary_magic(), sizeof(header.magic)) != 0)
+    {
+        index::detail::throw_invalid_argument("not a flat rtree data");
+    }
+
+    if (header.version != binary_version || header.byte_order != binary_byte_order)
+    {
+        index::detail::throw_invalid_argument("unsupported flat rtree data version or byte order");
+    }
+
+    if (header.dimension != Members::dimension
+        || header.coordinate_size != sizeof(coordinate_type)
+        || header.index_size != sizeof(size_type)
+        || header.value_size != sizeof(value_type))
+    {
+        index::detail::throw_invalid_argument("flat rtree data types mismatch");
+    }
+
+    // The sizes are checked with divisions so the numbers read from the header can't overflow
+    if (header.size > size
+        || header.indexes_offset % binary_alignment != 0
+        || header.coordinates_offset % binary_alignment != 0
+        || header.values_offset % binary_alignment != 0
+        || header.indexes_offset < sizeof(binary_header)
+        || header.entries_count >= header.size / sizeof(size_type)
+        || ! binary_fits(header.indexes_offset,
+                         header.entries_count > 0 ? header.entries_count + 1 : 0,
+                         sizeof(size_type), header.coordinates_offset)
+        || ! binary_fits(header.coordinates_offset, header.entries_count,
+                         2 * Members::dimension * sizeof(coordinate_type), header.values_offset)
+        || ! binary_fits(header.values_offset, header.values_count,
+                         sizeof(value_type), header.size)
+        || (header.entries_count == 0 ? header.root_count != header.values_count
+                                      : (header.root_count == 0
+                                         || header.root_count > header.entries_count))
+        || ! check_binary_indexes(reinterpret_cast<size_type const*>(
+                                      static_cast<char const*>(data) + header.indexes_offset),
+                                  header.entries_count, header.values_count, header.root_count))
+    {
+        index::detail::throw_invalid_argument("corrupted flat rtree data");
+    }
+
+    return header;
+}
+
+}}} // namespace detail::rtree::flat
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_BINARY_HPP
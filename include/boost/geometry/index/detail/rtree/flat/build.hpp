@@ -0,0 +1,123 @@
+// Boost.Geometry Index
+//
+// R-tree flat representation building
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_BUILD_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_BUILD_HPP
+
+#include <vector>
+
+#include <boost/geometry/index/detail/rtree/flat/members.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace flat {
+
+// Visits the nodes of the rtree in breadth-first order and stores them in the flat
+// representation. Since all leafs are on the same level, all internal nodes are visited
+// before the first leaf so the final number of entries is known at this point.
+template <typename MembersHolder, typename FlatMembers>
+class build
+    : public MembersHolder::visitor_const
+{
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename rtree::elements_type<internal_node>::type::value_type internal_element;
+
+    typedef typename FlatMembers::size_type size_type;
+
+public:
+    explicit build(FlatMembers & flat)
+        : m_flat(flat)
+        , m_is_root(true)
+    {}
+
+    template <typename RtreeView>
+    void apply(RtreeView const& view, size_type values_count)
+    {
+        m_flat.clear();
+        m_flat.values.reserve(values_count);                                                // MAY THROW (A)
+
+        m_is_root = true;
+        view.apply_visitor(*this);                                                          // MAY THROW (A, V: copy)
+        m_is_root = false;
+
+        for (size_type i = 0 ; i < m_entries.size() ; ++i)
+        {
+            rtree::apply_visitor(*this, *m_entries[i]->second);                             // MAY THROW (A, V: copy)
+        }
+
+        size_type const entries_count = m_entries.size();
+        m_flat.entries_count = entries_count;
+
+        if (0 < entries_count)
+        {
+            m_flat.first.push_back(entries_count + m_flat.values.size());                   // MAY THROW (A)
+
+            m_flat.coordinates.resize(2 * FlatMembers::dimension * entries_count);           // MAY THROW (A)
+            for (size_type i = 0 ; i < entries_count ; ++i)
+            {
+                store_box<0, FlatMembers::dimension>::apply(m_entries[i]->first,
+                                                            m_flat.coordinates.data(),
+                                                            entries_count, i);
+            }
+        }
+    }
+
+    void operator()(internal_node const& n)
+    {
+        auto const& elements = rtree::elements(n);
+
+        if (m_is_root)
+        {
+            m_flat.root_count = elements.size();
+        }
+        else
+        {
+            m_flat.first.push_back(m_entries.size());                                       // MAY THROW (A)
+        }
+
+        for (auto const& p : elements)
+        {
+            m_entries.push_back(&p);                                                        // MAY THROW (A)
+        }
+    }
+
+    void operator()(leaf const& n)
+    {
+        auto const& elements = rtree::elements(n);
+
+        if (m_is_root)
+        {
+            m_flat.root_count = elements.size();
+        }
+        else
+        {
+            m_flat.first.push_back(m_entries.size() + m_flat.values.size());                // MAY THROW (A)
+        }
+
+        for (auto const& v : elements)
+        {
+            m_flat.values.push_back(v);                                                     // MAY THROW (A, V: copy)
+        }
+    }
+
+private:
+    FlatMembers & m_flat;
+    std::vector<internal_element const*> m_entries;
+    bool m_is_root;
+};
+
+}}} // namespace detail::rtree::flat
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_BUILD_HPP
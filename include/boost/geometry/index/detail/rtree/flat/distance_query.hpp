@@ -0,0 +1,478 @@
+// Boost.Geometry Index
+//
+// R-tree flat representation distance (knn, path, etc. ) query implementation
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_DISTANCE_QUERY_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_DISTANCE_QUERY_HPP
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
+#include <boost/geometry/index/detail/assert.hpp>
+#include <boost/geometry/index/detail/distance_predicates.hpp>
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/rtree/flat/scan.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/distance_query.hpp>
+#include <boost/geometry/index/detail/translator.hpp>
+#include <boost/geometry/index/parameters.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace flat {
+
+// Prefer entries stored later, closer to the leafs, if distances are equal
+struct branch_data_comp
+{
+    template <typename BranchData>
+    bool operator()(BranchData const& b1, BranchData const& b2) const
+    {
+        return b1.distance > b2.distance || (b1.distance == b2.distance && b1.index < b2.index);
+    }
+};
+
+template <typename Members, typename Predicates>
+class distance_query
+{
+    typedef typename Members::value_type value_type;
+    typedef typename Members::box_type box_type;
+    typedef typename Members::parameters_type parameters_type;
+    typedef typename Members::translator_type translator_type;
+    typedef typename Members::size_type size_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    typedef index::detail::predicates_element
+        <
+            index::detail::predicates_find_distance<Predicates>::value, Predicates
+        > nearest_predicate_access;
+    typedef typename nearest_predicate_access::type nearest_predicate_type;
+    typedef typename indexable_type<translator_type>::type indexable_type;
+
+    typedef index::detail::calculate_distance<nearest_predicate_type, indexable_type, strategy_type, value_tag> calculate_value_distance;
+    typedef index::detail::calculate_distance<nearest_predicate_type, box_type, strategy_type, bounds_tag> calculate_node_distance;
+    typedef typename calculate_value_distance::result_type value_distance_type;
+    typedef typename calculate_node_distance::result_type node_distance_type;
+
+    typedef scan_distance<Predicates, box_type, strategy_type, node_distance_type> scan_type;
+    // the quantized boxes are not scanned
+    static const bool scan_enabled = scan_type::enabled && Members::has_coordinates;
+
+    struct branch_data
+    {
+        branch_data(node_distance_type d, size_type i)
+            : distance(d), index(i)
+        {}
+
+        node_distance_type distance;
+        size_type index;
+    };
+    using branches_type = visitors::priority_queue<branch_data, branch_data_comp>;
+
+public:
+    distance_query(Members const& members, Predicates const& pred)
+        : m_members(members)
+        , m_strategy(index::detail::get_strategy(members.parameters()))
+        , m_pred(pred)
+        , m_scan(pred)
+        , m_result((std::min)(members.values.size(), size_type(max_count())))
+    {}
+
+    template <typename OutIter>
+    size_type apply(OutIter out_it)
+    {
+        if (max_count() <= 0)
+        {
+            return 0;
+        }
+
+        size_type first = 0;
+        size_type last = m_members.root_count;
+
+        for (;;)
+        {
+            apply(first, last);
+
+            if (m_branches.empty()
+                || m_result.ignore_branch(m_branches.top().distance))
+            {
+                break;
+            }
+
+            size_type const i = m_branches.top().index;
+            m_branches.pop();
+
+            first = m_members.first[i];
+            last = m_members.first[i + 1];
+        }
+
+        return m_result.finish(out_it);
+    }
+
+private:
+    // [first, last) are global indexes of children of a node
+    void apply(size_type first, size_type last)
+    {
+        namespace id = index::detail;
+
+        if (m_members.is_value(first))
+        {
+            translator_type const& tr = m_members.translator();
+            // search leaf for closest value meeting predicates
+            for (size_type i = first ; i < last ; ++i)
+            {
+                value_type const& v = m_members.value(i);
+                value_distance_type value_distance; // for distance predicate
+
+                // if value meets predicates
+                if (id::predicates_check<id::value_tag>(m_pred, v, tr(v), m_strategy)
+                    // and if distance is ok
+                    && calculate_value_distance::apply(predicate(), tr(v), m_strategy, value_distance))
+                {
+                    // store value
+                    m_result.store(value_distance, std::addressof(v));
+                }
+            }
+        }
+        else
+        {
+            apply_nodes(first, last, std::integral_constant<bool, scan_enabled>());
+        }
+    }
+
+    void apply_nodes(size_type first, size_type last, std::false_type /*scan*/)
+    {
+        namespace id = index::detail;
+
+        // fill array of nodes meeting predicates
+        for (size_type i = first ; i < last ; ++i)
+        {
+            box_type const box = m_members.box(i);
+            node_distance_type node_distance; // for distance predicate
+
+            // if current node meets predicates (0 is dummy value)
+            if (id::predicates_check<id::bounds_tag>(m_pred, 0, box, m_strategy)
+                // and if distance is ok
+                && calculate_node_distance::apply(predicate(), box, m_strategy, node_distance)
+                // and if current node is closer than the furthest neighbor
+                && ! m_result.ignore_branch(node_distance))
+            {
+                // add current node's data into the list
+                m_branches.push(branch_data(node_distance, i));
+            }
+        }
+    }
+
+    void apply_nodes(size_type first, size_type last, std::true_type /*scan*/)
+    {
+        // only the distance predicate is passed so calculate all distances at once
+        node_distance_type distances[scan_chunk_size];
+        for (size_type chunk = first ; chunk < last ; chunk += scan_chunk_size)
+        {
+            size_type const n = (std::min)(size_type(scan_chunk_size), last - chunk);
+            m_scan.apply(m_members, chunk, n, distances);
+            for (size_type j = 0 ; j < n ; ++j)
+            {
+                // if current node is closer than the furthest neighbor
+                if (! m_result.ignore_branch(distances[j]))
+                {
+                    m_branches.push(branch_data(distances[j], chunk + j));
+                }
+            }
+        }
+    }
+
+    std::size_t max_count() const
+    {
+        return nearest_predicate_access::get(m_pred).count;
+    }
+
+    nearest_predicate_type const& predicate() const
+    {
+        return nearest_predicate_access::get(m_pred);
+    }
+
+    Members const& m_members;
+    strategy_type m_strategy;
+
+    Predicates const& m_pred;
+    scan_type m_scan;
+
+    branches_type m_branches;
+    visitors::distance_query_result<value_distance_type, value_type> m_result;
+};
+
+template <typename Members, typename Predicates>
+class distance_query_incremental
+{
+    typedef typename Members::value_type value_type;
+    typedef typename Members::box_type box_type;
+    typedef typename Members::parameters_type parameters_type;
+    typedef typename Members::translator_type translator_type;
+    typedef typename Members::allocators_type allocators_type;
+    typedef typename Members::size_type size_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    typedef index::detail::predicates_element
+        <
+            index::detail::predicates_find_distance<Predicates>::value, Predicates
+        > nearest_predicate_access;
+    typedef typename nearest_predicate_access::type nearest_predicate_type;
+    typedef typename indexable_type<translator_type>::type indexable_type;
+
+    typedef index::detail::calculate_distance<nearest_predicate_type, indexable_type, strategy_type, value_tag> calculate_value_distance;
+    typedef index::detail::calculate_distance<nearest_predicate_type, box_type, strategy_type, bounds_tag> calculate_node_distance;
+    typedef typename calculate_value_distance::result_type value_distance_type;
+    typedef typename calculate_node_distance::result_type node_distance_type;
+
+    typedef scan_distance<Predicates, box_type, strategy_type, node_distance_type> scan_type;
+    // the quantized boxes are not scanned
+    static const bool scan_enabled = scan_type::enabled && Members::has_coordinates;
+
+    typedef typename allocators_type::const_reference const_reference;
+
+    using neighbor_data = std::pair<value_distance_type, const value_type *>;
+    using neighbors_type = visitors::priority_dequeue<neighbor_data, visitors::pair_first_greater>;
+
+    struct branch_data
+    {
+        branch_data(node_distance_type d, size_type i)
+            : distance(d), index(i)
+        {}
+
+        node_distance_type distance;
+        size_type index;
+    };
+    using branches_type = visitors::priority_queue<branch_data, branch_data_comp>;
+
+public:
+    inline distance_query_incremental()
+        : m_members(nullptr)
+//        , m_strategy()
+//        , m_pred()
+//        , m_scan()
+        , m_neighbors_count(0)
+        , m_neighbor_ptr(nullptr)
+    {}
+
+    inline distance_query_incremental(Predicates const& pred)
+        : m_members(nullptr)
+//        , m_strategy()
+        , m_pred(pred)
+        , m_scan(pred)
+        , m_neighbors_count(0)
+        , m_neighbor_ptr(nullptr)
+    {}
+
+    inline distance_query_incremental(Members const& members, Predicates const& pred)
+        : m_members(std::addressof(members))
+        , m_strategy(index::detail::get_strategy(members.parameters()))
+        , m_pred(pred)
+        , m_scan(pred)
+        , m_neighbors_count(0)
+        , m_neighbor_ptr(nullptr)
+    {}
+
+    const_reference dereference() const
+    {
+        return *m_neighbor_ptr;
+    }
+
+    void initialize()
+    {
+        if (0 < max_count())
+        {
+            apply(0, m_members->root_count);
+            increment();
+        }
+    }
+
+    void increment()
+    {
+        for (;;)
+        {
+            if (m_branches.empty())
+            {
+                // there exists a next closest neighbor so we can increment
+                if (! m_neighbors.empty())
+                {
+                    m_neighbor_ptr = m_neighbors.top().second;
+                    ++m_neighbors_count;
+                    m_neighbors.pop_top();
+                }
+                else
+                {
+                    // there aren't any neighbors left, end
+                    m_neighbor_ptr = nullptr;
+                    m_neighbors_count = max_count();
+                }
+
+                return;
+            }
+            else
+            {
+                branch_data const& closest_branch = m_branches.top();
+
+                // if next neighbor is closer or as close as the closest branch, set next neighbor
+                if (! m_neighbors.empty() && m_neighbors.top().first <= closest_branch.distance )
+                {
+                    m_neighbor_ptr = m_neighbors.top().second;
+                    ++m_neighbors_count;
+                    m_neighbors.pop_top();
+                    return;
+                }
+
+                BOOST_GEOMETRY_INDEX_ASSERT(m_neighbors_count + m_neighbors.size() <= max_count(), "unexpected neighbors count");
+
+                // if there is enough neighbors and there is no closer branch
+                if (ignore_branch_or_value(closest_branch.distance))
+                {
+                    m_branches.clear();
+                    continue;
+                }
+                else
+                {
+                    size_type const i = closest_branch.index;
+                    m_branches.pop();
+
+                    apply(m_members->first[i], m_members->first[i + 1]);
+                }
+            }
+        }
+    }
+
+    bool is_end() const
+    {
+        return m_neighbor_ptr == nullptr;
+    }
+
+    friend bool operator==(distance_query_incremental const& l, distance_query_incremental const& r)
+    {
+        return l.m_neighbors_count == r.m_neighbors_count;
+    }
+
+private:
+    // [first, last) are global indexes of children of a node
+    void apply(size_type first, size_type last)
+    {
+        namespace id = index::detail;
+
+        translator_type const& tr = m_members->translator();
+
+        // Put values into the list of neighbours if those values meets predicates
+        // and aren't further than already found neighbours (if there is enough neighbours)
+        if (m_members->is_value(first))
+        {
+            for (size_type i = first ; i < last ; ++i)
+            {
+                value_type const& v = m_members->value(i);
+                value_distance_type value_distance; // for distance predicate
+
+                // if value meets predicates
+                if (id::predicates_check<id::value_tag>(m_pred, v, tr(v), m_strategy)
+                    // and if distance is ok
+                    && calculate_value_distance::apply(predicate(), tr(v), m_strategy, value_distance)
+                    // and if current value is closer than the furthest neighbor
+                    && ! ignore_branch_or_value(value_distance))
+                {
+                    // add current value into the queue
+                    m_neighbors.push(std::make_pair(value_distance, std::addressof(v)));
+
+                    // remove unneeded value
+                    if (m_neighbors_count + m_neighbors.size() > max_count())
+                    {
+                        m_neighbors.pop_bottom();
+                    }
+                }
+            }
+        }
+        // Put node's elements into the list of active branches if those elements meets predicates
+        // and aren't further than found neighbours (if there is enough neighbours)
+        else
+        {
+            apply_nodes(first, last, std::integral_constant<bool, scan_enabled>());
+        }
+    }
+
+    void apply_nodes(size_type first, size_type last, std::false_type /*scan*/)
+    {
+        namespace id = index::detail;
+
+        for (size_type i = first ; i < last ; ++i)
+        {
+            box_type const box = m_members->box(i);
+            node_distance_type node_distance; // for distance predicate
+
+            // if current node meets predicates (0 is dummy value)
+            if (id::predicates_check<id::bounds_tag>(m_pred, 0, box, m_strategy)
+                // and if distance is ok
+                && calculate_node_distance::apply(predicate(), box, m_strategy, node_distance)
+                // and if current node is closer than the furthest neighbor
+                && ! ignore_branch_or_value(node_distance))
+            {
+                // add current node into the queue
+                m_branches.push(branch_data(node_distance, i));
+            }
+        }
+    }
+
+    void apply_nodes(size_type first, size_type last, std::true_type /*scan*/)
+    {
+        // only the distance predicate is passed so calculate all distances at once
+        node_distance_type distances[scan_chunk_size];
+        for (size_type chunk = first ; chunk < last ; chunk += scan_chunk_size)
+        {
+            size_type const n = (std::min)(size_type(scan_chunk_size), last - chunk);
+            m_scan.apply(*m_members, chunk, n, distances);
+            for (size_type j = 0 ; j < n ; ++j)
+            {
+                // if current node is closer than the furthest neighbor
+                if (! ignore_branch_or_value(distances[j]))
+                {
+                    m_branches.push(branch_data(distances[j], chunk + j));
+                }
+            }
+        }
+    }
+
+    template <typename Distance>
+    bool ignore_branch_or_value(Distance const& distance)
+    {
+        return m_neighbors_count + m_neighbors.size() == max_count()
+            && (m_neighbors.empty() || m_neighbors.bottom().first <= distance);
+    }
+
+    std::size_t max_count() const
+    {
+        return nearest_predicate_access::get(m_pred).count;
+    }
+
+    nearest_predicate_type const& predicate() const
+    {
+        return nearest_predicate_access::get(m_pred);
+    }
+
+    Members const* m_members;
+    strategy_type m_strategy;
+
+    Predicates m_pred;
+    scan_type m_scan;
+
+    branches_type m_branches;
+    neighbors_type m_neighbors;
+    size_type m_neighbors_count;
+    const value_type * m_neighbor_ptr;
+};
+
+}}} // namespace detail::rtree::flat
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_DISTANCE_QUERY_HPP
@@ -0,0 +1,468 @@
+// Boost.Geometry Index
+//
+// R-tree flat read-only representation
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_MEMBERS_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_MEMBERS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/vector.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/translator.hpp>
+#include <boost/geometry/index/parameters.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace flat {
+
+// The nodes of the tree are stored in breadth-first order as entries of contiguous arrays.
+// Each entry is the bounding box of a node, except the root, and the range of its children.
+//
+// The children are identified by global indexes. Indexes lower than the number of entries
+// identify entries and greater or equal identify values (offset by the number of entries).
+// Since the children of consecutive entries are stored consecutively, the children of the
+// entry i are in range [first[i], first[i+1]). The root children are in range
+// [0, root_count), if the root is a leaf then there are no entries so these are values.
+//
+// The coordinates of boxes are stored as separate arrays (structure of arrays), the minimum
+// and maximum coordinates of the dimension D are at offsets 2*D*E and (2*D+1)*E where E is
+// the number of entries.
+
+template <std::size_t I, std::size_t D>
+struct load_box
+{
+    template <typename Box, typename Coords, typename SizeType>
+    static inline void apply(Box & b, Coords const* coords, SizeType count, SizeType i)
+    {
+        geometry::set<min_corner, I>(b, coords[2 * I * count + i]);
+        geometry::set<max_corner, I>(b, coords[(2 * I + 1) * count + i]);
+        load_box<I + 1, D>::apply(b, coords, count, i);
+    }
+};
+
+template <std::size_t D>
+struct load_box<D, D>
+{
+    template <typename Box, typename Coords, typename SizeType>
+    static inline void apply(Box &, Coords const*, SizeType, SizeType)
+    {}
+};
+
+template <std::size_t I, std::size_t D>
+struct store_box
+{
+    template <typename Box, typename Coords, typename SizeType>
+    static inline void apply(Box const& b, Coords * coords, SizeType count, SizeType i)
+    {
+        coords[2 * I * count + i] = geometry::get<min_corner, I>(b);
+        coords[(2 * I + 1) * count + i] = geometry::get<max_corner, I>(b);
+        store_box<I + 1, D>::apply(b, coords, count, i);
+    }
+};
+
+template <std::size_t D>
+struct store_box<D, D>
+{
+    template <typename Box, typename Coords, typename SizeType>
+    static inline void apply(Box const&, Coords *, SizeType, SizeType)
+    {}
+};
+
+template <typename Value, typename Allocator>
+struct allocators
+{
+    typedef boost::container::allocator_traits<Allocator> allocator_traits_type;
+    typedef typename allocator_traits_type::template rebind_alloc<Value> value_allocator_type;
+    typedef boost::container::allocator_traits<value_allocator_type> value_allocator_traits;
+
+    typedef Allocator allocator_type;
+
+    typedef Value value_type;
+    typedef typename value_allocator_traits::reference reference;
+    typedef typename value_allocator_traits::const_reference const_reference;
+    typedef typename value_allocator_traits::size_type size_type;
+    typedef typename value_allocator_traits::difference_type difference_type;
+    typedef typename value_allocator_traits::pointer pointer;
+    typedef typename value_allocator_traits::const_pointer const_pointer;
+};
+
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo,
+          typename Allocator, typename Box>
+struct members
+    : public detail::translator<IndexableGetter, EqualTo>
+    , public Parameters
+{
+    typedef Value value_type;
+    typedef Parameters parameters_type;
+    typedef Box box_type;
+    typedef detail::translator<IndexableGetter, EqualTo> translator_type;
+    typedef IndexableGetter indexable_getter_type;
+    typedef EqualTo equal_to_type;
+    typedef flat::allocators<Value, Allocator> allocators_type;
+    typedef typename allocators_type::size_type size_type;
+
+    typedef coordinate_type_t<Box> coordinate_type;
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+
+    // The boxes of entries are stored in coordinates so they may be scanned
+    static const bool has_coordinates = true;
+
+    typedef typename allocators_type::allocator_traits_type allocator_traits_type;
+    typedef boost::container::vector
+        <
+            value_type, typename allocator_traits_type::template rebind_alloc<value_type>
+        > values_type;
+    typedef boost::container::vector
+        <
+            size_type, typename allocator_traits_type::template rebind_alloc<size_type>
+        > indexes_type;
+    typedef boost::container::vector
+        <
+            coordinate_type, typename allocator_traits_type::template rebind_alloc<coordinate_type>
+        > coordinates_type;
+
+    members(IndexableGetter const& ind_get, EqualTo const& val_eq,
+            Parameters const& parameters, Allocator const& alloc)
+        : translator_type(ind_get, val_eq)
+        , Parameters(parameters)
+        , values(alloc)
+        , first(alloc)
+        , coordinates(alloc)
+        , entries_count(0)
+        , root_count(0)
+    {}
+
+    translator_type const& translator() const { return *this; }
+
+    IndexableGetter const& indexable_getter() const { return *this; }
+    EqualTo const& equal_to() const { return *this; }
+
+    Parameters const& parameters() const { return *this; }
+
+    Allocator get_allocator() const { return Allocator(values.get_allocator()); }
+
+    // Box of the entry i
+    box_type box(size_type i) const
+    {
+        box_type result;
+        load_box<0, dimension>::apply(result, coordinates.data(), entries_count, i);
+        return result;
+    }
+
+    // True if the global index identifies a value
+    bool is_value(size_type i) const
+    {
+        return entries_count <= i;
+    }
+
+    value_type const& value(size_type i) const
+    {
+        return values[i - entries_count];
+    }
+
+    void clear()
+    {
+        values.clear();
+        first.clear();
+        coordinates.clear();
+        entries_count = 0;
+        root_count = 0;
+    }
+
+    void swap(members & other)
+    {
+        std::swap(static_cast<translator_type&>(*this), static_cast<translator_type&>(other));
+        std::swap(static_cast<Parameters&>(*this), static_cast<Parameters&>(other));
+        values.swap(other.values);
+        first.swap(other.first);
+        coordinates.swap(other.coordinates);
+        std::swap(entries_count, other.entries_count);
+        std::swap(root_count, other.root_count);
+    }
+
+    values_type values;
+    indexes_type first;
+    coordinates_type coordinates;
+    size_type entries_count;
+    size_type root_count;
+};
+
+// The quantized boxes of entries are decoded from the frames of frame_size consecutive entries.
+// The frame of the dimension D is stored as the minimum coordinate at offset 2*D and the step at
+// offset 2*D+1. The step is a power of two so the products of integers and steps are exact and
+// the decoded coordinates are the same no matter how the operations are contracted.
+template <std::size_t I, std::size_t D>
+struct load_quantized_box
+{
+    template <typename Box, typename Integer, typename Coords>
+    static inline void apply(Box & b, Integer const* integers, Coords const* frame)
+    {
+        geometry::set<min_corner, I>(b, frame[2 * I] + Coords(integers[2 * I]) * frame[2 * I + 1]);
+        geometry::set<max_corner, I>(b, frame[2 * I] + Coords(integers[2 * I + 1]) * frame[2 * I + 1]);
+        load_quantized_box<I + 1, D>::apply(b, integers, frame);
+    }
+};
+
+template <std::size_t D>
+struct load_quantized_box<D, D>
+{
+    template <typename Box, typename Integer, typename Coords>
+    static inline void apply(Box &, Integer const*, Coords const*)
+    {}
+};
+
+// The same as flat::members but the boxes of entries are stored as integers relative to frames,
+// the boxes containing the boxes of frame_size consecutive entries. In breadth-first order
+// these are siblings or the children of neighbouring nodes so the frames are small.
+// The minimum corners are rounded down and the maximum corners up so the decoded boxes
+// contain the exact ones. The coordinates are used only while the tree is built.
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo,
+          typename Allocator, typename Box, typename Integer>
+struct quantized_members
+    : public members<Value, Parameters, IndexableGetter, EqualTo, Allocator, Box>
+{
+    typedef members<Value, Parameters, IndexableGetter, EqualTo, Allocator, Box> base_type;
+
+    typedef typename base_type::box_type box_type;
+    typedef typename base_type::size_type size_type;
+    typedef typename base_type::coordinate_type coordinate_type;
+    typedef typename base_type::coordinates_type coordinates_type;
+    static const std::size_t dimension = base_type::dimension;
+
+    BOOST_GEOMETRY_STATIC_ASSERT((std::is_floating_point<coordinate_type>::value),
+        "Only floating point coordinates can be quantized.",
+        coordinate_type);
+    BOOST_GEOMETRY_STATIC_ASSERT((std::is_integral<Integer>::value && std::is_unsigned<Integer>::value
+                               && std::numeric_limits<Integer>::digits <= std::numeric_limits<coordinate_type>::digits),
+        "Integer must be unsigned integral type which values are represented exactly by the coordinate type.",
+        Integer, coordinate_type);
+
+    static const bool has_coordinates = false;
+
+    static const size_type frame_size = 16;
+
+    typedef boost::container::vector
+        <
+            Integer, typename base_type::allocator_traits_type::template rebind_alloc<Integer>
+        > integers_type;
+
+    quantized_members(IndexableGetter const& ind_get, EqualTo const& val_eq,
+                      Parameters const& parameters, Allocator const& alloc)
+        : base_type(ind_get, val_eq, parameters, alloc)
+        , integers(alloc)
+        , frames(alloc)
+    {}
+
+    // Box of the entry i
+    box_type box(size_type i) const
+    {
+        box_type result;
+        load_quantized_box<0, dimension>::apply(result,
+                                                integers.data() + 2 * dimension * i,
+                                                frames.data() + 2 * dimension * (i / frame_size));
+        return result;
+    }
+
+    // Replaces the coordinates of the boxes of entries with integers
+    void quantize()
+    {
+        size_type const count = this->entries_count;
+        size_type const frames_count = (count + frame_size - 1) / frame_size;
+
+        integers.resize(2 * dimension * count);                                             // MAY THROW (A)
+        frames.resize(2 * dimension * frames_count);                                        // MAY THROW (A)
+
+        for (size_type f = 0 ; f < frames_count ; ++f)
+        {
+            size_type const first = f * frame_size;
+            size_type const last = (std::min)(first + frame_size, count);
+
+            for (std::size_t d = 0 ; d < dimension ; ++d)
+            {
+                coordinate_type const* mins = this->coordinates.data() + 2 * d * count;
+                coordinate_type const* maxs = this->coordinates.data() + (2 * d + 1) * count;
+
+                coordinate_type fmin = mins[first];
+                coordinate_type fmax = maxs[first];
+                for (size_type i = first + 1 ; i < last ; ++i)
+                {
+                    fmin = (std::min)(fmin, mins[i]);
+                    fmax = (std::max)(fmax, maxs[i]);
+                }
+
+                coordinate_type const step = frame_step(fmin, fmax);
+                frames[2 * dimension * f + 2 * d] = fmin;
+                frames[2 * dimension * f + 2 * d + 1] = step;
+
+                for (size_type i = first ; i < last ; ++i)
+                {
+                    integers[2 * dimension * i + 2 * d] = quantize_min(mins[i], fmin, step);
+                    integers[2 * dimension * i + 2 * d + 1] = quantize_max(maxs[i], fmin, step);
+                }
+            }
+        }
+
+        this->coordinates.clear();
+        this->coordinates.shrink_to_fit();
+    }
+
+    void clear()
+    {
+        base_type::clear();
+        integers.clear();
+        frames.clear();
+    }
+
+    void swap(quantized_members & other)
+    {
+        base_type::swap(other);
+        integers.swap(other.integers);
+        frames.swap(other.frames);
+    }
+
+    integers_type integers;
+    coordinates_type frames;
+
+private:
+    static coordinate_type decode(Integer q, coordinate_type fmin, coordinate_type step)
+    {
+        return fmin + coordinate_type(q) * step;
+    }
+
+    // The smallest power of two for which the maximum of the frame is decoded
+    static coordinate_type frame_step(coordinate_type fmin, coordinate_type fmax)
+    {
+        if (! (fmin < fmax))
+        {
+            return coordinate_type(0);
+        }
+
+        int exponent = 0;
+        std::frexp((fmax - fmin) / coordinate_type(max_integer()), &exponent);
+        coordinate_type step = std::ldexp(coordinate_type(1), exponent);
+        while (decode(max_integer(), fmin, step) < fmax)
+        {
+            step *= 2;
+        }
+        return step;
+    }
+
+    static Integer quantize_min(coordinate_type v, coordinate_type fmin, coordinate_type step)
+    {
+        if (step == 0)
+        {
+            return 0;
+        }
+
+        Integer q = to_integer(std::floor((v - fmin) / step));
+        while (q > 0 && v < decode(q, fmin, step))
+        {
+            --q;
+        }
+        return q;
+    }
+
+    static Integer quantize_max(coordinate_type v, coordinate_type fmin, coordinate_type step)
+    {
+        if (step == 0)
+        {
+            return 0;
+        }
+
+        Integer q = to_integer(std::ceil((v - fmin) / step));
+        while (q < max_integer() && decode(q, fmin, step) < v)
+        {
+            ++q;
+        }
+        return q;
+    }
+
+    static Integer to_integer(coordinate_type t)
+    {
+        return t <= 0 ? Integer(0)
+             : t >= coordinate_type(max_integer()) ? max_integer()
+             : Integer(t);
+    }
+
+    static Integer max_integer()
+    {
+        return (std::numeric_limits<Integer>::max)();
+    }
+};
+
+// Returns the members storing the boxes of entries as defined by NodeBoxes
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo,
+          typename Allocator, typename Box, typename NodeBoxes>
+struct select_members
+{
+    typedef members<Value, Parameters, IndexableGetter, EqualTo, Allocator, Box> type;
+};
+
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo,
+          typename Allocator, typename Box, typename Integer>
+struct select_members<Value, Parameters, IndexableGetter, EqualTo, Allocator, Box,
+                    index::quantized_node_boxes<Integer> >
+{
+    typedef quantized_members<Value, Parameters, IndexableGetter, EqualTo, Allocator, Box, Integer> type;
+};
+
+// Finishes building of the members
+template <typename Members>
+inline void finish_build(Members &)
+{}
+
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo,
+          typename Allocator, typename Box, typename Integer>
+inline void finish_build(quantized_members<Value, Parameters, IndexableGetter, EqualTo, Allocator, Box, Integer> & members)
+{
+    members.quantize();                                                                     // MAY THROW (A)
+}
+
+// The box containing all values or an inverse box if there are no values
+template <typename Members>
+inline typename Members::box_type members_bounds(Members const& members)
+{
+    typedef typename Members::box_type box_type;
+    typedef typename Members::size_type size_type;
+
+    if (members.entries_count == 0)
+    {
+        return values_box<box_type>(members.values.begin(), members.values.end(),
+                                    members.translator(),
+                                    index::detail::get_strategy(members.parameters()));
+    }
+
+    box_type result = members.box(0);
+    for (size_type i = 1 ; i < members.root_count ; ++i)
+    {
+        index::detail::expand(result, members.box(i),
+                              index::detail::get_strategy(members.parameters()));
+    }
+
+    return result;
+}
+
+}}} // namespace detail::rtree::flat
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_MEMBERS_HPP
@@ -0,0 +1,103 @@
+// Boost.Geometry Index
+//
+// R-tree flat representation query iterators
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_QUERY_ITERATORS_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_QUERY_ITERATORS_HPP
+
+#include <memory>
+
+#include <boost/geometry/index/detail/rtree/flat/distance_query.hpp>
+#include <boost/geometry/index/detail/rtree/flat/spatial_query.hpp>
+#include <boost/geometry/index/detail/rtree/query_iterators.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree { namespace flat {
+
+template <typename Members, typename Predicates, typename Impl>
+class query_iterator_impl
+{
+    typedef typename Members::allocators_type allocators_type;
+    typedef iterators::end_query_iterator<typename Members::value_type, allocators_type> end_iterator;
+
+public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef typename Members::value_type value_type;
+    typedef typename allocators_type::const_reference reference;
+    typedef typename allocators_type::difference_type difference_type;
+    typedef typename allocators_type::const_pointer pointer;
+
+    query_iterator_impl() = default;
+
+    explicit query_iterator_impl(Predicates const& pred)
+        : m_impl(pred)
+    {}
+
+    query_iterator_impl(Members const& members, Predicates const& pred)
+        : m_impl(members, pred)
+    {
+        m_impl.initialize();
+    }
+
+    reference operator*() const
+    {
+        return m_impl.dereference();
+    }
+
+    const value_type * operator->() const
+    {
+        return std::addressof(m_impl.dereference());
+    }
+
+    query_iterator_impl & operator++()
+    {
+        m_impl.increment();
+        return *this;
+    }
+
+    query_iterator_impl operator++(int)
+    {
+        query_iterator_impl temp = *this;
+        this->operator++();
+        return temp;
+    }
+
+    friend bool operator==(query_iterator_impl const& l, query_iterator_impl const& r)
+    {
+        return l.m_impl == r.m_impl;
+    }
+
+    friend bool operator==(query_iterator_impl const& l, end_iterator const& /*r*/)
+    {
+        return l.m_impl.is_end();
+    }
+
+    friend bool operator==(end_iterator const& /*l*/, query_iterator_impl const& r)
+    {
+        return r.m_impl.is_end();
+    }
+
+private:
+    Impl m_impl;
+};
+
+template <typename Members, typename Predicates>
+using spatial_query_iterator = query_iterator_impl
+    <
+        Members, Predicates, spatial_query_incremental<Members, Predicates>
+    >;
+
+template <typename Members, typename Predicates>
+using distance_query_iterator = query_iterator_impl
+    <
+        Members, Predicates, distance_query_incremental<Members, Predicates>
+    >;
+
+}}}}}} // namespace boost::geometry::index::detail::rtree::flat
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_QUERY_ITERATORS_HPP
@@ -0,0 +1,350 @@
+// Boost.Geometry Index
+//
+// R-tree flat representation vectorized scanning of node boxes
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_SCAN_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_SCAN_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/index/detail/distance_predicates.hpp>
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/parameters.hpp>
+
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/index/cartesian.hpp>
+
+// The kernels are selected at compile time depending on the instruction set enabled
+// for the compiler. Define BOOST_GEOMETRY_INDEX_NO_SIMD to use the scalar version.
+#if ! defined(BOOST_GEOMETRY_INDEX_NO_SIMD)
+#if defined(__AVX2__)
+#define BOOST_GEOMETRY_INDEX_DETAIL_FLAT_SCAN_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOOST_GEOMETRY_INDEX_DETAIL_FLAT_SCAN_SSE2
+#include <emmintrin.h>
+#endif
+#endif
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace flat {
+
+// The maximum number of children tested at once, one bit of the mask per child
+static const std::size_t scan_chunk_size = 64;
+
+template <typename T>
+struct is_scan_coordinate
+{
+    static const bool value = std::is_same<T, double>::value
+                           || std::is_same<T, float>::value;
+};
+
+// Kernels are used only if the coordinates are compared and the distances calculated
+// the same way as in the default cartesian strategies.
+template <typename Geometry, typename Strategy>
+struct is_scan_geometry
+{
+    static const bool value = std::is_same<cs_tag_t<Geometry>, cartesian_tag>::value
+                           && is_scan_coordinate<coordinate_type_t<Geometry>>::value
+                           && (std::is_same<Strategy, default_strategy>::value
+                            || std::is_same<Strategy, strategies::index::cartesian<>>::value);
+};
+
+#ifdef BOOST_GEOMETRY_INDEX_DETAIL_FLAT_SCAN_AVX2
+
+inline __m256d scan_load(double const* ptr)
+{
+    return _mm256_loadu_pd(ptr);
+}
+
+inline __m256d scan_load(float const* ptr)
+{
+    return _mm256_cvtps_pd(_mm_loadu_ps(ptr));
+}
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_FLAT_SCAN_AVX2
+
+#ifdef BOOST_GEOMETRY_INDEX_DETAIL_FLAT_SCAN_SSE2
+
+inline __m128d scan_load(double const* ptr)
+{
+    return _mm_loadu_pd(ptr);
+}
+
+inline __m128d scan_load(float const* ptr)
+{
+    return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(ptr))));
+}
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_FLAT_SCAN_SSE2
+
+// Tests n <= scan_chunk_size entries starting at first against the box [qmin, qmax].
+// The bit j of the result is set if the entry first + j intersects the box.
+// Like in disjoint(box, box) the entry intersects if none of the coordinates is outside.
+template <std::size_t Dimension, typename T>
+inline std::uint64_t scan_intersects(T const* coords, std::size_t count,
+                                     std::size_t first, std::size_t n,
+                                     double const* qmin, double const* qmax)
+{
+    std::uint64_t mask = 0;
+    std::size_t j = 0;
+
+#if defined(BOOST_GEOMETRY_INDEX_DETAIL_FLAT_SCAN_AVX2)
+    __m256d vmin[Dimension], vmax[Dimension];
+    for (std::size_t d = 0 ; d < Dimension ; ++d)
+    {
+        vmin[d] = _mm256_set1_pd(qmin[d]);
+        vmax[d] = _mm256_set1_pd(qmax[d]);
+    }
+
+    for ( ; j + 4 <= n ; j += 4)
+    {
+        __m256d ok = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+        for (std::size_t d = 0 ; d < Dimension ; ++d)
+        {
+            __m256d const mn = scan_load(coords + 2 * d * count + first + j);
+            __m256d const mx = scan_load(coords + (2 * d + 1) * count + first + j);
+            ok = _mm256_and_pd(ok, _mm256_cmp_pd(mn, vmax[d], _CMP_NGT_UQ));
+            ok = _mm256_and_pd(ok, _mm256_cmp_pd(mx, vmin[d], _CMP_NLT_UQ));
+        }
+        mask |= std::uint64_t(_mm256_movemask_pd(ok)) << j;
+    }
+#elif defined(BOOST_GEOMETRY_INDEX_DETAIL_FLAT_SCAN_SSE2)
+    __m128d vmin[Dimension], vmax[Dimension];
+    for (std::size_t d = 0 ; d < Dimension ; ++d)
+    {
+        vmin[d] = _mm_set1_pd(qmin[d]);
+        vmax[d] = _mm_set1_pd(qmax[d]);
+    }
+
+    for ( ; j + 2 <= n ; j += 2)
+    {
+        __m128d ok = _mm_castsi128_pd(_mm_set1_epi32(-1));
+        for (std::size_t d = 0 ; d < Dimension ; ++d)
+        {
+            __m128d const mn = scan_load(coords + 2 * d * count + first + j);
+            __m128d const mx = scan_load(coords + (2 * d + 1) * count + first + j);
+            ok = _mm_and_pd(ok, _mm_cmpngt_pd(mn, vmax[d]));
+            ok = _mm_and_pd(ok, _mm_cmpnlt_pd(mx, vmin[d]));
+        }
+        mask |= std::uint64_t(_mm_movemask_pd(ok)) << j;
+    }
+#endif
+
+    for ( ; j < n ; ++j)
+    {
+        bool ok = true;
+        for (std::size_t d = 0 ; d < Dimension ; ++d)
+        {
+            double const mn = coords[2 * d * count + first + j];
+            double const mx = coords[(2 * d + 1) * count + first + j];
+            ok = ok && ! (mn > qmax[d]) && ! (mx < qmin[d]);
+        }
+        mask |= std::uint64_t(ok) << j;
+    }
+
+    return mask;
+}
+
+// Calculates comparable distances between the point p and n entries starting at first.
+// Dimensions are processed in the same order as in the cartesian point-box strategy.
+template <std::size_t Dimension, typename T>
+inline void scan_comparable_distance(T const* coords, std::size_t count,
+                                     std::size_t first, std::size_t n,
+                                     double const* p, double * result)
+{
+    std::size_t j = 0;
+
+#if defined(BOOST_GEOMETRY_INDEX_DETAIL_FLAT_SCAN_AVX2)
+    __m256d const zero = _mm256_setzero_pd();
+    for ( ; j + 4 <= n ; j += 4)
+    {
+        __m256d sum = zero;
+        for (std::size_t d = Dimension ; d-- > 0 ; )
+        {
+            __m256d const vp = _mm256_set1_pd(p[d]);
+            __m256d const mn = scan_load(coords + 2 * d * count + first + j);
+            __m256d const mx = scan_load(coords + (2 * d + 1) * count + first + j);
+            __m256d const diff = _mm256_max_pd(_mm256_max_pd(_mm256_sub_pd(mn, vp),
+                                                             _mm256_sub_pd(vp, mx)),
+                                               zero);
+            sum = _mm256_add_pd(sum, _mm256_mul_pd(diff, diff));
+        }
+        _mm256_storeu_pd(result + j, sum);
+    }
+#elif defined(BOOST_GEOMETRY_INDEX_DETAIL_FLAT_SCAN_SSE2)
+    __m128d const zero = _mm_setzero_pd();
+    for ( ; j + 2 <= n ; j += 2)
+    {
+        __m128d sum = zero;
+        for (std::size_t d = Dimension ; d-- > 0 ; )
+        {
+            __m128d const vp = _mm_set1_pd(p[d]);
+            __m128d const mn = scan_load(coords + 2 * d * count + first + j);
+            __m128d const mx = scan_load(coords + (2 * d + 1) * count + first + j);
+            __m128d const diff = _mm_max_pd(_mm_max_pd(_mm_sub_pd(mn, vp),
+                                                       _mm_sub_pd(vp, mx)),
+                                            zero);
+            sum = _mm_add_pd(sum, _mm_mul_pd(diff, diff));
+        }
+        _mm_storeu_pd(result + j, sum);
+    }
+#endif
+
+    for ( ; j < n ; ++j)
+    {
+        double sum = 0;
+        for (std::size_t d = Dimension ; d-- > 0 ; )
+        {
+            double const mn = coords[2 * d * count + first + j];
+            double const mx = coords[(2 * d + 1) * count + first + j];
+            if (p[d] < mn)
+            {
+                double const diff = mn - p[d];
+                sum += diff * diff;
+            }
+            if (p[d] > mx)
+            {
+                double const diff = p[d] - mx;
+                sum += diff * diff;
+            }
+        }
+        result[j] = sum;
+    }
+}
+
+// Spatial predicates checked with intersects() for nodes, see predicate_check for bounds_tag
+template <typename Tag>
+struct is_scan_intersects_tag
+{
+    static const bool value = std::is_same<Tag, predicates::intersects_tag>::value
+                           || std::is_same<Tag, predicates::covered_by_tag>::value
+                           || std::is_same<Tag, predicates::overlaps_tag>::value
+                           || std::is_same<Tag, predicates::touches_tag>::value
+                           || std::is_same<Tag, predicates::within_tag>::value;
+};
+
+template <typename Predicates, typename Box, typename Strategy>
+struct scan_spatial
+{
+    static const bool enabled = false;
+
+    explicit scan_spatial(Predicates const&)
+    {}
+};
+
+template <typename Geometry, typename Tag, typename Box, typename Strategy>
+struct scan_spatial<predicates::spatial_predicate<Geometry, Tag, false>, Box, Strategy>
+{
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+
+    static const bool enabled = is_scan_intersects_tag<Tag>::value
+                             && std::is_same<tag_t<Geometry>, box_tag>::value
+                             && is_scan_geometry<Geometry, Strategy>::value
+                             && is_scan_geometry<Box, Strategy>::value
+                             && geometry::dimension<Geometry>::value == dimension;
+
+    explicit scan_spatial(predicates::spatial_predicate<Geometry, Tag, false> const& pred)
+    {
+        init<0>(pred.geometry, std::integral_constant<bool, enabled>());
+    }
+
+    template <typename Members>
+    std::uint64_t apply(Members const& members, std::size_t first, std::size_t n) const
+    {
+        return scan_intersects<dimension>(members.coordinates.data(), members.entries_count,
+                                          first, n, m_min, m_max);
+    }
+
+private:
+    template <std::size_t I>
+    void init(Geometry const& g, std::true_type)
+    {
+        m_min[I] = geometry::get<min_corner, I>(g);
+        m_max[I] = geometry::get<max_corner, I>(g);
+        init<I + 1>(g, std::integral_constant<bool, (I + 1 < dimension)>());
+    }
+
+    template <std::size_t I>
+    void init(Geometry const&, std::false_type)
+    {}
+
+    double m_min[dimension];
+    double m_max[dimension];
+};
+
+template <typename Predicates, typename Box, typename Strategy, typename NodeDistance>
+struct scan_distance
+{
+    static const bool enabled = false;
+
+    scan_distance()
+    {}
+
+    explicit scan_distance(Predicates const&)
+    {}
+};
+
+template <typename PointRelation, typename Box, typename Strategy, typename NodeDistance>
+struct scan_distance<predicates::nearest<PointRelation>, Box, Strategy, NodeDistance>
+{
+    typedef index::detail::relation<PointRelation> relation;
+    typedef typename relation::value_type point_type;
+
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+
+    static const bool enabled = std::is_same<tag_t<point_type>, point_tag>::value
+                             && is_scan_geometry<point_type, Strategy>::value
+                             && is_scan_geometry<Box, Strategy>::value
+                             && geometry::dimension<point_type>::value == dimension
+                             && std::is_same<NodeDistance, double>::value;
+
+    scan_distance()
+    {}
+
+    explicit scan_distance(predicates::nearest<PointRelation> const& pred)
+    {
+        init<0>(relation::value(pred.point_or_relation), std::integral_constant<bool, enabled>());
+    }
+
+    template <typename Members>
+    void apply(Members const& members, std::size_t first, std::size_t n, double * result) const
+    {
+        scan_comparable_distance<dimension>(members.coordinates.data(), members.entries_count,
+                                            first, n, m_point, result);
+    }
+
+private:
+    template <std::size_t I>
+    void init(point_type const& p, std::true_type)
+    {
+        m_point[I] = geometry::get<I>(p);
+        init<I + 1>(p, std::integral_constant<bool, (I + 1 < dimension)>());
+    }
+
+    template <std::size_t I>
+    void init(point_type const&, std::false_type)
+    {}
+
+    double m_point[dimension];
+};
+
+}}} // namespace detail::rtree::flat
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_SCAN_HPP
@@ -0,0 +1,276 @@
+// Boost.Geometry Index
+//
+// R-tree flat representation spatial query implementation
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_SPATIAL_QUERY_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_SPATIAL_QUERY_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <boost/geometry/index/detail/assert.hpp>
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/rtree/flat/scan.hpp>
+#include <boost/geometry/index/parameters.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace flat {
+
+template <typename Members, typename Predicates, typename OutIter>
+struct spatial_query
+{
+    typedef typename Members::box_type box_type;
+    typedef typename Members::parameters_type parameters_type;
+    typedef typename Members::translator_type translator_type;
+    typedef typename Members::size_type size_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    typedef scan_spatial<Predicates, box_type, strategy_type> scan_type;
+    // the quantized boxes are not scanned
+    static const bool scan_enabled = scan_type::enabled && Members::has_coordinates;
+
+    spatial_query(Members const& members, Predicates const& p, OutIter out_it)
+        : m_members(members)
+        , m_strategy(index::detail::get_strategy(members.parameters()))
+        , m_pred(p)
+        , m_scan(p)
+        , m_out_iter(out_it)
+        , m_found_count(0)
+    {}
+
+    size_type apply()
+    {
+        apply(0, m_members.root_count);
+        return m_found_count;
+    }
+
+private:
+    // [first, last) are global indexes of children of a node
+    void apply(size_type first, size_type last)
+    {
+        namespace id = index::detail;
+
+        if (m_members.is_value(first))
+        {
+            translator_type const& tr = m_members.translator();
+            for (size_type i = first ; i < last ; ++i)
+            {
+                auto const& v = m_members.value(i);
+                // if value meets predicates
+                if (id::predicates_check<id::value_tag>(m_pred, v, tr(v), m_strategy))
+                {
+                    *m_out_iter = v;
+                    ++m_out_iter;
+                    ++m_found_count;
+                }
+            }
+        }
+        else
+        {
+            apply_nodes(first, last, std::integral_constant<bool, scan_enabled>());
+        }
+    }
+
+    void apply_nodes(size_type first, size_type last, std::false_type /*scan*/)
+    {
+        namespace id = index::detail;
+
+        for (size_type i = first ; i < last ; ++i)
+        {
+            // if node meets predicates (0 is dummy value)
+            if (id::predicates_check<id::bounds_tag>(m_pred, 0, m_members.box(i), m_strategy))
+            {
+                apply(m_members.first[i], m_members.first[i + 1]);
+            }
+        }
+    }
+
+    void apply_nodes(size_type first, size_type last, std::true_type /*scan*/)
+    {
+        for (size_type chunk = first ; chunk < last ; chunk += scan_chunk_size)
+        {
+            size_type const n = (std::min)(size_type(scan_chunk_size), last - chunk);
+
+            // test all nodes at once and then traverse the ones meeting predicates
+            std::uint64_t mask = m_scan.apply(m_members, chunk, n);
+            for (size_type i = chunk ; mask != 0 ; ++i, mask >>= 1)
+            {
+                if (mask & 1)
+                {
+                    apply(m_members.first[i], m_members.first[i + 1]);
+                }
+            }
+        }
+    }
+
+    Members const& m_members;
+    strategy_type m_strategy;
+
+    Predicates const& m_pred;
+    scan_type m_scan;
+    OutIter m_out_iter;
+
+    size_type m_found_count;
+};
+
+template <typename Members, typename Predicates>
+class spatial_query_incremental
+{
+    typedef typename Members::value_type value_type;
+    typedef typename Members::parameters_type parameters_type;
+    typedef typename Members::allocators_type allocators_type;
+    typedef typename Members::size_type size_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    typedef typename allocators_type::const_reference const_reference;
+
+    struct range_data
+    {
+        range_data(size_type f, size_type l)
+            : first(f), last(l)
+        {}
+        size_type first;
+        size_type last;
+    };
+
+public:
+    spatial_query_incremental()
+        : m_members(nullptr)
+//        , m_strategy()
+//        , m_pred()
+        , m_current(0)
+        , m_last(0)
+    {}
+
+    spatial_query_incremental(Predicates const& p)
+        : m_members(nullptr)
+//        , m_strategy()
+        , m_pred(p)
+        , m_current(0)
+        , m_last(0)
+    {}
+
+    spatial_query_incremental(Members const& members, Predicates const& p)
+        : m_members(std::addressof(members))
+        , m_strategy(index::detail::get_strategy(members.parameters()))
+        , m_pred(p)
+        , m_current(0)
+        , m_last(0)
+    {}
+
+    const_reference dereference() const
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_current < m_last, "not dereferenceable");
+        return m_members->value(m_current);
+    }
+
+    void initialize()
+    {
+        apply(0, m_members->root_count);
+        search_value();
+    }
+
+    void increment()
+    {
+        ++m_current;
+        search_value();
+    }
+
+    bool is_end() const
+    {
+        return m_current == m_last;
+    }
+
+    friend bool operator==(spatial_query_incremental const& l, spatial_query_incremental const& r)
+    {
+        return (l.is_end() && r.is_end()) || (l.m_current == r.m_current && l.m_last == r.m_last);
+    }
+
+private:
+    void apply(size_type first, size_type last)
+    {
+        if (m_members->is_value(first))
+        {
+            m_current = first;
+            m_last = last;
+        }
+        else
+        {
+            m_internal_stack.push_back(range_data(first, last));
+        }
+    }
+
+    void search_value()
+    {
+        namespace id = index::detail;
+        for (;;)
+        {
+            // if leaf is chosen, move to the next value in leaf
+            if (m_current < m_last)
+            {
+                // return if next value is found
+                value_type const& v = m_members->value(m_current);
+                if (id::predicates_check<id::value_tag>(m_pred, v, m_members->translator()(v), m_strategy))
+                {
+                    return;
+                }
+
+                ++m_current;
+            }
+            // if leaf isn't chosen, move to the next leaf
+            else
+            {
+                // return if there is no more nodes to traverse
+                if (m_internal_stack.empty())
+                {
+                    return;
+                }
+
+                range_data& current_data = m_internal_stack.back();
+
+                // no more children in current node, remove it from stack
+                if (current_data.first == current_data.last)
+                {
+                    m_internal_stack.pop_back();
+                    continue;
+                }
+
+                size_type const i = current_data.first;
+                ++current_data.first;
+
+                // next node is found, push it to the stack
+                if (id::predicates_check<id::bounds_tag>(m_pred, 0, m_members->box(i), m_strategy))
+                {
+                    apply(m_members->first[i], m_members->first[i + 1]);
+                }
+            }
+        }
+    }
+
+    Members const* m_members;
+    strategy_type m_strategy;
+
+    Predicates m_pred;
+
+    std::vector<range_data> m_internal_stack;
+    size_type m_current;
+    size_type m_last;
+};
+
+}}} // namespace detail::rtree::flat
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_SPATIAL_QUERY_HPP
@@ -0,0 +1,153 @@
+// Boost.Geometry Index
+//
+// R-tree flat representation stored in external memory
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_VIEW_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_VIEW_HPP
+
+#include <cstddef>
+#include <utility>
+
+#include <boost/container/new_allocator.hpp>
+
+#include <boost/geometry/index/detail/rtree/flat/binary.hpp>
+#include <boost/geometry/index/detail/rtree/flat/members.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace flat {
+
+// Read-only array stored in external memory
+template <typename T>
+class array_view
+{
+public:
+    typedef T value_type;
+    typedef T const* const_iterator;
+    typedef std::size_t size_type;
+
+    array_view()
+        : m_data(nullptr), m_size(0)
+    {}
+
+    array_view(T const* data, size_type size)
+        : m_data(data), m_size(size)
+    {}
+
+    T const& operator[](size_type i) const { return m_data[i]; }
+    T const* data() const { return m_data; }
+    size_type size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    const_iterator begin() const { return m_data; }
+    const_iterator end() const { return m_data + m_size; }
+
+private:
+    T const* m_data;
+    size_type m_size;
+};
+
+// The same interface as flat::members but the arrays are stored in external memory
+// in the binary format.
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Box>
+struct view_members
+    : public detail::translator<IndexableGetter, EqualTo>
+    , public Parameters
+{
+    typedef Value value_type;
+    typedef Parameters parameters_type;
+    typedef Box box_type;
+    typedef detail::translator<IndexableGetter, EqualTo> translator_type;
+    typedef IndexableGetter indexable_getter_type;
+    typedef EqualTo equal_to_type;
+    typedef flat::allocators<Value, boost::container::new_allocator<Value> > allocators_type;
+    typedef typename allocators_type::size_type size_type;
+
+    typedef coordinate_type_t<Box> coordinate_type;
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+
+    static const bool has_coordinates = true;
+
+    typedef array_view<value_type> values_type;
+    typedef array_view<size_type> indexes_type;
+    typedef array_view<coordinate_type> coordinates_type;
+
+    view_members(IndexableGetter const& ind_get, EqualTo const& val_eq,
+                 Parameters const& parameters)
+        : translator_type(ind_get, val_eq)
+        , Parameters(parameters)
+        , entries_count(0)
+        , root_count(0)
+    {}
+
+    // Throws std::invalid_argument if the data is not valid
+    void assign(void const* data, std::size_t size)
+    {
+        binary_header const& header = check_binary<view_members>(data, size);
+        char const* const bytes = static_cast<char const*>(data);
+
+        std::size_t const indexes_count = header.entries_count > 0 ? header.entries_count + 1 : 0;
+        values = values_type(reinterpret_cast<value_type const*>(bytes + header.values_offset),
+                             header.values_count);
+        first = indexes_type(reinterpret_cast<size_type const*>(bytes + header.indexes_offset),
+                             indexes_count);
+        coordinates = coordinates_type(reinterpret_cast<coordinate_type const*>(bytes + header.coordinates_offset),
+                                       2 * dimension * header.entries_count);
+        entries_count = header.entries_count;
+        root_count = header.root_count;
+    }
+
+    translator_type const& translator() const { return *this; }
+
+    IndexableGetter const& indexable_getter() const { return *this; }
+    EqualTo const& equal_to() const { return *this; }
+
+    Parameters const& parameters() const { return *this; }
+
+    // Box of the entry i
+    box_type box(size_type i) const
+    {
+        box_type result;
+        load_box<0, dimension>::apply(result, coordinates.data(), entries_count, i);
+        return result;
+    }
+
+    // True if the global index identifies a value
+    bool is_value(size_type i) const
+    {
+        return entries_count <= i;
+    }
+
+    value_type const& value(size_type i) const
+    {
+        return values[i - entries_count];
+    }
+
+    void swap(view_members & other)
+    {
+        std::swap(static_cast<translator_type&>(*this), static_cast<translator_type&>(other));
+        std::swap(static_cast<Parameters&>(*this), static_cast<Parameters&>(other));
+        std::swap(values, other.values);
+        std::swap(first, other.first);
+        std::swap(coordinates, other.coordinates);
+        std::swap(entries_count, other.entries_count);
+        std::swap(root_count, other.root_count);
+    }
+
+    values_type values;
+    indexes_type first;
+    coordinates_type coordinates;
+    size_type entries_count;
+    size_type root_count;
+};
+
+}}} // namespace detail::rtree::flat
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_VIEW_HPP
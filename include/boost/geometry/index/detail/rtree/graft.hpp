@@ -0,0 +1,312 @@
+// Boost.Geometry Index
+//
+// R-tree subtrees grafting
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_GRAFT_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_GRAFT_HPP
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/index/detail/assert.hpp>
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/rtree/bulk_insert.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
+
+// Grafting of subtrees
+//
+// The subtrees are nodes detached from trees using the same parameters and compatible allocators,
+// e.g. the roots of other trees or the subtrees extracted from a tree. They're added to the tree
+// as a whole so the cost depends on the number of touched nodes instead of the number of values.
+//
+// The highest node becomes the root. If there are subtrees of the same height as the root,
+// they're joined with the root by a new root node. Subtrees lower than the root are added with
+// bulk_insert as the elements of nodes at their levels. At the seams, the subtrees which can't
+// be joined and the subtrees having less than Min elements (e.g. the roots of other trees) are
+// decomposed, their elements are added one level lower.
+
+template <typename MembersHolder>
+class graft
+{
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename allocators_type::node_pointer node_pointer;
+    typedef typename allocators_type::size_type size_type;
+
+    typedef typename rtree::elements_type<internal_node>::type internal_elements;
+    typedef typename internal_elements::value_type internal_element;
+    typedef typename rtree::elements_type<leaf>::type leaf_elements;
+
+public:
+    // the height of a node counted from the leafs level (1 for leafs) and the node
+    typedef std::vector<std::pair<size_type, node_pointer> > subtrees_type;
+
+    inline graft(node_pointer & root,
+                 size_type & leafs_level,
+                 parameters_type const& parameters,
+                 translator_type const& translator,
+                 allocators_type & allocators)
+        : m_root(root)
+        , m_leafs_level(leafs_level)
+        , m_parameters(parameters)
+        , m_translator(translator)
+        , m_allocators(allocators)
+    {}
+
+    // Moves the subtrees and the values into the tree. The root may be null.
+    // If an exception is thrown the subtrees which weren't grafted are destroyed.
+    inline void apply(subtrees_type & subtrees, std::vector<value_type> & values)
+    {
+        BOOST_TRY
+        {
+            set_highest_root(subtrees);                                                             // MAY THROW (A)
+
+            if ( ! m_root )
+            {
+                if ( values.empty() )
+                    return;
+
+                m_root = rtree::create_node<allocators_type, leaf>::apply(m_allocators);           // MAY THROW (N: alloc)
+                m_leafs_level = 0;
+            }
+
+            join_roots(subtrees);                                                                   // MAY THROW (E: alloc, N: alloc)
+
+            decompose(subtrees, values);                                                            // MAY THROW (V: copy, E: alloc)
+
+            insert(subtrees, values);                                                               // MAY THROW (V, E: alloc, copy, N: alloc)
+        }
+        BOOST_CATCH(...)
+        {
+            destroy(subtrees);
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+    // Destroys the subtrees which weren't grafted
+    inline void destroy(subtrees_type & subtrees)
+    {
+        for ( typename subtrees_type::iterator it = subtrees.begin() ; it != subtrees.end() ; ++it )
+        {
+            if ( it->second )
+                visitors::destroy<MembersHolder>::apply(it->second, m_allocators);
+        }
+        subtrees.clear();
+    }
+
+private:
+    // The highest subtree becomes the root, the old root is grafted
+    void set_highest_root(subtrees_type & subtrees)
+    {
+        typename subtrees_type::iterator highest
+            = std::max_element(subtrees.begin(), subtrees.end(), height_less());
+
+        if ( highest == subtrees.end() )
+            return;
+
+        if ( ! m_root )
+        {
+            m_root = highest->second;
+            m_leafs_level = highest->first - 1;
+            *highest = subtrees.back();
+            subtrees.pop_back();
+        }
+        else if ( m_leafs_level + 1 < highest->first
+               || ( m_leafs_level + 1 == highest->first
+                 && elements_count(m_root, m_leafs_level + 1) < m_parameters.get_min_elements()
+                 && m_parameters.get_min_elements() <= elements_count(highest->second, highest->first) ) )
+        {
+            std::pair<size_type, node_pointer> const old_root(m_leafs_level + 1, m_root);
+            m_root = highest->second;
+            m_leafs_level = highest->first - 1;
+            *highest = old_root;
+        }
+    }
+
+    // The root and the subtrees of the same height having at least Min elements
+    // become the children of a new root
+    void join_roots(subtrees_type & subtrees)
+    {
+        size_type const height = m_leafs_level + 1;
+        size_type const min_elements = m_parameters.get_min_elements();
+        size_type const max_elements = m_parameters.get_max_elements();
+
+        if ( elements_count(m_root, height) < min_elements )
+            return;
+
+        std::vector<size_type> joined;
+        for ( size_type i = 0 ; i < subtrees.size() && joined.size() + 1 < max_elements ; ++i )
+        {
+            if ( subtrees[i].first == height
+              && min_elements <= elements_count(subtrees[i].second, height) )
+            {
+                joined.push_back(i);                                                                // MAY THROW (A)
+            }
+        }
+
+        if ( joined.empty() )
+            return;
+
+        node_pointer new_root = rtree::create_node<allocators_type, internal_node>::apply(m_allocators); // MAY THROW (N: alloc)
+        internal_elements & children = rtree::elements(rtree::get<internal_node>(*new_root));
+
+        BOOST_TRY
+        {
+            children.push_back(internal_element(node_box(m_root, height), m_root));                // MAY THROW (E: alloc)
+            for ( size_type i = 0 ; i < joined.size() ; ++i )
+            {
+                node_pointer n = subtrees[joined[i]].second;
+                children.push_back(internal_element(node_box(n, height), n));                      // MAY THROW (E: alloc)
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            // the nodes are still owned by the tree and the container of subtrees
+            children.clear();
+            rtree::destroy_node<allocators_type, internal_node>::apply(m_allocators, new_root);
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        // the indexes are increasing so the back of the container is never a joined subtree
+        for ( size_type i = joined.size() ; 0 < i ; --i )
+        {
+            subtrees[joined[i - 1]] = subtrees.back();
+            subtrees.pop_back();
+        }
+
+        m_root = new_root;
+        ++m_leafs_level;
+    }
+
+    // Subtrees which are not lower than the root or have less than Min elements are replaced
+    // with their elements
+    void decompose(subtrees_type & subtrees, std::vector<value_type> & values)
+    {
+        size_type const min_elements = m_parameters.get_min_elements();
+
+        // the children are added at the end so they're checked as well
+        for ( size_type i = 0 ; i < subtrees.size() ; )
+        {
+            size_type const height = subtrees[i].first;
+            node_pointer n = subtrees[i].second;
+
+            if ( height <= m_leafs_level && min_elements <= elements_count(n, height) )
+            {
+                ++i;
+                continue;
+            }
+
+            if ( height == 1 )
+            {
+                leaf_elements & elements = rtree::elements(rtree::get<leaf>(*n));
+                for ( size_type j = 0 ; j < elements.size() ; ++j )
+                    values.push_back(std::move(elements[j]));                                       // MAY THROW (V: copy, E: alloc)
+                elements.clear();
+            }
+            else
+            {
+                internal_elements & elements = rtree::elements(rtree::get<internal_node>(*n));
+                subtrees.reserve(subtrees.size() + elements.size());                                // MAY THROW (A)
+                for ( size_type j = 0 ; j < elements.size() ; ++j )
+                    subtrees.push_back(std::make_pair(height - 1, elements[j].second));
+                elements.clear();
+            }
+
+            visitors::destroy<MembersHolder>::apply(n, m_allocators);
+            subtrees[i] = subtrees.back();
+            subtrees.pop_back();
+        }
+    }
+
+    // Inserts the subtrees level by level starting from the highest one and then the values
+    void insert(subtrees_type & subtrees, std::vector<value_type> & values)
+    {
+        std::sort(subtrees.begin(), subtrees.end(), height_greater());
+
+        bulk_insert<MembersHolder> insert_v(m_root, m_leafs_level, m_parameters, m_translator, m_allocators);
+
+        while ( ! subtrees.empty() )
+        {
+            size_type const height = subtrees.front().first;
+            typename subtrees_type::iterator last = subtrees.begin();
+            for ( ; last != subtrees.end() && last->first == height ; ++last ) {}
+
+            std::vector<internal_element> elements;
+            elements.reserve(last - subtrees.begin());                                              // MAY THROW (A)
+            for ( typename subtrees_type::iterator it = subtrees.begin() ; it != last ; ++it )
+                elements.push_back(internal_element(node_box(it->second, height), it->second));
+            subtrees.erase(subtrees.begin(), last);
+
+            // the nodes are owned by insert_v now
+            insert_v.apply(elements, height);                                                       // MAY THROW (E: alloc, N: alloc)
+        }
+
+        insert_v.apply(values, 0);                                                                  // MAY THROW (V, E: alloc, copy, N: alloc)
+    }
+
+    size_type elements_count(node_pointer n, size_type height) const
+    {
+        return height == 1
+             ? rtree::elements(rtree::get<leaf>(*n)).size()
+             : rtree::elements(rtree::get<internal_node>(*n)).size();
+    }
+
+    box_type node_box(node_pointer n, size_type height) const
+    {
+        auto const& strategy = index::detail::get_strategy(m_parameters);
+
+        if ( height == 1 )
+        {
+            leaf_elements const& elements = rtree::elements(rtree::get<leaf>(*n));
+            return rtree::values_box<box_type>(elements.begin(), elements.end(), m_translator, strategy);
+        }
+        else
+        {
+            internal_elements const& elements = rtree::elements(rtree::get<internal_node>(*n));
+            return rtree::elements_box<box_type>(elements.begin(), elements.end(), m_translator, strategy);
+        }
+    }
+
+    struct height_less
+    {
+        template <typename Pair>
+        bool operator()(Pair const& l, Pair const& r) const { return l.first < r.first; }
+    };
+
+    struct height_greater
+    {
+        template <typename Pair>
+        bool operator()(Pair const& l, Pair const& r) const { return l.first > r.first; }
+    };
+
+    node_pointer & m_root;
+    size_type & m_leafs_level;
+
+    parameters_type const& m_parameters;
+    translator_type const& m_translator;
+    allocators_type & m_allocators;
+};
+
+}}}}} // namespace boost::geometry::index::detail::rtree
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_GRAFT_HPP
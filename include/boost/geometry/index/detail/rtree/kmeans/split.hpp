@@ -2,7 +2,7 @@
 //
 // R-tree kmeans split algorithm implementation
 //
-// Copyright (c) 2011-2013 Adam Wulkiewicz, Lodz, Poland.
+// Copyright (c) 2011-2026 Adam Wulkiewicz, Lodz, Poland.
 //
 // This file was modified by Oracle on 2021.
 // Modifications copyright (c) 2021 Oracle and/or its affiliates.
@@ -15,57 +15,348 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_KMEANS_SPLIT_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_KMEANS_SPLIT_HPP
 
+#include <algorithm>
+#include <utility>
+
 #include <boost/container/static_vector.hpp>
 
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/arithmetic/arithmetic.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+
 #include <boost/geometry/index/detail/rtree/node/concept.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/rtree/options.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/insert.hpp>
 
 namespace boost { namespace geometry { namespace index {
 
 namespace detail { namespace rtree {
 
-// TODO: This should be defined in options.hpp
-// For now it's defined here to satisfy Boost header policy
-struct split_kmeans_tag {};
-
 namespace kmeans {
 
-// some details
+// The maximum number of iterations of the Lloyd's algorithm, the clusters of elements
+// of a node are usually stable after a few iterations
+static const std::size_t max_iterations = 8;
 
-} // namespace kmeans
+template <std::size_t I, std::size_t D>
+struct center
+{
+    template <typename Box, typename Point>
+    static inline void apply(Box const& b, Point & p)
+    {
+        typedef typename coordinate_type<Point>::type calc_t;
+        calc_t const c = (calc_t(geometry::get<min_corner, I>(b))
+                        + calc_t(geometry::get<max_corner, I>(b))) / calc_t(2);
+        geometry::set<I>(p, c);
+        center<I + 1, D>::apply(b, p);
+    }
+};
 
-// split_kmeans_tag
-// OR
-// split_clusters_tag and redistribute_kmeans_tag - then redistribute will probably slightly different interface
-// or some other than "redistribute"
-
-// 1. for this algorithm one probably MUST USE NON-STATIC NODES with node_default_tag
-//    or the algorithm must be changed somehow - to not store additional nodes in the current node
-//    but return excessive element/elements container instead (possibly pushable_array<1> or std::vector)
-//    this would also cause building of smaller trees since +1 element in nodes wouldn't be needed in different redistributing algorithms
-// 2. it is probably possible to add e.g. 2 levels of tree in one insert
-
-// Edge case is that every node split generates M + 1 children, in parent containing M nodes
-// result is 2M + 1 nodes in parent on this level
-// On next level the same, next the same and so on.
-// We have Depth*M+1 nodes in the root
-// The tree may then gain some > 1 levels in one insert
-// split::apply() manages this but special attention is required
-
-// which algorithm should be used to choose current node in traversing while inserting?
-// some of the currently used ones or some using mean values as well?
-
-// TODO
-// 1. Zmienic troche algorytm zeby przekazywal nadmiarowe elementy do split
-//    i pobieral ze split nadmiarowe elementy rodzica
-//    W zaleznosci od algorytmu w rozny sposob - l/q/r* powinny zwracac np pushable_array<1>
-//    wtedy tez is_overerflow (z R* insert?) bedzie nieportrzebne
-//    Dla kmeans zapewne std::vector, jednak w wezlach nadal moglaby byc pushable_array
-// 2. Fajnie byloby tez uproscic te wszystkie parametry root,parent,index itd. Mozliwe ze okazalyby sie zbedne
-// 3. Sprawdzyc czasy wykonywania i zajetosc pamieci
-// 4. Pamietac o parametryzacji kontenera z nadmiarowymi elementami
-// PS. Z R* reinsertami moze byc masakra
+template <std::size_t D>
+struct center<D, D>
+{
+    template <typename Box, typename Point>
+    static inline void apply(Box const& , Point & ) {}
+};
+
+template <std::size_t I, std::size_t D>
+struct comparable_distance
+{
+    template <typename Point>
+    static inline typename coordinate_type<Point>::type
+        apply(Point const& p1, Point const& p2)
+    {
+        typename coordinate_type<Point>::type const d
+            = geometry::get<I>(p1) - geometry::get<I>(p2);
+        return d * d + comparable_distance<I + 1, D>::apply(p1, p2);
+    }
+};
+
+template <std::size_t D>
+struct comparable_distance<D, D>
+{
+    template <typename Point>
+    static inline typename coordinate_type<Point>::type
+        apply(Point const& , Point const& )
+    {
+        return 0;
+    }
+};
+
+// The seeds are the extreme centers in the dimension of the greatest extent
+template <std::size_t I, std::size_t D>
+struct pick_seeds
+{
+    template <typename Centers, typename Coordinate>
+    static inline void apply(Centers const& centers, Coordinate & greatest_extent,
+                             std::size_t & seed1, std::size_t & seed2)
+    {
+        std::size_t lowest = 0;
+        std::size_t highest = 0;
+        for ( std::size_t i = 1 ; i < centers.size() ; ++i )
+        {
+            if ( geometry::get<I>(centers[i]) < geometry::get<I>(centers[lowest]) )
+                lowest = i;
+            if ( geometry::get<I>(centers[highest]) < geometry::get<I>(centers[i]) )
+                highest = i;
+        }
+
+        Coordinate const extent = geometry::get<I>(centers[highest])
+                                - geometry::get<I>(centers[lowest]);
+        if ( I == 0 || greatest_extent < extent )
+        {
+            greatest_extent = extent;
+            seed1 = lowest;
+            seed2 = highest;
+        }
+
+        pick_seeds<I + 1, D>::apply(centers, greatest_extent, seed1, seed2);
+    }
+};
+
+template <std::size_t D>
+struct pick_seeds<D, D>
+{
+    template <typename Centers, typename Coordinate>
+    static inline void apply(Centers const& , Coordinate & , std::size_t & , std::size_t & ) {}
+};
 
+template <typename MembersHolder>
+struct redistribute_elements
+{
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    static const std::size_t dimension = geometry::dimension<box_type>::value;
+    typedef typename geometry::select_most_precise
+        <
+            typename coordinate_type<box_type>::type, double
+        >::type calc_type;
+    typedef geometry::model::point<calc_type, dimension, cs::cartesian> center_type;
+
+    template <typename Node>
+    static inline void apply(Node & n,
+                             Node & second_node,
+                             box_type & box1,
+                             box_type & box2,
+                             parameters_type const& parameters,
+                             translator_type const& translator,
+                             allocators_type & allocators)
+    {
+        typedef typename rtree::elements_type<Node>::type elements_type;
+        typedef typename elements_type::value_type element_type;
+
+        elements_type & elements1 = rtree::elements(n);
+        elements_type & elements2 = rtree::elements(second_node);
+
+        BOOST_GEOMETRY_INDEX_ASSERT(elements1.size() == parameters.get_max_elements() + 1, "unexpected elements number");
+        BOOST_GEOMETRY_INDEX_ASSERT(elements2.empty(), "second node's elements container should be empty");
+
+        strategy_type const& strategy = index::detail::get_strategy(parameters);
+
+        // use in-memory storage (std::allocator)
+        typedef typename rtree::container_from_elements_type<elements_type, element_type>::type
+            container_type;
+        typedef typename rtree::container_from_elements_type<elements_type, center_type>::type
+            centers_type;
+        typedef typename rtree::container_from_elements_type<elements_type, bool>::type
+            groups_type;
+
+        // calculate centers of the bounding boxes of elements
+        centers_type centers;                                                                       // MAY THROW, STRONG (alloc)
+        centers.reserve(elements1.size());                                                          // MAY THROW, STRONG (alloc)
+        for ( element_type const& el : elements1 )
+        {
+            box_type b;
+            index::detail::bounds(rtree::element_indexable(el, translator), b, strategy);
+            center_type c;
+            kmeans::center<0, dimension>::apply(b, c);
+            centers.push_back(c);
+        }
+
+        // true if an element is in the first group
+        groups_type in_first(centers.size());                                                       // MAY THROW, STRONG (alloc)
+        std::fill(in_first.begin(), in_first.end(), true);
+        clusters(centers, in_first);
+        balance(centers, in_first, parameters.get_min_elements());                                  // MAY THROW, STRONG (alloc)
+
+        // copy original elements
+        // TODO: move if noexcept
+        container_type elements_backup(elements1.begin(), elements1.end());                         // MAY THROW, STRONG (alloc, copy)
+
+        elements1.clear();
+
+        BOOST_TRY
+        {
+            bool first_in_1 = true;
+            bool first_in_2 = true;
+            for ( std::size_t i = 0 ; i < elements_backup.size() ; ++i )
+            {
+                element_type const& el = elements_backup[i];
+                if ( in_first[i] )
+                {
+                    elements1.push_back(el);                                                        // MAY THROW, STRONG (copy)
+                    expand(box1, first_in_1, rtree::element_indexable(el, translator), strategy);
+                }
+                else
+                {
+                    elements2.push_back(el);                                                        // MAY THROW, STRONG (alloc, copy)
+                    expand(box2, first_in_2, rtree::element_indexable(el, translator), strategy);
+                }
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            elements1.clear();
+            elements2.clear();
+
+            rtree::destroy_elements<MembersHolder>::apply(elements_backup, allocators);
+
+            BOOST_RETHROW                                                                           // RETHROW, BASIC
+        }
+        BOOST_CATCH_END
+    }
+
+private:
+    // Lloyd's algorithm for two clusters
+    template <typename Centers, typename Groups>
+    static inline void clusters(Centers const& centers, Groups & in_first)
+    {
+        std::size_t seed1 = 0;
+        std::size_t seed2 = 0;
+        calc_type greatest_extent = 0;
+        kmeans::pick_seeds<0, dimension>::apply(centers, greatest_extent, seed1, seed2);
+
+        // all centers are equal
+        if ( seed1 == seed2 )
+            return;
+
+        center_type mean1 = centers[seed1];
+        center_type mean2 = centers[seed2];
+
+        for ( std::size_t iteration = 0 ; iteration < max_iterations ; ++iteration )
+        {
+            bool changed = false;
+            center_type sum1, sum2;
+            geometry::assign_zero(sum1);
+            geometry::assign_zero(sum2);
+            std::size_t count1 = 0;
+
+            for ( std::size_t i = 0 ; i < centers.size() ; ++i )
+            {
+                bool const first
+                    = kmeans::comparable_distance<0, dimension>::apply(centers[i], mean1)
+                   <= kmeans::comparable_distance<0, dimension>::apply(centers[i], mean2);
+                if ( iteration == 0 || first != in_first[i] )
+                {
+                    in_first[i] = first;
+                    changed = true;
+                }
+
+                if ( first )
+                {
+                    geometry::add_point(sum1, centers[i]);
+                    ++count1;
+                }
+                else
+                {
+                    geometry::add_point(sum2, centers[i]);
+                }
+            }
+
+            if ( ! changed )
+                break;
+
+            // the seeds are always in different groups so none of them is empty
+            geometry::divide_value(sum1, calc_type(count1));
+            geometry::divide_value(sum2, calc_type(centers.size() - count1));
+            mean1 = sum1;
+            mean2 = sum2;
+        }
+    }
+
+    // Moves the elements closest to the smaller group until it has min elements
+    template <typename Centers, typename Groups>
+    static inline void balance(Centers const& centers, Groups & in_first, std::size_t min_elements)
+    {
+        std::size_t const count1 = std::count(in_first.begin(), in_first.end(), true);
+        std::size_t const count2 = centers.size() - count1;
+
+        if ( min_elements <= count1 && min_elements <= count2 )
+            return;
+
+        bool const to_first = count1 < min_elements;
+        std::size_t const missing = min_elements - (to_first ? count1 : count2);
+
+        center_type mean1, mean2;
+        geometry::assign_zero(mean1);
+        geometry::assign_zero(mean2);
+        for ( std::size_t i = 0 ; i < centers.size() ; ++i )
+            geometry::add_point(in_first[i] ? mean1 : mean2, centers[i]);
+        if ( 0 < count1 )
+            geometry::divide_value(mean1, calc_type(count1));
+        if ( 0 < count2 )
+            geometry::divide_value(mean2, calc_type(count2));
+
+        center_type const& target_mean = to_first ? mean1 : mean2;
+        center_type const& source_mean = to_first ? mean2 : mean1;
+
+        // the cost of moving an element to the other group
+        typedef std::pair<calc_type, std::size_t> cost_type;
+        typedef typename rtree::container_from_elements_type<Centers, cost_type>::type costs_type;
+        costs_type costs;
+        costs.reserve(to_first ? count2 : count1);                                                  // MAY THROW, STRONG (alloc)
+        for ( std::size_t i = 0 ; i < centers.size() ; ++i )
+        {
+            if ( in_first[i] != to_first )
+            {
+                costs.push_back(cost_type(
+                    kmeans::comparable_distance<0, dimension>::apply(centers[i], target_mean)
+                  - kmeans::comparable_distance<0, dimension>::apply(centers[i], source_mean),
+                    i));
+            }
+        }
+
+        std::nth_element(costs.begin(), costs.begin() + missing, costs.end());
+        for ( std::size_t i = 0 ; i < missing ; ++i )
+            in_first[costs[i].second] = to_first;
+    }
+
+    template <typename Indexable>
+    static inline void expand(box_type & box, bool & is_first,
+                              Indexable const& indexable, strategy_type const& strategy)
+    {
+        if ( is_first )
+        {
+            index::detail::bounds(indexable, box, strategy);
+            is_first = false;
+        }
+        else
+        {
+            index::detail::expand(box, indexable, strategy);
+        }
+    }
+};
+
+} // namespace kmeans
+
+// Splits the node into two groups of elements which centers are close to each other. The
+// groups are found with the Lloyd's algorithm for two clusters seeded with the extreme
+// elements in the dimension of the greatest spread. If one of the groups has less than
+// min elements, the closest elements of the other group are moved to it.
+// The cost is linear WRT the number of elements.
 template <typename MembersHolder>
 class split<MembersHolder, split_kmeans_tag>
 {
@@ -80,6 +371,8 @@ protected:
     typedef typename MembersHolder::internal_node internal_node;
     typedef typename MembersHolder::leaf leaf;
 
+    typedef typename MembersHolder::node_pointer node_pointer;
+
 public:
     using nodes_container_type = boost::container::static_vector
         <
@@ -95,7 +388,46 @@ public:
                              translator_type const& translator,
                              allocators_type & allocators)
     {
+        // create additional node, use auto destroyer for automatic destruction on exception
+        node_pointer n2_ptr = rtree::create_node<allocators_type, Node>::apply(allocators);                  // MAY THROW, STRONG (N: alloc)
+        // create reference to the newly created node
+        Node & n2 = rtree::get<Node>(*n2_ptr);
+
+        BOOST_TRY
+        {
+            // redistribute elements
+            box_type box2;
+            kmeans::redistribute_elements<MembersHolder>
+                ::apply(n, n2, n_box, box2, parameters, translator, allocators);                                   // MAY THROW (V, E: alloc, copy, copy)
+
+            // check numbers of elements
+            BOOST_GEOMETRY_INDEX_ASSERT(parameters.get_min_elements() <= rtree::elements(n).size() &&
+                rtree::elements(n).size() <= parameters.get_max_elements(),
+                "unexpected number of elements");
+            BOOST_GEOMETRY_INDEX_ASSERT(parameters.get_min_elements() <= rtree::elements(n2).size() &&
+                rtree::elements(n2).size() <= parameters.get_max_elements(),
+                "unexpected number of elements");
+
+            // return the list of newly created nodes (this algorithm returns one)
+            additional_nodes.push_back(rtree::make_ptr_pair(box2, n2_ptr));                                  // MAY THROW, STRONG (alloc, copy)
+        }
+        BOOST_CATCH(...)
+        {
+            // NOTE: The same as in the default split, prevents leaving the node
+            //  with more than max elements.
+            typename rtree::elements_type<Node>::type & elements = rtree::elements(n);
+            size_type const max_size = parameters.get_max_elements();
+            if (elements.size() > max_size)
+            {
+                rtree::destroy_element<MembersHolder>::apply(elements[max_size], allocators);
+                elements.pop_back();
+            }
+
+            rtree::visitors::destroy<MembersHolder>::apply(n2_ptr, allocators);
 
+            BOOST_RETHROW
+        }
+        BOOST_CATCH_END
     }
 };
 
@@ -31,12 +31,13 @@ struct choose_by_overlap_diff_tag {};
 
 // SplitTag
 struct split_default_tag {};
-//struct split_kmeans_tag {};
+struct split_kmeans_tag {};
 
 // RedistributeTag
 struct linear_tag {};
 struct quadratic_tag {};
 struct rstar_tag {};
+struct kmeans_tag {};
 
 // NodeTag
 struct node_variant_dynamic_tag {};
@@ -100,18 +101,18 @@ struct options_type< index::rstar<MaxElements, MinElements, OverlapCostThreshold
     > type;
 };
 
-//template <size_t MaxElements, size_t MinElements>
-//struct options_type< kmeans<MaxElements, MinElements> >
-//{
-//    typedef options<
-//        kmeans<MaxElements, MinElements>,
-//        insert_default_tag,
-//        choose_by_content_diff_tag, // change it?
-//        split_kmeans_tag,
-//        int, // dummy tag - not used for now
-//        node_variant_static_tag
-//    > type;
-//};
+template <size_t MaxElements, size_t MinElements>
+struct options_type< index::kmeans<MaxElements, MinElements> >
+{
+    typedef options<
+        index::kmeans<MaxElements, MinElements>,
+        insert_default_tag,
+        choose_by_content_diff_tag,
+        split_kmeans_tag,
+        kmeans_tag,
+        node_variant_static_tag
+    > type;
+};
 
 template <>
 struct options_type< index::dynamic_linear >
@@ -114,8 +114,46 @@ struct nth_element_and_half_boxes<Dimension, Dimension>
     static inline void apply(EIt , EIt , EIt , Box const& , Box & , Box & , std::size_t ) {}
 };
 
+// The whole tree is created by the calling thread
+struct sequential_packing {};
+
+// Packs the halves of the values of a node one after another.
+// Specialized for index::parallel_packing in pack_create_parallel.hpp.
+template <typename Pack, typename Packing>
+struct pack_halves
+{
+    template <typename EIt, typename Box, typename Size, typename Counts,
+              typename Elements, typename ExpandableBox, typename Parameters,
+              typename Translator, typename Allocators> inline static
+    void apply(EIt first, EIt median, EIt last,
+               Box const& left, Box const& right,
+               Size values_count, Size median_count,
+               Counts const& subtree_counts, Counts const& next_subtree_counts,
+               Elements & elements, ExpandableBox & elements_box,
+               Parameters const& parameters, Translator const& translator,
+               Allocators & allocators, Packing const& packing)
+    {
+        Pack::per_level_packets(first, median, left,
+                                median_count, subtree_counts, next_subtree_counts,
+                                elements, elements_box,
+                                parameters, translator, allocators, packing);
+        Pack::per_level_packets(median, last, right,
+                                values_count - median_count, subtree_counts, next_subtree_counts,
+                                elements, elements_box,
+                                parameters, translator, allocators, packing);
+    }
+};
+
 } // namespace pack_utils
 
+// True if the nodes may be created by many threads using the same allocators.
+// Specialized for the allocators of index::arena_allocator.
+template <typename Allocators, typename Enable = void>
+struct is_thread_safe_allocators
+{
+    static const bool value = true;
+};
+
 // STR leafs number are calculated as rcount/max
 // and the number of splitting planes for each dimension as (count/max)^(1/dimension)
 // <-> for dimension==2 -> sqrt(count/max)
@@ -173,6 +211,9 @@ class pack
 
     typedef rtree::subtree_destroyer<MembersHolder> subtree_destroyer;
 
+    template <typename Pack, typename Packing>
+    friend struct pack_utils::pack_halves;
+
 public:
     // Arbitrary iterators
     template <typename InIt> inline static
@@ -195,6 +236,21 @@ public:
                        translator_type const& translator,
                        allocators_type & allocators,
                        TmpAlloc const& temp_allocator)
+    {
+        return apply(first, last, values_count, leafs_level, parameters, translator,
+                     allocators, temp_allocator, pack_utils::sequential_packing());
+    }
+
+    // The packing policy, e.g. index::parallel_packing, is passed down the tree
+    template <typename InIt, typename TmpAlloc, typename Packing> inline static
+    node_pointer apply(InIt first, InIt last,
+                       size_type & values_count,
+                       size_type & leafs_level,
+                       parameters_type const& parameters,
+                       translator_type const& translator,
+                       allocators_type & allocators,
+                       TmpAlloc const& temp_allocator,
+                       Packing const& packing)
     {
         typedef typename std::iterator_traits<InIt>::difference_type diff_type;
 
@@ -237,7 +293,7 @@ public:
 
         subtree_elements_counts subtree_counts = calculate_subtree_elements_counts(values_count, parameters, leafs_level);
         internal_element el = per_level(entries.begin(), entries.end(), hint_box.get(), values_count, subtree_counts,
-                                        parameters, translator, allocators);
+                                        parameters, translator, allocators, packing);
 
         return el.second;
     }
@@ -299,14 +355,15 @@ private:
         size_type minc;
     };
 
-    template <typename EIt> inline static
+    template <typename EIt, typename Packing> inline static
     internal_element per_level(EIt first, EIt last,
                                box_type const& hint_box,
                                size_type values_count,
                                subtree_elements_counts const& subtree_counts,
                                parameters_type const& parameters,
                                translator_type const& translator,
-                               allocators_type & allocators)
+                               allocators_type & allocators,
+                               Packing const& packing)
     {
         BOOST_GEOMETRY_INDEX_ASSERT(0 < std::distance(first, last) && static_cast<size_type>(std::distance(first, last)) == values_count,
                                     "unexpected parameters");
@@ -378,23 +435,24 @@ private:
 
         per_level_packets(first, last, hint_box, values_count, subtree_counts, next_subtree_counts,
                           rtree::elements(in), elements_box,
-                          parameters, translator, allocators);
+                          parameters, translator, allocators, packing);
 
         auto_remover.release();
         return internal_element(elements_box.get(), n);
     }
 
-    template <typename EIt, typename ExpandableBox> inline static
+    template <typename EIt, typename Elements, typename ExpandableBox, typename Packing> inline static
     void per_level_packets(EIt first, EIt last,
                            box_type const& hint_box,
                            size_type values_count,
                            subtree_elements_counts const& subtree_counts,
                            subtree_elements_counts const& next_subtree_counts,
-                           internal_elements & elements,
+                           Elements & elements,
                            ExpandableBox & elements_box,
                            parameters_type const& parameters,
                            translator_type const& translator,
-                           allocators_type & allocators)
+                           allocators_type & allocators,
+                           Packing const& packing)
     {
         BOOST_GEOMETRY_INDEX_ASSERT(0 < std::distance(first, last) && static_cast<size_type>(std::distance(first, last)) == values_count,
                                     "unexpected parameters");
@@ -407,7 +465,7 @@ private:
         {
             // the end, move to the next level
             internal_element el = per_level(first, last, hint_box, values_count, next_subtree_counts,
-                                            parameters, translator, allocators);
+                                            parameters, translator, allocators, packing);
 
             // in case if push_back() do throw here
             // and even if this is not probable (previously reserved memory, nonthrowing pairs copy)
@@ -431,14 +489,11 @@ private:
         pack_utils::nth_element_and_half_boxes<0, dimension>
             ::apply(first, median, last, hint_box, left, right, greatest_dim_index);
 
-        per_level_packets(first, median, left,
-                          median_count, subtree_counts, next_subtree_counts,
-                          elements, elements_box,
-                          parameters, translator, allocators);
-        per_level_packets(median, last, right,
-                          values_count - median_count, subtree_counts, next_subtree_counts,
-                          elements, elements_box,
-                          parameters, translator, allocators);
+        pack_utils::pack_halves<pack, Packing>
+            ::apply(first, median, last, left, right,
+                    values_count, median_count, subtree_counts, next_subtree_counts,
+                    elements, elements_box,
+                    parameters, translator, allocators, packing);
     }
 
     inline static
@@ -0,0 +1,136 @@
+// Boost.Geometry Index
+//
+// R-tree initial packing using many threads
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_CREATE_PARALLEL_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_CREATE_PARALLEL_HPP
+
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/rtree/pack_create.hpp>
+#include <boost/geometry/index/parallel_packing.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
+
+namespace pack_utils {
+
+// The right half is packed by a new thread into a temporary container while the left half
+// is packed by the current thread. Then the elements of the right half are added to the node
+// in the same order as the sequential algorithm would add them so the trees are the same.
+template <typename MembersHolder>
+struct pack_halves<pack<MembersHolder>, index::parallel_packing>
+{
+    typedef pack<MembersHolder> pack_type;
+
+    template <typename EIt, typename Box, typename Size, typename Counts,
+              typename Elements, typename ExpandableBox, typename Parameters,
+              typename Translator, typename Allocators> inline static
+    void apply(EIt first, EIt median, EIt last,
+               Box const& left, Box const& right,
+               Size values_count, Size median_count,
+               Counts const& subtree_counts, Counts const& next_subtree_counts,
+               Elements & elements, ExpandableBox & elements_box,
+               Parameters const& parameters, Translator const& translator,
+               Allocators & allocators, index::parallel_packing const& packing)
+    {
+        typedef typename pack_type::internal_element internal_element;
+        typedef typename pack_type::template expandable_box
+            <
+                typename pack_type::box_type, typename pack_type::strategy_type
+            > expandable_box;
+
+        std::size_t threads = packing.get_threads();
+        if ( threads == 0 )
+            threads = std::thread::hardware_concurrency();
+
+        // The resulting tree is the same so it's created sequentially if the allocators
+        // can't be used concurrently
+        if ( threads <= 1 || ! is_thread_safe_allocators<Allocators>::value )
+        {
+            pack_halves<pack_type, sequential_packing>
+                ::apply(first, median, last, left, right,
+                        values_count, median_count, subtree_counts, next_subtree_counts,
+                        elements, elements_box,
+                        parameters, translator, allocators, sequential_packing());
+            return;
+        }
+
+        index::parallel_packing const left_packing(threads / 2);
+        index::parallel_packing const right_packing(threads - threads / 2);
+        Size const right_count = values_count - median_count;
+
+        std::vector<internal_element> right_elements;
+        right_elements.reserve(pack_type::calculate_nodes_count(right_count, subtree_counts));         // MAY THROW (A)
+
+        std::future<void> right_future = std::async(std::launch::async, [&]()                         // MAY THROW (system_error)
+        {
+            expandable_box right_box(detail::get_strategy(parameters));
+
+            BOOST_TRY
+            {
+                pack_type::per_level_packets(median, last, right,
+                                             right_count, subtree_counts, next_subtree_counts,
+                                             right_elements, right_box,
+                                             parameters, translator, allocators, right_packing); // MAY THROW (A,C)
+            }
+            BOOST_CATCH(...)
+            {
+                rtree::destroy_elements<MembersHolder>::apply(right_elements, allocators);
+                right_elements.clear();
+                BOOST_RETHROW                                                                   // RETHROW
+            }
+            BOOST_CATCH_END
+        });
+
+        BOOST_TRY
+        {
+            pack_type::per_level_packets(first, median, left,
+                                         median_count, subtree_counts, next_subtree_counts,
+                                         elements, elements_box,
+                                         parameters, translator, allocators, left_packing);      // MAY THROW (A,C)
+        }
+        BOOST_CATCH(...)
+        {
+            // wait for the other thread and destroy the subtrees it has created
+            right_future.wait();
+            rtree::destroy_elements<MembersHolder>::apply(right_elements, allocators);
+            BOOST_RETHROW                                                                       // RETHROW
+        }
+        BOOST_CATCH_END
+
+        right_future.get();                                                                     // MAY THROW (exception thrown in the other thread)
+
+        typename std::vector<internal_element>::iterator it = right_elements.begin();
+        BOOST_TRY
+        {
+            for ( ; it != right_elements.end() ; ++it )
+            {
+                // this container should have memory allocated, reserve() called outside
+                elements.push_back(*it);                                                        // MAY THROW (A?,C) - however in normal conditions shouldn't
+                elements_box.expand(it->first);
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            rtree::destroy_elements<MembersHolder>::apply(it, right_elements.end(), allocators);
+            BOOST_RETHROW                                                                       // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+};
+
+} // namespace pack_utils
+
+}}}}} // namespace boost::geometry::index::detail::rtree
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_CREATE_PARALLEL_HPP
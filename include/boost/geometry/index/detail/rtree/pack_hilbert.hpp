@@ -0,0 +1,500 @@
+// Boost.Geometry Index
+//
+// R-tree Hilbert curve packing
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_HILBERT_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_HILBERT_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include <boost/container/allocator_traits.hpp>
+
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/detail/expand_by_epsilon.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+
+#include <boost/geometry/index/detail/assert.hpp>
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/algorithms/is_valid.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/rtree/node/subtree_destroyer.hpp>
+#include <boost/geometry/index/parameters.hpp>
+
+#include <boost/geometry/util/constexpr.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
+
+namespace pack_utils {
+
+// Calculates the index of a cell on the Hilbert curve filling the grid of 2^bits cells
+// in each dimension, see: J. Skilling, Programming the Hilbert curve (2004).
+// The coordinates of the cell are modified.
+template <std::size_t Dimension>
+struct hilbert_index
+{
+    static inline std::uint64_t apply(std::uint64_t (&x)[Dimension], std::size_t bits)
+    {
+        std::uint64_t const m = std::uint64_t(1) << (bits - 1);
+
+        // inverse undo excess work
+        // the bits are random so the branches are replaced with masks
+        for ( std::uint64_t q = m ; q > 1 ; q >>= 1 )
+        {
+            std::uint64_t const p = q - 1;
+            for ( std::size_t i = 0 ; i < Dimension ; ++i )
+            {
+                // if bit q of x[i] is set invert the low bits of x[0],
+                // otherwise exchange the low bits of x[0] and x[i]
+                std::uint64_t const set = std::uint64_t(0) - ((x[i] & q) != 0 ? 1u : 0u);
+                std::uint64_t const t = (x[0] ^ x[i]) & p & ~set;
+                x[0] ^= (p & set) | t;
+                x[i] ^= t;
+            }
+        }
+
+        // gray encode
+        for ( std::size_t i = 1 ; i < Dimension ; ++i )
+        {
+            x[i] ^= x[i - 1];
+        }
+        std::uint64_t t = 0;
+        for ( std::uint64_t q = m ; q > 1 ; q >>= 1 )
+        {
+            t ^= (q - 1) & (std::uint64_t(0) - ((x[Dimension - 1] & q) != 0 ? 1u : 0u));
+        }
+        for ( std::size_t i = 0 ; i < Dimension ; ++i )
+        {
+            x[i] ^= t;
+        }
+
+        // interleave the bits of the transposed index
+        std::uint64_t result = 0;
+        for ( std::size_t b = bits ; b > 0 ; --b )
+        {
+            for ( std::size_t i = 0 ; i < Dimension ; ++i )
+            {
+                result = (result << 1) | ((x[i] >> (b - 1)) & 1);
+            }
+        }
+        return result;
+    }
+};
+
+// In 2D the index is calculated for all bits in parallel with a prefix scan of the states
+// of the curve, without loops, for at most 16 bits per coordinate.
+template <>
+struct hilbert_index<2>
+{
+    static inline std::uint64_t apply(std::uint64_t (&xy)[2], std::size_t bits)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(0 < bits && bits <= 16, "unexpected number of bits");
+
+        std::uint32_t const x = static_cast<std::uint32_t>(xy[0]) << (16 - bits);
+        std::uint32_t const y = static_cast<std::uint32_t>(xy[1]) << (16 - bits);
+
+        std::uint32_t A, B, C, D;
+
+        // initial round
+        {
+            std::uint32_t const a = x ^ y;
+            std::uint32_t const b = 0xFFFF ^ a;
+            std::uint32_t const c = 0xFFFF ^ (x | y);
+            std::uint32_t const d = x & (y ^ 0xFFFF);
+
+            A = a | (b >> 1);
+            B = (a >> 1) ^ a;
+            C = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+            D = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+        }
+
+        prefix_scan_round(A, B, C, D, 2);
+        prefix_scan_round(A, B, C, D, 4);
+
+        // final round
+        {
+            std::uint32_t const a = A, b = B, c = C, d = D;
+            C ^= (a & (c >> 8)) ^ (b & (d >> 8));
+            D ^= (b & (c >> 8)) ^ ((a ^ b) & (d >> 8));
+        }
+
+        // undo the transformation of the prefix scan and recover the bits of the index
+        std::uint32_t const a = C ^ (C >> 1);
+        std::uint32_t const b = D ^ (D >> 1);
+        std::uint32_t const i0 = x ^ y;
+        std::uint32_t const i1 = b | (0xFFFF ^ (i0 | a));
+
+        return ((interleave(i1) << 1) | interleave(i0)) >> (32 - 2 * bits);
+    }
+
+private:
+    static inline void prefix_scan_round(std::uint32_t & A, std::uint32_t & B,
+                                         std::uint32_t & C, std::uint32_t & D,
+                                         std::size_t shift)
+    {
+        std::uint32_t const a = A, b = B, c = C, d = D;
+        A = (a & (a >> shift)) ^ (b & (b >> shift));
+        B = (a & (b >> shift)) ^ (b & ((a ^ b) >> shift));
+        C ^= (a & (c >> shift)) ^ (b & (d >> shift));
+        D ^= (b & (c >> shift)) ^ ((a ^ b) & (d >> shift));
+    }
+
+    static inline std::uint32_t interleave(std::uint32_t x)
+    {
+        x = (x | (x << 8)) & 0x00FF00FF;
+        x = (x | (x << 4)) & 0x0F0F0F0F;
+        x = (x | (x << 2)) & 0x33333333;
+        x = (x | (x << 1)) & 0x55555555;
+        return x;
+    }
+};
+
+// Calculates the coordinates of the grid cell containing the point, the grid covers the box
+template <std::size_t I, std::size_t Dimension>
+struct hilbert_cell
+{
+    template <typename Point, typename Box>
+    static inline void apply(Point const& pt, Box const& box, std::size_t bits,
+                             std::uint64_t (&x)[Dimension])
+    {
+        double const mi = static_cast<double>(geometry::get<min_corner, I>(box));
+        double const ma = static_cast<double>(geometry::get<max_corner, I>(box));
+        double const c = static_cast<double>(geometry::get<I>(pt));
+        std::uint64_t const max_cell = (std::uint64_t(1) << bits) - 1;
+
+        x[I] = 0;
+        if ( mi < ma )
+        {
+            double const f = (c - mi) / (ma - mi) * static_cast<double>(max_cell);
+            x[I] = f <= 0 ? 0
+                 : f >= static_cast<double>(max_cell) ? max_cell
+                 : static_cast<std::uint64_t>(f);
+        }
+
+        hilbert_cell<I + 1, Dimension>::apply(pt, box, bits, x);
+    }
+};
+
+template <std::size_t Dimension>
+struct hilbert_cell<Dimension, Dimension>
+{
+    template <typename Point, typename Box>
+    static inline void apply(Point const& , Box const& , std::size_t , std::uint64_t (&)[Dimension]) {}
+};
+
+struct hilbert_entries_comparer
+{
+    template <typename Entry>
+    bool operator()(Entry const& e1, Entry const& e2) const
+    {
+        return e1.first < e2.first;
+    }
+};
+
+} // namespace pack_utils
+
+// Hilbert curve packing
+//
+// Values are sorted by the Hilbert index of the centroids of their indexables calculated
+// for the grid covering the bounds of all centroids. Then the leafs are filled with
+// consecutive values and the nodes of each next level are filled with consecutive nodes
+// of the previous level until the root is created.
+//
+// The elements are distributed evenly between the nodes of a level so the number of elements
+// in nodes is between Min and Max, e.g. for 177 values Max = 5 and Min = 2 the leafs level
+// contains 36 nodes, 33 with 5 values and 3 with 4 values.
+
+template <typename MembersHolder>
+class pack_hilbert
+{
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename MembersHolder::node_pointer node_pointer;
+    typedef typename MembersHolder::size_type size_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename geometry::point_type<box_type>::type point_type;
+    static const std::size_t dimension = geometry::dimension<point_type>::value;
+
+    typedef typename rtree::elements_type<internal_node>::type internal_elements;
+    typedef typename internal_elements::value_type internal_element;
+
+    typedef rtree::subtree_destroyer<MembersHolder> subtree_destroyer;
+
+    static_assert(0 < dimension && dimension <= 64, "Unsupported dimension.");
+
+    // the number of bits of the Hilbert index of each coordinate,
+    // 2^16 cells in each dimension is enough to order the values
+    static const std::size_t bits = 64 / dimension < 16 ? 64 / dimension : 16;
+
+public:
+    template <typename InIt, typename TmpAlloc> inline static
+    node_pointer apply(InIt first, InIt last,
+                       size_type & values_count,
+                       size_type & leafs_level,
+                       parameters_type const& parameters,
+                       translator_type const& translator,
+                       allocators_type & allocators,
+                       TmpAlloc const& temp_allocator)
+    {
+        typedef typename std::iterator_traits<InIt>::difference_type diff_type;
+
+        diff_type diff = std::distance(first, last);
+        if ( diff <= 0 )
+            return node_pointer(0);
+
+        typedef std::pair<std::uint64_t, InIt> entry_type;
+        typedef typename boost::container::allocator_traits<TmpAlloc>::
+            template rebind_alloc<entry_type> temp_entry_allocator_type;
+        typedef typename boost::container::allocator_traits<TmpAlloc>::
+            template rebind_alloc<point_type> temp_point_allocator_type;
+        typedef typename boost::container::allocator_traits<TmpAlloc>::
+            template rebind_alloc<internal_element> temp_element_allocator_type;
+        typedef std::vector<internal_element, temp_element_allocator_type> temp_elements;
+
+        temp_entry_allocator_type temp_entry_allocator(temp_allocator);
+        std::vector<entry_type, temp_entry_allocator_type> entries(temp_entry_allocator);
+
+        values_count = static_cast<size_type>(diff);
+        leafs_level = 0;
+        entries.reserve(values_count);                                                              // MAY THROW (A)
+
+        auto const& strategy = index::detail::get_strategy(parameters);
+
+        // calculate the Hilbert indexes of centroids
+        {
+            temp_point_allocator_type temp_point_allocator(temp_allocator);
+            std::vector<point_type, temp_point_allocator_type> centroids(temp_point_allocator);
+            centroids.reserve(values_count);                                                        // MAY THROW (A)
+
+            // initialize the box explicitly to avoid uninitialized variable warnings
+            box_type centroids_box;
+            {
+                point_type pt;
+                geometry::centroid(translator(*first), pt, strategy);
+                detail::bounds(pt, centroids_box, strategy);
+            }
+
+            for ( InIt it = first ; it != last ; ++it )
+            {
+                // NOTE: support for iterators not returning true references, see pack::apply()
+                typename std::iterator_traits<InIt>::reference in_ref = *it;
+                typename translator_type::result_type indexable = translator(in_ref);
+
+                // NOTE: added for consistency with insert()
+                BOOST_GEOMETRY_INDEX_ASSERT(detail::is_valid(indexable), "Indexable is invalid");
+
+                point_type pt;
+                geometry::centroid(indexable, pt, strategy);
+                detail::expand(centroids_box, pt, strategy);
+
+                centroids.push_back(pt);
+                entries.push_back(std::make_pair(std::uint64_t(0), it));
+            }
+
+            for ( size_type i = 0 ; i < values_count ; ++i )
+            {
+                std::uint64_t cell[dimension];
+                pack_utils::hilbert_cell<0, dimension>::apply(centroids[i], centroids_box, bits, cell);
+                entries[i].first = pack_utils::hilbert_index<dimension>::apply(cell, bits);
+            }
+        }
+
+        std::sort(entries.begin(), entries.end(), pack_utils::hilbert_entries_comparer());
+
+        temp_element_allocator_type temp_element_allocator(temp_allocator);
+        temp_elements children(temp_element_allocator);
+        temp_elements parents(temp_element_allocator);
+
+        create_leafs(entries.begin(), entries.end(), children,
+                     parameters, translator, allocators);                                           // MAY THROW (A,C)
+
+        while ( 1 < children.size() )
+        {
+            create_parents(children, parameters, allocators, parents);                              // MAY THROW (A,C)
+            children.swap(parents);
+            parents.clear();
+            ++leafs_level;
+        }
+
+        return children.front().second;
+    }
+
+private:
+    inline static size_type calculate_nodes_count(size_type count, parameters_type const& parameters)
+    {
+        size_type const max_count = parameters.get_max_elements();
+        return (count + max_count - 1) / max_count;
+    }
+
+    // The number of elements in i-th node if count elements are distributed evenly between nodes
+    inline static size_type calculate_node_size(size_type count, size_type nodes_count, size_type i)
+    {
+        return count / nodes_count + (i < count % nodes_count ? 1 : 0);
+    }
+
+    template <typename EIt, typename Elements> inline static
+    void create_leafs(EIt first, EIt last,
+                      Elements & leafs,
+                      parameters_type const& parameters,
+                      translator_type const& translator,
+                      allocators_type & allocators)
+    {
+        size_type const values_count = static_cast<size_type>(std::distance(first, last));
+        size_type const nodes_count = calculate_nodes_count(values_count, parameters);
+        leafs.reserve(nodes_count);                                                                 // MAY THROW (A)
+
+        BOOST_TRY
+        {
+            for ( size_type i = 0 ; i < nodes_count ; ++i )
+            {
+                EIt node_last = first + calculate_node_size(values_count, nodes_count, i);
+                create_leaf(first, node_last, leafs, parameters, translator, allocators);           // MAY THROW (A,C)
+                first = node_last;
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            rtree::destroy_elements<MembersHolder>::apply(leafs, allocators);
+            leafs.clear();
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+    template <typename EIt, typename Elements> inline static
+    void create_leaf(EIt first, EIt last,
+                     Elements & leafs,
+                     parameters_type const& parameters,
+                     translator_type const& translator,
+                     allocators_type & allocators)
+    {
+        auto const& strategy = index::detail::get_strategy(parameters);
+
+        node_pointer n = rtree::create_node<allocators_type, leaf>::apply(allocators);              // MAY THROW (A)
+        subtree_destroyer auto_remover(n, allocators);
+        leaf & l = rtree::get<leaf>(*n);
+
+        rtree::elements(l).reserve(static_cast<size_type>(std::distance(first, last)));             // MAY THROW (A)
+
+        // NOTE: push_back() must be called at the end in order to support move_iterator.
+        //       The iterator is dereferenced 2x (no temporary reference) to support
+        //       non-true reference types and move_iterator without std::forward<>.
+        box_type elements_box;
+        detail::bounds(translator(*(first->second)), elements_box, strategy);
+        rtree::elements(l).push_back(*(first->second));                                             // MAY THROW (A?,C)
+        for ( ++first ; first != last ; ++first )
+        {
+            detail::expand(elements_box, translator(*(first->second)), strategy);
+            rtree::elements(l).push_back(*(first->second));                                         // MAY THROW (A?,C)
+        }
+
+#ifdef BOOST_GEOMETRY_INDEX_EXPERIMENTAL_ENLARGE_BY_EPSILON
+        // Enlarge bounds of a leaf node, see pack::per_level()
+        if BOOST_GEOMETRY_CONSTEXPR (! index::detail::is_bounding_geometry
+                                        <
+                                            typename indexable_type<translator_type>::type
+                                        >::value)
+        {
+            geometry::detail::expand_by_epsilon(elements_box);
+        }
+#endif
+
+        // this container should have memory allocated, reserve() called outside
+        leafs.push_back(internal_element(elements_box, n));                                         // MAY THROW (A?,C) - however in normal conditions shouldn't
+        auto_remover.release();
+    }
+
+    // Creates the nodes of the next level. The ownership of children is moved to the created
+    // nodes. If an exception is thrown all of the nodes are destroyed and both containers
+    // are cleared.
+    template <typename Elements> inline static
+    void create_parents(Elements & children,
+                        parameters_type const& parameters,
+                        allocators_type & allocators,
+                        Elements & parents)
+    {
+        size_type const children_count = static_cast<size_type>(children.size());
+        size_type const nodes_count = calculate_nodes_count(children_count, parameters);
+
+        typename Elements::iterator first = children.begin();
+
+        BOOST_TRY
+        {
+            parents.reserve(nodes_count);                                                           // MAY THROW (A)
+
+            for ( size_type i = 0 ; i < nodes_count ; ++i )
+            {
+                typename Elements::iterator node_last
+                    = first + calculate_node_size(children_count, nodes_count, i);
+                create_parent(first, node_last, parents, parameters, allocators);                   // MAY THROW (A)
+                first = node_last;
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            rtree::destroy_elements<MembersHolder>::apply(parents, allocators);
+            rtree::destroy_elements<MembersHolder>::apply(first, children.end(), allocators);
+            parents.clear();
+            children.clear();
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+    // If an exception is thrown the ownership of children is not moved.
+    template <typename It, typename Elements> inline static
+    void create_parent(It first, It last,
+                       Elements & parents,
+                       parameters_type const& parameters,
+                       allocators_type & allocators)
+    {
+        auto const& strategy = index::detail::get_strategy(parameters);
+
+        node_pointer n = rtree::create_node<allocators_type, internal_node>::apply(allocators);     // MAY THROW (A)
+        subtree_destroyer auto_remover(n, allocators);
+        internal_node & in = rtree::get<internal_node>(*n);
+
+        rtree::elements(in).reserve(static_cast<size_type>(std::distance(first, last)));            // MAY THROW (A)
+
+        box_type elements_box = first->first;
+        BOOST_TRY
+        {
+            for ( ; first != last ; ++first )
+            {
+                // this container should have memory allocated, reserve() called outside
+                rtree::elements(in).push_back(*first);                                              // MAY THROW (A?,C) - however in normal conditions shouldn't
+                detail::expand(elements_box, first->first, strategy);
+            }
+
+            // this container should have memory allocated, reserve() called outside
+            parents.push_back(internal_element(elements_box, n));                                   // MAY THROW (A?,C) - however in normal conditions shouldn't
+        }
+        BOOST_CATCH(...)
+        {
+            // the children are still owned by the caller
+            rtree::elements(in).clear();
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        auto_remover.release();
+    }
+};
+
+}}}}} // namespace boost::geometry::index::detail::rtree
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_HILBERT_HPP
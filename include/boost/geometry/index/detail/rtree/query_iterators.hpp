@@ -130,12 +130,18 @@ private:
     visitors::spatial_query_incremental<MembersHolder, Predicates> m_impl;
 };
 
+template <typename Value, typename Allocators>
+class query_iterator;
+
 template <typename MembersHolder, typename Predicates>
 class distance_query_iterator
 {
     typedef typename MembersHolder::allocators_type allocators_type;
+    typedef visitors::distance_query_incremental<MembersHolder, Predicates> impl_type;
 
 public:
+    typedef typename impl_type::workspace_type workspace_type;
+
     typedef std::forward_iterator_tag iterator_category;
     typedef typename MembersHolder::value_type value_type;
     typedef typename allocators_type::const_reference reference;
@@ -154,6 +160,12 @@ public:
         m_impl.initialize(members);
     }
 
+    distance_query_iterator(MembersHolder const& members, Predicates const& pred, workspace_type & workspace)
+        : m_impl(members, pred, workspace)
+    {
+        m_impl.initialize(members);
+    }
+
     reference operator*() const
     {
         return m_impl.dereference();
@@ -192,8 +204,19 @@ public:
         return r.m_impl.is_end();
     }
 
+    // Compared with the type-erased iterator without converting, e.g. with the one returned by qend()
+    friend bool operator==(distance_query_iterator const& l, query_iterator<value_type, allocators_type> const& r)
+    {
+        return l.m_impl.is_end() && r.is_end();
+    }
+
+    friend bool operator==(query_iterator<value_type, allocators_type> const& l, distance_query_iterator const& r)
+    {
+        return l.is_end() && r.m_impl.is_end();
+    }
+
 private:
-    visitors::distance_query_incremental<MembersHolder, Predicates> m_impl;
+    impl_type m_impl;
 };
 
 
@@ -321,6 +344,11 @@ public:
         return temp;
     }
 
+    bool is_end() const
+    {
+        return m_ptr.get() ? m_ptr->is_end() : true;
+    }
+
     friend bool operator==(query_iterator const& l, query_iterator const& r)
     {
         if ( l.m_ptr.get() )
@@ -121,9 +121,12 @@ bool are_boxes_ok(Rtree const& tree, bool exact_match = true)
     typedef utilities::view<Rtree> RTV;
     RTV rtv(tree);
 
+    // the visitor stores a reference, parameters are returned by value
+    typename Rtree::parameters_type const parameters = tree.parameters();
+
     visitors::are_boxes_ok<
         typename RTV::members_holder
-    > v(tree.parameters(), rtv.translator(), exact_match);
+    > v(parameters, rtv.translator(), exact_match);
 
     rtv.apply_visitor(v);
 
@@ -22,7 +22,21 @@
 
 namespace boost { namespace geometry { namespace index {
 
-namespace detail { namespace rtree { namespace visitors {
+namespace detail { namespace rtree {
+
+// Returns true if the nodes don't have to be destroyed one by one because destroying them
+// does nothing and their memory is released together with the allocators. Specialized
+// for the allocators of index::arena_allocator.
+template <typename Allocators, typename Enable = void>
+struct release_nodes
+{
+    static inline bool apply(Allocators const&)
+    {
+        return false;
+    }
+};
+
+namespace visitors {
 
 template <typename MembersHolder>
 class destroy
@@ -80,7 +94,9 @@ private:
     allocators_type & m_allocators;
 };
 
-}}} // namespace detail::rtree::visitors
+} // namespace visitors
+
+}} // namespace detail::rtree
 
 }}} // namespace boost::geometry::index
 
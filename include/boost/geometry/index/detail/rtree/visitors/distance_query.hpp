@@ -16,16 +16,27 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_DISTANCE_QUERY_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_DISTANCE_QUERY_HPP
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <queue>
+#include <utility>
+#include <vector>
 
+#include <boost/geometry/algorithms/centroid.hpp>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
 #include <boost/geometry/index/detail/distance_predicates.hpp>
 #include <boost/geometry/index/detail/predicates.hpp>
 #include <boost/geometry/index/detail/priority_dequeue.hpp>
 #include <boost/geometry/index/detail/rtree/node/weak_visitor.hpp>
 #include <boost/geometry/index/detail/rtree/node/node_elements.hpp>
+#include <boost/geometry/index/detail/rtree/pack_hilbert.hpp>
 #include <boost/geometry/index/detail/translator.hpp>
 #include <boost/geometry/index/parameters.hpp>
+#include <boost/geometry/index/query_statistics.hpp>
 
 namespace boost { namespace geometry { namespace index {
 
@@ -60,10 +71,15 @@ struct priority_dequeue : index::detail::priority_dequeue<T, std::vector<T>, Com
     //{
     //    this->c.reserve(n);
     //}
-    //void clear()
-    //{
-    //    this->c.clear();
-    //}
+    void clear()
+    {
+        this->c.clear();
+    }
+    // NOTE: Both containers must be empty
+    void swap_container(std::vector<T> & c)
+    {
+        this->c.swap(c);
+    }
 };
 
 template <typename T, typename Comp>
@@ -78,6 +94,11 @@ struct priority_queue : std::priority_queue<T, std::vector<T>, Comp>
     {
         this->c.clear();
     }
+    // NOTE: Both containers must be empty
+    void swap_container(std::vector<T> & c)
+    {
+        this->c.swap(c);
+    }
 };
 
 struct branch_data_comp
@@ -153,7 +174,11 @@ private:
     neighbors_type m_neighbors;
 };
 
-template <typename MembersHolder, typename Predicates>
+template
+<
+    typename MembersHolder, typename Predicates,
+    typename Statistics = index::detail::no_query_statistics
+>
 class distance_query
 {
     typedef typename MembersHolder::value_type value_type;
@@ -198,10 +223,12 @@ class distance_query
     using branches_type = priority_queue<branch_data, branch_data_comp>;
 
 public:
-    distance_query(MembersHolder const& members, Predicates const& pred)
+    distance_query(MembersHolder const& members, Predicates const& pred,
+                   Statistics const& stats = Statistics())
         : m_tr(members.translator())
         , m_strategy(index::detail::get_strategy(members.parameters()))
         , m_pred(pred)
+        , m_stats(stats)
     {
         m_neighbors.reserve((std::min)(members.values_count, size_type(max_count())));
         //m_branches.reserve(members.parameters().get_min_elements() * members.leafs_level); ?
@@ -230,9 +257,11 @@ private:
             if (reverse_level > 0)
             {
                 internal_node& n = rtree::get<internal_node>(*ptr);
+                m_stats.internal_node();
                 // fill array of nodes meeting predicates
                 for (auto const& p : rtree::elements(n))
                 {
+                    m_stats.box();
                     node_distance_type node_distance; // for distance predicate
 
                     // if current node meets predicates (0 is dummy value)
@@ -244,15 +273,18 @@ private:
                     {
                         // add current node's data into the list
                         m_branches.push(branch_data(node_distance, reverse_level - 1, p.second));
+                        m_stats.push(m_branches.size());
                     }
                 }
             }
             else
             {
                 leaf& n = rtree::get<leaf>(*ptr);
+                m_stats.leaf();
                 // search leaf for closest value meeting predicates
                 for (auto const& v : rtree::elements(n))
                 {
+                    m_stats.value();
                     value_distance_type value_distance; // for distance predicate
 
                     // if value meets predicates
@@ -275,6 +307,7 @@ private:
             ptr = m_branches.top().ptr;
             reverse_level = m_branches.top().reverse_level;
             m_branches.pop();
+            m_stats.pop();
         }
 
         for (auto const& p : m_neighbors)
@@ -328,16 +361,24 @@ private:
 
     branches_type m_branches;
     neighbors_type m_neighbors;
+
+    Statistics m_stats;
 };
 
-template <typename MembersHolder, typename Predicates>
-class distance_query_incremental
+// Performs many distance queries, e.g. k nearest neighbors queries of many points. The queries
+// are performed in the order of the Hilbert index of the centers of their geometries so the
+// consecutive queries are close to each other. The neighbors found by the previous query are
+// checked first so the distance to the furthest neighbor is known before the traversal and
+// most of the nodes far from the query are not visited.
+template <typename MembersHolder, typename PredicatesIterator, typename Function>
+class distance_query_batch
 {
+    typedef typename std::iterator_traits<PredicatesIterator>::value_type predicates_type;
+
     typedef typename MembersHolder::value_type value_type;
     typedef typename MembersHolder::box_type box_type;
     typedef typename MembersHolder::parameters_type parameters_type;
     typedef typename MembersHolder::translator_type translator_type;
-    typedef typename MembersHolder::allocators_type allocators_type;
 
     typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
 
@@ -347,7 +388,7 @@ class distance_query_incremental
 
     typedef index::detail::predicates_element
         <
-            index::detail::predicates_find_distance<Predicates>::value, Predicates
+            index::detail::predicates_find_distance<predicates_type>::value, predicates_type
         > nearest_predicate_access;
     typedef typename nearest_predicate_access::type nearest_predicate_type;
     typedef typename indexable_type<translator_type>::type indexable_type;
@@ -357,16 +398,289 @@ class distance_query_incremental
     typedef typename calculate_value_distance::result_type value_distance_type;
     typedef typename calculate_node_distance::result_type node_distance_type;
 
+    typedef typename MembersHolder::size_type size_type;
+    typedef typename MembersHolder::node_pointer node_pointer;
+
+    typedef typename geometry::point_type<box_type>::type point_type;
+    static const std::size_t dimension = geometry::dimension<point_type>::value;
+
+    // the Hilbert index and the index of a query
+    typedef std::pair<std::uint64_t, size_type> entry_type;
+
+    using neighbor_data = std::pair<value_distance_type, const value_type *>;
+    using neighbors_type = std::vector<neighbor_data>;
+
+    struct branch_data
+    {
+        branch_data(node_distance_type d, size_type rl, node_pointer p)
+            : distance(d), reverse_level(rl), ptr(p)
+        {}
+
+        node_distance_type distance;
+        size_type reverse_level;
+        node_pointer ptr;
+    };
+    using branches_type = priority_queue<branch_data, branch_data_comp>;
+
+    static_assert(0 < dimension && dimension <= 64, "Unsupported dimension.");
+
+    // the same as in pack_hilbert
+    static const std::size_t bits = 64 / dimension < 16 ? 64 / dimension : 16;
+
+public:
+    distance_query_batch(MembersHolder const& members, PredicatesIterator first,
+                         size_type count, Function & fun)
+        : m_tr(members.translator())
+        , m_strategy(index::detail::get_strategy(members.parameters()))
+        , m_first(first)
+        , m_count(count)
+        , m_fun(fun)
+        , m_pred(nullptr)
+    {}
+
+    size_type apply(MembersHolder const& members)
+    {
+        std::vector<entry_type> entries;
+        calculate_hilbert_indexes(entries);                                                 // MAY THROW (A)
+        std::sort(entries.begin(), entries.end(), pack_utils::hilbert_entries_comparer());
+
+        std::vector<const value_type *> previous;
+        size_type found_count = 0;
+        for (entry_type const& e : entries)
+        {
+            m_pred = std::addressof(m_first[e.second]);
+            if (max_count() <= 0)
+            {
+                continue;
+            }
+
+            m_neighbors.clear();
+            m_branches.clear();
+
+            // the neighbors of the previous query
+            for (const value_type * ptr : previous)
+            {
+                store_value_if_ok(*ptr, nullptr);
+            }
+
+            apply(members.root, members.leafs_level, previous);                             // MAY THROW (A)
+
+            previous.clear();
+            for (auto const& p : m_neighbors)
+            {
+                previous.push_back(p.second);                                               // MAY THROW (A)
+                m_fun(e.second, *(p.second));                                               // MAY THROW
+            }
+            // sorted so the checked values can be found quickly in the leafs
+            std::sort(previous.begin(), previous.end(), std::less<const value_type *>());
+            found_count += m_neighbors.size();
+        }
+
+        return found_count;
+    }
+
+private:
+    void apply(node_pointer ptr, size_type reverse_level, std::vector<const value_type *> const& previous)
+    {
+        namespace id = index::detail;
+
+        for (;;)
+        {
+            if (reverse_level > 0)
+            {
+                internal_node& n = rtree::get<internal_node>(*ptr);
+                // fill array of nodes meeting predicates
+                for (auto const& p : rtree::elements(n))
+                {
+                    node_distance_type node_distance; // for distance predicate
+
+                    // if current node meets predicates (0 is dummy value)
+                    if (id::predicates_check<id::bounds_tag>(*m_pred, 0, p.first, m_strategy)
+                        // and if distance is ok
+                        && calculate_node_distance::apply(predicate(), p.first, m_strategy, node_distance)
+                        // and if current node is closer than the furthest neighbor
+                        && ! ignore_branch(node_distance))
+                    {
+                        // add current node's data into the list
+                        m_branches.push(branch_data(node_distance, reverse_level - 1, p.second));
+                    }
+                }
+            }
+            else
+            {
+                leaf& n = rtree::get<leaf>(*ptr);
+                // search leaf for closest value meeting predicates
+                for (auto const& v : rtree::elements(n))
+                {
+                    store_value_if_ok(v, std::addressof(previous));
+                }
+            }
+
+            if (m_branches.empty()
+                || ignore_branch(m_branches.top().distance))
+            {
+                break;
+            }
+
+            ptr = m_branches.top().ptr;
+            reverse_level = m_branches.top().reverse_level;
+            m_branches.pop();
+        }
+    }
+
+    // The values in checked were already passed, checked is sorted
+    void store_value_if_ok(value_type const& v, std::vector<const value_type *> const* checked)
+    {
+        namespace id = index::detail;
+
+        value_distance_type value_distance; // for distance predicate
+
+        // if value meets predicates
+        if (id::predicates_check<id::value_tag>(*m_pred, v, m_tr(v), m_strategy)
+            // and if distance is ok
+            && calculate_value_distance::apply(predicate(), m_tr(v), m_strategy, value_distance)
+            // and if current value is closer than the furthest neighbor
+            && ! ignore_value(value_distance)
+            // and if it wasn't checked before
+            && ! (checked && std::binary_search(checked->begin(), checked->end(), std::addressof(v),
+                                                std::less<const value_type *>())))
+        {
+            // store value
+            store_value(value_distance, std::addressof(v));
+        }
+    }
+
+    bool ignore_branch(node_distance_type const& node_distance) const
+    {
+        return m_neighbors.size() == max_count()
+            && m_neighbors.front().first <= node_distance;
+    }
+
+    bool ignore_value(value_distance_type const& value_distance) const
+    {
+        return m_neighbors.size() == max_count()
+            && m_neighbors.front().first <= value_distance;
+    }
+
+    void store_value(value_distance_type value_distance, const value_type * value_ptr)
+    {
+        if (m_neighbors.size() < max_count())
+        {
+            m_neighbors.push_back(std::make_pair(value_distance, value_ptr));
+
+            if (m_neighbors.size() == max_count())
+            {
+                std::make_heap(m_neighbors.begin(), m_neighbors.end(), pair_first_less());
+            }
+        }
+        else
+        {
+            std::pop_heap(m_neighbors.begin(), m_neighbors.end(), pair_first_less());
+            m_neighbors.back() = std::make_pair(value_distance, value_ptr);
+            std::push_heap(m_neighbors.begin(), m_neighbors.end(), pair_first_less());
+        }
+    }
+
+    // The Hilbert indexes of the centers of the bounds of the queries geometries
+    void calculate_hilbert_indexes(std::vector<entry_type> & entries) const
+    {
+        std::vector<point_type> centers;
+        centers.reserve(m_count);                                                           // MAY THROW (A)
+        entries.reserve(m_count);                                                           // MAY THROW (A)
+
+        box_type centers_box;
+        for (size_type i = 0 ; i < m_count ; ++i)
+        {
+            box_type b;
+            index::detail::bounds(query_geometry(nearest_predicate_access::get(m_first[i])), b, m_strategy);
+            point_type pt;
+            geometry::centroid(b, pt, m_strategy);
+            if (i == 0)
+            {
+                index::detail::bounds(pt, centers_box, m_strategy);
+            }
+            else
+            {
+                index::detail::expand(centers_box, pt, m_strategy);
+            }
+            centers.push_back(pt);
+        }
+
+        for (size_type i = 0 ; i < m_count ; ++i)
+        {
+            std::uint64_t cell[dimension];
+            pack_utils::hilbert_cell<0, dimension>::apply(centers[i], centers_box, bits, cell);
+            entries.push_back(entry_type(pack_utils::hilbert_index<dimension>::apply(cell, bits), i));
+        }
+    }
+
+    template <typename PointOrRelation>
+    static auto const& query_geometry(predicates::nearest<PointOrRelation> const& p)
+    {
+        return index::detail::relation<PointOrRelation>::value(p.point_or_relation);
+    }
+
+    template <typename SegmentOrLinestring>
+    static auto const& query_geometry(predicates::path<SegmentOrLinestring> const& p)
+    {
+        return p.geometry;
+    }
+
+    std::size_t max_count() const
+    {
+        return nearest_predicate_access::get(*m_pred).count;
+    }
+
+    nearest_predicate_type const& predicate() const
+    {
+        return nearest_predicate_access::get(*m_pred);
+    }
+
+    translator_type const& m_tr;
+    strategy_type m_strategy;
+
+    PredicatesIterator m_first;
+    size_type m_count;
+    Function & m_fun;
+
+    predicates_type const* m_pred;
+
+    branches_type m_branches;
+    neighbors_type m_neighbors;
+};
+
+// The memory of the containers used by distance_query_incremental. It's taken by an iterator
+// when the query starts and given back when the iterator is destroyed so the subsequent queries
+// don't allocate memory after the containers have grown.
+template <typename MembersHolder, typename NearestPredicate>
+class distance_query_workspace
+{
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+    typedef typename indexable_type<translator_type>::type indexable_type;
+
+    template <typename MH, typename P>
+    friend class distance_query_incremental;
+
+public:
+    typedef typename index::detail::calculate_distance
+        <
+            NearestPredicate, indexable_type, strategy_type, value_tag
+        >::result_type value_distance_type;
+    typedef typename index::detail::calculate_distance
+        <
+            NearestPredicate, box_type, strategy_type, bounds_tag
+        >::result_type node_distance_type;
+
     typedef typename allocators_type::size_type size_type;
-    typedef typename allocators_type::const_reference const_reference;
     typedef typename allocators_type::node_pointer node_pointer;
 
-    typedef typename rtree::elements_type<internal_node>::type internal_elements;
-    typedef typename internal_elements::const_iterator internal_iterator;
-    typedef typename rtree::elements_type<leaf>::type leaf_elements;
-
     using neighbor_data = std::pair<value_distance_type, const value_type *>;
-    using neighbors_type = priority_dequeue<neighbor_data, pair_first_greater>;
 
     struct branch_data
     {
@@ -378,6 +692,67 @@ class distance_query_incremental
         size_type reverse_level;
         node_pointer ptr;
     };
+
+    distance_query_workspace() = default;
+
+    // The memory is not shared by the copies
+    distance_query_workspace(distance_query_workspace const&) {}
+    distance_query_workspace & operator=(distance_query_workspace const&) { return *this; }
+
+    void reserve(size_type branches_count, size_type neighbors_count)
+    {
+        m_branches.reserve(branches_count);
+        m_neighbors.reserve(neighbors_count);
+    }
+
+private:
+    std::vector<branch_data> m_branches;
+    std::vector<neighbor_data> m_neighbors;
+};
+
+template <typename MembersHolder, typename Predicates>
+class distance_query_incremental
+{
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef index::detail::predicates_element
+        <
+            index::detail::predicates_find_distance<Predicates>::value, Predicates
+        > nearest_predicate_access;
+    typedef typename nearest_predicate_access::type nearest_predicate_type;
+    typedef typename indexable_type<translator_type>::type indexable_type;
+
+    typedef index::detail::calculate_distance<nearest_predicate_type, indexable_type, strategy_type, value_tag> calculate_value_distance;
+    typedef index::detail::calculate_distance<nearest_predicate_type, box_type, strategy_type, bounds_tag> calculate_node_distance;
+    typedef typename calculate_value_distance::result_type value_distance_type;
+    typedef typename calculate_node_distance::result_type node_distance_type;
+
+    typedef typename allocators_type::size_type size_type;
+    typedef typename allocators_type::const_reference const_reference;
+    typedef typename allocators_type::node_pointer node_pointer;
+
+    typedef typename rtree::elements_type<internal_node>::type internal_elements;
+    typedef typename internal_elements::const_iterator internal_iterator;
+    typedef typename rtree::elements_type<leaf>::type leaf_elements;
+
+public:
+    typedef distance_query_workspace<MembersHolder, nearest_predicate_type> workspace_type;
+
+private:
+    using neighbor_data = typename workspace_type::neighbor_data;
+    using neighbors_type = priority_dequeue<neighbor_data, pair_first_greater>;
+
+    using branch_data = typename workspace_type::branch_data;
     using branches_type = priority_queue<branch_data, branch_data_comp>;
 
 public:
@@ -387,6 +762,7 @@ public:
 //        , m_pred()
         , m_neighbors_count(0)
         , m_neighbor_ptr(nullptr)
+        , m_workspace(nullptr)
     {}
 
     inline distance_query_incremental(Predicates const& pred)
@@ -395,6 +771,7 @@ public:
         , m_pred(pred)
         , m_neighbors_count(0)
         , m_neighbor_ptr(nullptr)
+        , m_workspace(nullptr)
     {}
 
     inline distance_query_incremental(MembersHolder const& members, Predicates const& pred)
@@ -403,8 +780,90 @@ public:
         , m_pred(pred)
         , m_neighbors_count(0)
         , m_neighbor_ptr(nullptr)
+        , m_workspace(nullptr)
+    {}
+
+    // The memory of the workspace is used until this object is destroyed
+    inline distance_query_incremental(MembersHolder const& members, Predicates const& pred,
+                                      workspace_type & workspace)
+        : m_tr(std::addressof(members.translator()))
+        , m_strategy(index::detail::get_strategy(members.parameters()))
+        , m_pred(pred)
+        , m_neighbors_count(0)
+        , m_neighbor_ptr(nullptr)
+        , m_workspace(std::addressof(workspace))
+    {
+        workspace.m_branches.clear();
+        workspace.m_neighbors.clear();
+        m_branches.swap_container(workspace.m_branches);
+        m_neighbors.swap_container(workspace.m_neighbors);
+    }
+
+    // The copy doesn't use the memory of the workspace
+    inline distance_query_incremental(distance_query_incremental const& other)
+        : m_tr(other.m_tr)
+        , m_strategy(other.m_strategy)
+        , m_pred(other.m_pred)
+        , m_branches(other.m_branches)
+        , m_neighbors(other.m_neighbors)
+        , m_neighbors_count(other.m_neighbors_count)
+        , m_neighbor_ptr(other.m_neighbor_ptr)
+        , m_workspace(nullptr)
     {}
 
+    inline distance_query_incremental(distance_query_incremental && other)
+        : m_tr(other.m_tr)
+        , m_strategy(std::move(other.m_strategy))
+        , m_pred(std::move(other.m_pred))
+        , m_branches(std::move(other.m_branches))
+        , m_neighbors(std::move(other.m_neighbors))
+        , m_neighbors_count(other.m_neighbors_count)
+        , m_neighbor_ptr(other.m_neighbor_ptr)
+        , m_workspace(other.m_workspace)
+    {
+        other.m_workspace = nullptr;
+    }
+
+    // The memory of the workspace of this object is reused
+    inline distance_query_incremental & operator=(distance_query_incremental const& other)
+    {
+        if (this != std::addressof(other))
+        {
+            m_tr = other.m_tr;
+            m_strategy = other.m_strategy;
+            m_pred = other.m_pred;
+            m_branches = other.m_branches;
+            m_neighbors = other.m_neighbors;
+            m_neighbors_count = other.m_neighbors_count;
+            m_neighbor_ptr = other.m_neighbor_ptr;
+        }
+        return *this;
+    }
+
+    inline distance_query_incremental & operator=(distance_query_incremental && other)
+    {
+        if (this != std::addressof(other))
+        {
+            release_workspace();
+
+            m_tr = other.m_tr;
+            m_strategy = std::move(other.m_strategy);
+            m_pred = std::move(other.m_pred);
+            m_branches = std::move(other.m_branches);
+            m_neighbors = std::move(other.m_neighbors);
+            m_neighbors_count = other.m_neighbors_count;
+            m_neighbor_ptr = other.m_neighbor_ptr;
+            m_workspace = other.m_workspace;
+            other.m_workspace = nullptr;
+        }
+        return *this;
+    }
+
+    inline ~distance_query_incremental()
+    {
+        release_workspace();
+    }
+
     const_reference dereference() const
     {
         return *m_neighbor_ptr;
@@ -485,6 +944,19 @@ public:
     }
 
 private:
+    // Gives the memory back to the workspace
+    void release_workspace()
+    {
+        if (m_workspace != nullptr)
+        {
+            m_branches.clear();
+            m_neighbors.clear();
+            m_branches.swap_container(m_workspace->m_branches);
+            m_neighbors.swap_container(m_workspace->m_neighbors);
+            m_workspace = nullptr;
+        }
+    }
+
     void apply(node_pointer ptr, size_type reverse_level)
     {
         namespace id = index::detail;
@@ -568,6 +1040,8 @@ private:
     neighbors_type m_neighbors;
     size_type m_neighbors_count;
     const value_type * m_neighbor_ptr;
+
+    workspace_type * m_workspace;
 };
 
 }}} // namespace detail::rtree::visitors
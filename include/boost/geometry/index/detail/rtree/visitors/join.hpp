@@ -0,0 +1,211 @@
+// Boost.Geometry Index
+//
+// R-tree spatial join visitor implementation
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_JOIN_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_JOIN_HPP
+
+#include <vector>
+
+#include <boost/geometry/index/detail/join_predicates.hpp>
+#include <boost/geometry/index/detail/rtree/node/node_elements.hpp>
+#include <boost/geometry/index/parameters.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace visitors {
+
+// Traverses two trees together and descends only into pairs of nodes meeting the predicate.
+// Nodes of the tree having more levels left to the leafs are traversed first, so nodes of
+// the same levels are checked against each other if the trees have different heights.
+// The children of the second node not meeting the predicate with the first node are
+// filtered out once and the rest is stored in a buffer shared by all levels.
+template <typename MembersHolder1, typename MembersHolder2, typename Predicate, typename Function>
+class spatial_join
+{
+    typedef typename MembersHolder1::parameters_type parameters_type;
+    typedef typename MembersHolder1::translator_type translator1_type;
+    typedef typename MembersHolder2::translator_type translator2_type;
+    typedef typename MembersHolder1::allocators_type allocators_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    typedef typename MembersHolder1::box_type box1_type;
+    typedef typename MembersHolder2::box_type box2_type;
+
+    typedef typename MembersHolder1::internal_node internal_node1;
+    typedef typename MembersHolder1::leaf leaf1;
+    typedef typename MembersHolder2::internal_node internal_node2;
+    typedef typename MembersHolder2::leaf leaf2;
+
+    typedef typename MembersHolder1::node_pointer node_pointer1;
+    typedef typename MembersHolder2::node_pointer node_pointer2;
+
+    typedef typename rtree::elements_type<internal_node2>::type::value_type internal_element2;
+    typedef typename MembersHolder2::value_type value2_type;
+
+public:
+    typedef typename allocators_type::size_type size_type;
+
+    spatial_join(MembersHolder1 const& members1, MembersHolder2 const& members2,
+                 Predicate const& pred, Function & fun)
+        : m_tr1(members1.translator())
+        , m_tr2(members2.translator())
+        , m_strategy(index::detail::get_strategy(members1.parameters()))
+        , m_pred(pred)
+        , m_fun(fun)
+        , m_found_count(0)
+    {}
+
+    size_type apply(MembersHolder1 const& members1, box1_type const& box1,
+                    MembersHolder2 const& members2, box2_type const& box2)
+    {
+        if (check_bounds(box1, box2))
+        {
+            apply(members1.root, members1.leafs_level, box1,
+                  members2.root, members2.leafs_level, box2);
+        }
+
+        return m_found_count;
+    }
+
+private:
+    void apply(node_pointer1 ptr1, size_type reverse_level1, box1_type const& box1,
+               node_pointer2 ptr2, size_type reverse_level2, box2_type const& box2)
+    {
+        if (reverse_level1 > reverse_level2)
+        {
+            internal_node1 const& n1 = rtree::get<internal_node1>(*ptr1);
+            for (auto const& p1 : rtree::elements(n1))
+            {
+                if (check_bounds(p1.first, box2))
+                {
+                    apply(p1.second, reverse_level1 - 1, p1.first, ptr2, reverse_level2, box2);
+                }
+            }
+        }
+        else if (reverse_level1 < reverse_level2)
+        {
+            internal_node2 const& n2 = rtree::get<internal_node2>(*ptr2);
+            for (auto const& p2 : rtree::elements(n2))
+            {
+                if (check_bounds(box1, p2.first))
+                {
+                    apply(ptr1, reverse_level1, box1, p2.second, reverse_level2 - 1, p2.first);
+                }
+            }
+        }
+        else if (reverse_level1 > 0)
+        {
+            internal_node1 const& n1 = rtree::get<internal_node1>(*ptr1);
+            internal_node2 const& n2 = rtree::get<internal_node2>(*ptr2);
+
+            // the children of the second node are stored in range [first, last)
+            size_type const first = m_children2.size();
+            for (auto const& p2 : rtree::elements(n2))
+            {
+                if (check_bounds(box1, p2.first))
+                {
+                    m_children2.push_back(&p2);                                             // MAY THROW (A)
+                }
+            }
+            size_type const last = m_children2.size();
+
+            if (first < last)
+            {
+                for (auto const& p1 : rtree::elements(n1))
+                {
+                    if (! check_bounds(p1.first, box2))
+                    {
+                        continue;
+                    }
+
+                    for (size_type i = first ; i < last ; ++i)
+                    {
+                        // the buffer may be reallocated in the recursive call
+                        internal_element2 const& p2 = *m_children2[i];
+                        if (check_bounds(p1.first, p2.first))
+                        {
+                            apply(p1.second, reverse_level1 - 1, p1.first,
+                                  p2.second, reverse_level2 - 1, p2.first);
+                        }
+                    }
+                }
+            }
+
+            m_children2.resize(first);
+        }
+        else
+        {
+            leaf1 const& n1 = rtree::get<leaf1>(*ptr1);
+            leaf2 const& n2 = rtree::get<leaf2>(*ptr2);
+
+            m_values2.clear();
+            for (auto const& v2 : rtree::elements(n2))
+            {
+                if (check(box1, m_tr2(v2)))
+                {
+                    m_values2.push_back(&v2);                                               // MAY THROW (A)
+                }
+            }
+
+            if (m_values2.empty())
+            {
+                return;
+            }
+
+            for (auto const& v1 : rtree::elements(n1))
+            {
+                auto const& i1 = m_tr1(v1);
+                if (! check(i1, box2))
+                {
+                    continue;
+                }
+
+                for (value2_type const* v2 : m_values2)
+                {
+                    if (check(i1, m_tr2(*v2)))
+                    {
+                        m_fun(v1, *v2);
+                        ++m_found_count;
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename G1, typename G2>
+    bool check(G1 const& g1, G2 const& g2) const
+    {
+        return index::detail::join_predicate_check<Predicate>::apply(m_pred, g1, g2, m_strategy);
+    }
+
+    bool check_bounds(box1_type const& b1, box2_type const& b2) const
+    {
+        return index::detail::join_predicate_check<Predicate>::bounds(m_pred, b1, b2, m_strategy);
+    }
+
+    translator1_type const& m_tr1;
+    translator2_type const& m_tr2;
+    strategy_type m_strategy;
+
+    Predicate const& m_pred;
+    Function & m_fun;
+
+    std::vector<internal_element2 const*> m_children2;
+    std::vector<value2_type const*> m_values2;
+
+    size_type m_found_count;
+};
+
+}}} // namespace detail::rtree::visitors
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_JOIN_HPP
@@ -16,16 +16,23 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_SPATIAL_QUERY_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_SPATIAL_QUERY_HPP
 
+#include <vector>
+
 #include <boost/geometry/index/detail/rtree/node/node_elements.hpp>
 #include <boost/geometry/index/detail/rtree/node/weak_visitor.hpp>
 #include <boost/geometry/index/detail/predicates.hpp>
 #include <boost/geometry/index/parameters.hpp>
+#include <boost/geometry/index/query_statistics.hpp>
 
 namespace boost { namespace geometry { namespace index {
 
 namespace detail { namespace rtree { namespace visitors {
 
-template <typename MembersHolder, typename Predicates, typename OutIter>
+template
+<
+    typename MembersHolder, typename Predicates, typename OutIter,
+    typename Statistics = index::detail::no_query_statistics
+>
 struct spatial_query
 {
     typedef typename MembersHolder::parameters_type parameters_type;
@@ -41,12 +48,14 @@ struct spatial_query
     typedef typename allocators_type::node_pointer node_pointer;
     typedef typename allocators_type::size_type size_type;
 
-    spatial_query(MembersHolder const& members, Predicates const& p, OutIter out_it)
+    spatial_query(MembersHolder const& members, Predicates const& p, OutIter out_it,
+                  Statistics const& stats = Statistics())
         : m_tr(members.translator())
         , m_strategy(index::detail::get_strategy(members.parameters()))
         , m_pred(p)
         , m_out_iter(out_it)
         , m_found_count(0)
+        , m_stats(stats)
     {}
 
     size_type apply(node_pointer ptr, size_type reverse_level)
@@ -55,9 +64,11 @@ struct spatial_query
         if (reverse_level > 0)
         {
             internal_node& n = rtree::get<internal_node>(*ptr);
+            m_stats.internal_node();
             // traverse nodes meeting predicates
             for (auto const& p : rtree::elements(n))
             {
+                m_stats.box();
                 // if node meets predicates (0 is dummy value)
                 if (id::predicates_check<id::bounds_tag>(m_pred, 0, p.first, m_strategy))
                 {
@@ -68,9 +79,11 @@ struct spatial_query
         else
         {
             leaf& n = rtree::get<leaf>(*ptr);
+            m_stats.leaf();
             // get all values meeting predicates
             for (auto const& v : rtree::elements(n))
             {
+                m_stats.value();
                 // if value meets predicates
                 if (id::predicates_check<id::value_tag>(m_pred, v, m_tr(v), m_strategy))
                 {
@@ -97,6 +110,122 @@ private:
     OutIter m_out_iter;
 
     size_type m_found_count;
+
+    Statistics m_stats;
+};
+
+// Performs many spatial queries during one traversal of the tree. For each node the indexes of
+// queries meeting the predicates are stored on the stack and only these queries are checked
+// for the children. A node overlapping many queries is visited once.
+template <typename MembersHolder, typename PredicatesIterator, typename Function>
+struct spatial_query_batch
+{
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename index::detail::strategy_type<parameters_type>::type strategy_type;
+
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename allocators_type::node_pointer node_pointer;
+    typedef typename allocators_type::size_type size_type;
+
+    spatial_query_batch(MembersHolder const& members,
+                        PredicatesIterator first, size_type count,
+                        Function & fun)
+        : m_tr(members.translator())
+        , m_strategy(index::detail::get_strategy(members.parameters()))
+        , m_first(first)
+        , m_count(count)
+        , m_fun(fun)
+        , m_found_count(0)
+    {}
+
+    size_type apply(MembersHolder const& members)
+    {
+        m_indexes.resize(m_count);
+        for (size_type i = 0 ; i < m_count ; ++i)
+        {
+            m_indexes[i] = i;
+        }
+
+        apply(members.root, members.leafs_level, 0, m_count);
+
+        return m_found_count;
+    }
+
+private:
+    // the indexes of queries which should be checked for this node are stored in
+    // m_indexes in range [first, last)
+    void apply(node_pointer ptr, size_type reverse_level, size_type first, size_type last)
+    {
+        namespace id = index::detail;
+        if (reverse_level > 0)
+        {
+            internal_node& n = rtree::get<internal_node>(*ptr);
+
+            // the indexes of queries for children are stored after the indexes for this node
+            size_type const child_first = last;
+            if (m_indexes.size() < child_first + (last - first))
+            {
+                m_indexes.resize(child_first + (last - first));
+            }
+
+            // traverse nodes meeting predicates of at least one query
+            for (auto const& p : rtree::elements(n))
+            {
+                size_type child_last = child_first;
+                for (size_type i = first ; i < last ; ++i)
+                {
+                    size_type const q = m_indexes[i];
+                    // if node meets predicates (0 is dummy value)
+                    if (id::predicates_check<id::bounds_tag>(m_first[q], 0, p.first, m_strategy))
+                    {
+                        m_indexes[child_last] = q;
+                        ++child_last;
+                    }
+                }
+
+                if (child_first < child_last)
+                {
+                    apply(p.second, reverse_level - 1, child_first, child_last);
+                }
+            }
+        }
+        else
+        {
+            leaf& n = rtree::get<leaf>(*ptr);
+            // get all values meeting predicates of queries
+            for (size_type i = first ; i < last ; ++i)
+            {
+                size_type const q = m_indexes[i];
+                auto const& pred = m_first[q];
+                for (auto const& v : rtree::elements(n))
+                {
+                    // if value meets predicates
+                    if (id::predicates_check<id::value_tag>(pred, v, m_tr(v), m_strategy))
+                    {
+                        m_fun(q, v);
+                        ++m_found_count;
+                    }
+                }
+            }
+        }
+    }
+
+    translator_type const& m_tr;
+    strategy_type m_strategy;
+
+    PredicatesIterator m_first;
+    size_type m_count;
+    Function & m_fun;
+
+    std::vector<size_type> m_indexes;
+
+    size_type m_found_count;
 };
 
 template <typename MembersHolder, typename Predicates>
@@ -0,0 +1,197 @@
+// Boost.Geometry Index
+//
+// R-tree in-place update visitor implementation
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_UPDATE_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_UPDATE_HPP
+
+#include <boost/geometry/index/parameters.hpp>
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/rtree/node/node_elements.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace visitors {
+
+// Finds the old value and replaces it with the new value in the same leaf if the indexable
+// of the new value is covered by the box of the leaf or by the box of its parent. In the
+// latter case the box of the leaf is enlarged. Then the boxes of the ancestors are adjusted
+// bottom-up. Otherwise the tree is not modified and the value has to be relocated.
+template <typename MembersHolder>
+class update
+    : public MembersHolder::visitor
+{
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename rtree::elements_type<internal_node>::type::size_type internal_size_type;
+
+public:
+    inline update(value_type const& old_value,
+                  value_type const& new_value,
+                  parameters_type const& parameters,
+                  translator_type const& translator)
+        : m_old_value(old_value)
+        , m_new_value(new_value)
+        , m_parameters(parameters)
+        , m_translator(translator)
+        , m_is_value_found(false)
+        , m_is_value_updated(false)
+        , m_parent(0)
+        , m_current_child_index(0)
+        , m_parent_box(0)
+    {}
+
+    inline void operator()(internal_node & n)
+    {
+        typedef typename rtree::elements_type<internal_node>::type children_type;
+        children_type & children = rtree::elements(n);
+
+        // traverse children which boxes cover value's box
+        internal_size_type child_node_index = 0;
+        for ( ; child_node_index < children.size() ; ++child_node_index )
+        {
+            if ( index::detail::covered_by_bounds(m_translator(m_old_value),
+                                                  children[child_node_index].first,
+                                                  index::detail::get_strategy(m_parameters)) )
+            {
+                // next traversing step
+                traverse_apply_visitor(n, child_node_index);                                        // MAY THROW (V: copy)
+
+                if ( m_is_value_found )
+                    break;
+            }
+        }
+
+        // value was updated and n is not root - adjust aabb
+        if ( m_is_value_updated && 0 != m_parent )
+        {
+            rtree::elements(*m_parent)[m_current_child_index].first
+                = rtree::elements_box<box_type>(children.begin(), children.end(), m_translator,
+                                                index::detail::get_strategy(m_parameters));
+        }
+    }
+
+    inline void operator()(leaf & n)
+    {
+        typedef typename rtree::elements_type<leaf>::type elements_type;
+        elements_type & elements = rtree::elements(n);
+
+        // find value
+        typename elements_type::iterator it = elements.begin();
+        for ( ; it != elements.end() ; ++it )
+        {
+            if ( m_translator.equals(*it, m_old_value, index::detail::get_strategy(m_parameters)) )
+            {
+                m_is_value_found = true;
+                break;
+            }
+        }
+
+        if ( m_is_value_found && fits_in_place() )
+        {
+            *it = m_new_value;                                                                      // MAY THROW (V: copy)
+            m_is_value_updated = true;
+
+            // n is not root - adjust aabb
+            if ( 0 != m_parent )
+            {
+                rtree::elements(*m_parent)[m_current_child_index].first
+                    = rtree::values_box<box_type>(elements.begin(), elements.end(), m_translator,
+                                                  index::detail::get_strategy(m_parameters));
+            }
+        }
+    }
+
+    // the old value was found
+    bool is_value_found() const
+    {
+        return m_is_value_found;
+    }
+
+    // the old value was replaced with the new value
+    bool is_value_updated() const
+    {
+        return m_is_value_updated;
+    }
+
+private:
+    void traverse_apply_visitor(internal_node & n, internal_size_type chosen_node_index)
+    {
+        // save previous traverse inputs and set new ones
+        internal_node * parent_bckup = m_parent;
+        internal_size_type current_child_index_bckup = m_current_child_index;
+        box_type const* parent_box_bckup = m_parent_box;
+
+        m_parent_box = 0 != m_parent
+                     ? &rtree::elements(*m_parent)[m_current_child_index].first
+                     : 0;
+        m_parent = &n;
+        m_current_child_index = chosen_node_index;
+
+        // next traversing step
+        rtree::apply_visitor(*this, *rtree::elements(n)[chosen_node_index].second);                 // MAY THROW (V: copy)
+
+        // restore previous traverse inputs
+        m_parent = parent_bckup;
+        m_current_child_index = current_child_index_bckup;
+        m_parent_box = parent_box_bckup;
+    }
+
+    bool fits_in_place() const
+    {
+        // the leaf is the root
+        if ( 0 == m_parent )
+            return true;
+
+        auto const& new_indexable = m_translator(m_new_value);
+        auto const strategy = index::detail::get_strategy(m_parameters);
+
+        // the box of the leaf
+        if ( index::detail::covered_by_bounds(new_indexable,
+                                              rtree::elements(*m_parent)[m_current_child_index].first,
+                                              strategy) )
+            return true;
+
+        // the box of the parent of the leaf
+        if ( 0 != m_parent_box )
+            return index::detail::covered_by_bounds(new_indexable, *m_parent_box, strategy);
+
+        // the parent of the leaf is the root
+        auto const& children = rtree::elements(*m_parent);
+        box_type const root_box = rtree::elements_box<box_type>(children.begin(), children.end(),
+                                                                m_translator, strategy);
+        return index::detail::covered_by_bounds(new_indexable, root_box, strategy);
+    }
+
+    value_type const& m_old_value;
+    value_type const& m_new_value;
+    parameters_type const& m_parameters;
+    translator_type const& m_translator;
+
+    bool m_is_value_found;
+    bool m_is_value_updated;
+
+    // traversing input parameters
+    internal_node * m_parent;
+    internal_size_type m_current_child_index;
+    box_type const* m_parent_box;
+};
+
+}}} // namespace detail::rtree::visitors
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_UPDATE_HPP
@@ -17,6 +17,8 @@ namespace detail {
 
 struct value_tag {};
 struct bounds_tag {};
+// all values in the bounds meet the predicate
+struct full_bounds_tag {};
 
 } // namespace detail
 
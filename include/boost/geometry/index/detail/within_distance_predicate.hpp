@@ -0,0 +1,169 @@
+// Boost.Geometry Index
+//
+// Within distance spatial query predicate definition and checks.
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_WITHIN_DISTANCE_PREDICATE_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_WITHIN_DISTANCE_PREDICATE_HPP
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/detail/comparable_distance/interface.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/tags.hpp>
+
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/detail.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategies/distance/comparable.hpp>
+#include <boost/geometry/strategies/distance/services.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail {
+
+namespace predicates {
+
+template <typename Geometry, typename T>
+struct within_distance
+{
+    within_distance() {}
+    within_distance(Geometry const& g, T const& d)
+        : geometry(g)
+        , distance(d)
+    {}
+    Geometry geometry;
+    T distance;
+};
+
+} // namespace predicates
+
+// ------------------------------------------------------------------ //
+// within_distance_check
+// ------------------------------------------------------------------ //
+
+// The distance strategies used to calculate the comparable distance between
+// the Geometry and an Indexable or a Box of a node.
+template
+<
+    typename Strategy,
+    bool IsUmbrella = strategies::detail::is_umbrella_strategy<Strategy>::value
+>
+struct within_distance_strategies
+{
+    template <typename G1, typename G2>
+    static inline Strategy const& get(Strategy const& s)
+    {
+        return s;
+    }
+};
+
+template <typename Strategy>
+struct within_distance_strategies<Strategy, false>
+{
+    template <typename G1, typename G2>
+    static inline auto get(Strategy const& s)
+    {
+        return strategies::distance::services::strategy_converter<Strategy>::get(s);
+    }
+};
+
+template <>
+struct within_distance_strategies<default_strategy, false>
+{
+    template <typename G1, typename G2>
+    static inline auto get(default_strategy const&)
+    {
+        return typename strategies::distance::services::default_strategy<G1, G2>::type();
+    }
+};
+
+// The Indexable or the Box is within the distance if the comparable distance between
+// it and the Geometry is not greater than the distance converted to comparable distance,
+// e.g. squared in cartesian. So nodes are pruned by comparable mindist without the
+// square root or the trigonometric functions. Nothing is within a negative distance,
+// it's checked before the conversion because squaring would change the sign.
+struct within_distance_check
+{
+    template <typename Geometry, typename T, typename Indexable, typename Strategy>
+    static inline bool apply(predicates::within_distance<Geometry, T> const& p,
+                             Indexable const& i, Strategy const& s)
+    {
+        if (p.distance < T(0))
+        {
+            return false;
+        }
+
+        auto const strategies = within_distance_strategies<Strategy>
+                                    ::template get<Geometry, Indexable>(s);
+
+        return geometry::comparable_distance(p.geometry, i, strategies)
+            <= comparable_radius(p, strategies);
+    }
+
+private:
+    template <typename Geometry, typename T, typename Strategies>
+    static inline auto comparable_radius(predicates::within_distance<Geometry, T> const& p,
+                                         Strategies const& strategies)
+    {
+        typedef point_type_t<Geometry> point_type;
+
+        // only the type of the point is used by the strategies
+        point_type pt;
+        geometry::assign_zero(pt);
+        auto const pp_strategy = strategies::distance::detail::make_comparable(strategies)
+                                    .distance(pt, pt);
+
+        return strategy::distance::services::result_from_distance
+            <
+                std::remove_const_t<decltype(pp_strategy)>, point_type, point_type
+            >::apply(pp_strategy, p.distance);
+    }
+};
+
+// ------------------------------------------------------------------ //
+// predicate_check
+// ------------------------------------------------------------------ //
+
+template <typename Geometry, typename T>
+struct predicate_check<predicates::within_distance<Geometry, T>, value_tag>
+{
+    template <typename Value, typename Indexable, typename Strategy>
+    static inline bool apply(predicates::within_distance<Geometry, T> const& p,
+                             Value const&, Indexable const& i, Strategy const& s)
+    {
+        return within_distance_check::apply(p, i, s);
+    }
+};
+
+template <typename Geometry, typename T>
+struct predicate_check<predicates::within_distance<Geometry, T>, bounds_tag>
+{
+    template <typename Value, typename Box, typename Strategy>
+    static inline bool apply(predicates::within_distance<Geometry, T> const& p,
+                             Value const&, Box const& b, Strategy const& s)
+    {
+        return within_distance_check::apply(p, b, s);
+    }
+};
+
+// The maximum distance is not calculated so it's not known if all values meet the predicate.
+template <typename Geometry, typename T>
+struct predicate_check<predicates::within_distance<Geometry, T>, full_bounds_tag>
+{
+    template <typename Value, typename Box, typename Strategy>
+    static inline bool apply(predicates::within_distance<Geometry, T> const&,
+                             Value const&, Box const&, Strategy const&)
+    {
+        return false;
+    }
+};
+
+}}}} // namespace boost::geometry::index::detail
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_WITHIN_DISTANCE_PREDICATE_HPP
@@ -0,0 +1,958 @@
+// Boost.Geometry Index
+//
+// Flat read-only R-tree implementation
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_FLAT_RTREE_HPP
+#define BOOST_GEOMETRY_INDEX_FLAT_RTREE_HPP
+
+#include <functional>
+#include <ostream>
+#include <type_traits>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/index/detail/config_begin.hpp>
+
+#include <boost/geometry/index/detail/rtree/flat/aggregate.hpp>
+#include <boost/geometry/index/detail/rtree/flat/binary.hpp>
+#include <boost/geometry/index/detail/rtree/flat/build.hpp>
+#include <boost/geometry/index/detail/rtree/flat/distance_query.hpp>
+#include <boost/geometry/index/detail/rtree/flat/members.hpp>
+#include <boost/geometry/index/detail/rtree/flat/query_iterators.hpp>
+#include <boost/geometry/index/detail/rtree/flat/spatial_query.hpp>
+#include <boost/geometry/index/detail/rtree/flat/view.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace rtree { namespace flat {
+
+template <typename Members>
+class flat_rtree_base;
+
+}}} // namespace detail::rtree::flat
+#endif // DOXYGEN_NO_DETAIL
+
+/*!
+\brief The aggregates of Values stored in the nodes of a flat_rtree or a flat_rtree_view.
+
+The object is created by flat_rtree::aggregates() or flat_rtree_view::aggregates() and
+may be passed to query_aggregate() of the same container.
+
+\tparam T           The type of the aggregate.
+\tparam Transform   The function object creating the aggregate of a Value.
+\tparam Reduce      The associative function object combining two aggregates.
+*/
+template <typename T, typename Transform, typename Reduce>
+class flat_rtree_aggregates
+{
+    template <typename Members>
+    friend class detail::rtree::flat::flat_rtree_base;
+
+    flat_rtree_aggregates(T const& init, Transform const& transform, Reduce const& reduce)
+        : m_impl(init, transform, reduce)
+    {}
+
+    detail::rtree::flat::aggregates<T, Transform, Reduce> m_impl;
+
+public:
+    /*! \brief The type of the aggregate. */
+    typedef T value_type;
+};
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace rtree { namespace flat {
+
+// The query interface of flat_rtree and flat_rtree_view. Members are either flat::members
+// storing the arrays or flat::view_members referring to the data in external memory.
+template <typename Members>
+class flat_rtree_base
+{
+protected:
+    typedef Members members_type;
+    typedef typename members_type::allocators_type allocators_type;
+
+public:
+    /*! \brief The type of Value stored in the container. */
+    typedef typename members_type::value_type value_type;
+    /*! \brief R-tree parameters type. */
+    typedef typename members_type::parameters_type parameters_type;
+    /*! \brief The function object extracting Indexable from Value. */
+    typedef typename members_type::indexable_getter_type indexable_getter;
+    /*! \brief The function object comparing objects of type Value. */
+    typedef typename members_type::equal_to_type value_equal;
+    /*! \brief The Box type used by the R-tree. */
+    typedef typename members_type::box_type bounds_type;
+
+    /*! \brief Type of reference to const Value. */
+    typedef typename allocators_type::const_reference const_reference;
+    /*! \brief Type of pointer to const Value. */
+    typedef typename allocators_type::const_pointer const_pointer;
+    /*! \brief Type of difference type. */
+    typedef typename allocators_type::difference_type difference_type;
+    /*! \brief Unsigned integral type used by the container. */
+    typedef typename allocators_type::size_type size_type;
+
+    /*! \brief Type of const iterator, category RandomAccessIterator. */
+    typedef typename members_type::values_type::const_iterator const_iterator;
+
+    /*! \brief Type of const query iterator, category ForwardIterator. */
+    typedef index::detail::rtree::iterators::query_iterator
+        <
+            value_type, allocators_type
+        > const_query_iterator;
+
+    /*!
+    \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
+
+    This query function performs spatial and k-nearest neighbor searches. It allows to pass a set of predicates.
+    Values will be returned only if all predicates are met. For the information about predicates
+    which may be passed see rtree::query().
+
+    \par Example
+    \verbatim
+    tree.query(bgi::intersects(box), std::back_inserter(result));
+    tree.query(bgi::nearest(pt, 5) && bgi::intersects(box), std::back_inserter(result));
+    \endverbatim
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If predicates copy throws.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it) const
+    {
+        return ! m_members.values.empty()
+             ? query_dispatch(predicates, out_it)
+             : 0;
+    }
+
+    /*!
+    \brief Returns a query iterator pointing at the begin of the query range.
+
+    This method returns an iterator which may be used to perform iterative queries.
+    For the information about predicates which may be passed to this method see rtree::query().
+
+    \par Example
+    \verbatim
+    for ( auto it = tree.qbegin(bgi::nearest(pt, 3)) ; it != tree.qend() ; ++it )
+    {
+        // do something with value
+    }
+    \endverbatim
+
+    \par Throws
+    If predicates copy throws.
+    If allocation throws.
+
+    \param predicates   Predicates.
+
+    \return             The iterator pointing at the begin of the query range.
+    */
+    template <typename Predicates>
+    const_query_iterator qbegin(Predicates const& predicates) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT((detail::predicates_count_distance<Predicates>::value <= 1),
+            "Only one distance predicate can be passed.",
+            Predicates);
+
+        return ! m_members.values.empty()
+             ? const_query_iterator(query_iterator_t<Predicates>(m_members, predicates))
+             : const_query_iterator(query_iterator_t<Predicates>(predicates));
+    }
+
+    /*!
+    \brief Returns a query iterator pointing at the end of the query range.
+
+    \par Throws
+    Nothing
+
+    \return             The iterator pointing at the end of the query range.
+    */
+    const_query_iterator qend() const
+    {
+        return const_query_iterator();
+    }
+
+    /*!
+    \brief Returns the number of values meeting passed spatial predicates.
+
+    The result is the same as the number of values returned by query() but the values of
+    the nodes which bounding boxes are covered by the region of intersects() or covered_by()
+    predicates or are outside of the region of disjoint() predicate are counted without
+    visiting them. So the cost depends on the number of nodes on the border of the region
+    rather than on the number of values found. The nearest() predicate can't be passed.
+
+    \par Example
+    \verbatim
+    std::size_t n = tree.query_count(bgi::intersects(tile));
+    \endverbatim
+
+    \par Throws
+    Nothing.
+
+    \param predicates   Predicates.
+
+    \return             The number of values meeting the predicates.
+    */
+    template <typename Predicates>
+    size_type query_count(Predicates const& predicates) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT((detail::predicates_count_distance<Predicates>::value == 0),
+            "Distance predicates can't be passed.",
+            Predicates);
+
+        return ! m_members.values.empty()
+             ? detail::rtree::flat::count_query<members_type, Predicates>(m_members, predicates).apply()
+             : 0;
+    }
+
+    /*!
+    \brief Calculates the aggregates of Values stored in nodes.
+
+    The aggregate of a node is <tt>reduce(...reduce(reduce(init, a1), a2)..., an)</tt>
+    where a1, a2, ..., an are the aggregates of children and the aggregate of a Value
+    is <tt>transform(value)</tt>. Reduce has to be associative and init has to be its
+    identity element, e.g. 0 for std::plus. The result may be passed to query_aggregate().
+
+    \par Example
+    \verbatim
+    auto sums = tree.aggregates(0.0, [](Value const& v) { return v.second; });
+    double sum = tree.query_aggregate(bgi::intersects(tile), sums);
+    \endverbatim
+
+    \par Throws
+    If T copy constructor, copy assignment, Transform or Reduce throws.
+    If allocation throws.
+
+    \param init         The identity element of Reduce.
+    \param transform    The function object creating the aggregate of a Value.
+    \param reduce       The associative function object combining two aggregates.
+
+    \return             The aggregates of nodes.
+    */
+    template <typename T, typename Transform, typename Reduce = std::plus<T> >
+    index::flat_rtree_aggregates<T, Transform, Reduce>
+        aggregates(T const& init, Transform const& transform, Reduce const& reduce = Reduce()) const
+    {
+        index::flat_rtree_aggregates<T, Transform, Reduce> result(init, transform, reduce);
+        result.m_impl.build(m_members);                                                     // MAY THROW
+        return result;
+    }
+
+    /*!
+    \brief Returns the aggregate of values meeting passed spatial predicates.
+
+    The result is the same as the reduction of the aggregates of values returned by query()
+    but the aggregates of the nodes which bounding boxes are covered by the region of
+    intersects() or covered_by() predicates or are outside of the region of disjoint() predicate
+    are used without visiting them. The nearest() predicate can't be passed.
+
+    \par Throws
+    If T copy assignment, Transform or Reduce throws.
+
+    \param predicates   Predicates.
+    \param aggregates   The aggregates created by aggregates() of this container.
+
+    \return             The aggregate of values meeting the predicates.
+    */
+    template <typename Predicates, typename T, typename Transform, typename Reduce>
+    T query_aggregate(Predicates const& predicates,
+                      index::flat_rtree_aggregates<T, Transform, Reduce> const& aggregates) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT((detail::predicates_count_distance<Predicates>::value == 0),
+            "Distance predicates can't be passed.",
+            Predicates);
+
+        T result = aggregates.m_impl.init;
+        if (! m_members.values.empty())
+        {
+            detail::rtree::flat::aggregate_query
+                <
+                    members_type, Predicates, detail::rtree::flat::aggregates<T, Transform, Reduce>
+                > query(m_members, predicates, aggregates.m_impl);
+            query.apply(result);                                                            // MAY THROW
+        }
+        return result;
+    }
+
+    /*!
+    \brief Returns the iterator pointing at the begin of the values range.
+
+    Values are stored in the order of leafs.
+
+    \par Throws
+    Nothing.
+
+    \return             The iterator pointing at the begin of the range.
+    */
+    const_iterator begin() const
+    {
+        return m_members.values.begin();
+    }
+
+    /*!
+    \brief Returns the iterator pointing at the end of the values range.
+
+    \par Throws
+    Nothing.
+
+    \return             The iterator pointing at the end of the range.
+    */
+    const_iterator end() const
+    {
+        return m_members.values.end();
+    }
+
+    /*!
+    \brief Returns the number of stored values.
+
+    \return         The number of stored values.
+
+    \par Throws
+    Nothing.
+    */
+    inline size_type size() const
+    {
+        return m_members.values.size();
+    }
+
+    /*!
+    \brief Query if the container is empty.
+
+    \return         true if the container is empty.
+
+    \par Throws
+    Nothing.
+    */
+    inline bool empty() const
+    {
+        return m_members.values.empty();
+    }
+
+    /*!
+    \brief Returns the box able to contain all values stored in the container.
+
+    Returns the box able to contain all values stored in the container.
+    If the container is empty the result of \c geometry::assign_inverse() is returned.
+
+    \return     The box able to contain all values stored in the container or an invalid box if
+                there are no values in the container.
+
+    \par Throws
+    Nothing.
+    */
+    inline bounds_type bounds() const
+    {
+        return detail::rtree::flat::members_bounds(m_members);
+    }
+
+    /*!
+    \brief Returns parameters.
+
+    \return     The parameters object.
+
+    \par Throws
+    Nothing.
+    */
+    inline parameters_type parameters() const
+    {
+        return m_members.parameters();
+    }
+
+    /*!
+    \brief Returns function retrieving Indexable from Value.
+
+    \return     The indexable_getter object.
+
+    \par Throws
+    Nothing.
+    */
+    indexable_getter indexable_get() const
+    {
+        return m_members.indexable_getter();
+    }
+
+    /*!
+    \brief Returns function comparing Values
+
+    \return     The value_equal function.
+
+    \par Throws
+    Nothing.
+    */
+    value_equal value_eq() const
+    {
+        return m_members.equal_to();
+    }
+
+protected:
+    template <typename ...Args>
+    explicit flat_rtree_base(Args const& ...args)
+        : m_members(args...)
+    {}
+
+    members_type m_members;
+
+private:
+    template <typename Predicates>
+    using query_iterator_t = std::conditional_t
+        <
+            detail::predicates_count_distance<Predicates>::value == 0,
+            detail::rtree::flat::spatial_query_iterator<members_type, Predicates>,
+            detail::rtree::flat::distance_query_iterator<members_type, Predicates>
+        >;
+
+    template
+    <
+        typename Predicates, typename OutIter,
+        std::enable_if_t<(detail::predicates_count_distance<Predicates>::value == 0), int> = 0
+    >
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it) const
+    {
+        detail::rtree::flat::spatial_query<members_type, Predicates, OutIter>
+            query(m_members, predicates, out_it);
+        return query.apply();
+    }
+
+    template
+    <
+        typename Predicates, typename OutIter,
+        std::enable_if_t<(detail::predicates_count_distance<Predicates>::value > 0), int> = 0
+    >
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT((detail::predicates_count_distance<Predicates>::value == 1),
+                                     "Only one distance predicate can be passed.",
+                                     Predicates);
+
+        detail::rtree::flat::distance_query<members_type, Predicates>
+            distance_v(m_members, predicates);
+
+        return distance_v.apply(out_it);
+    }
+};
+
+}}} // namespace detail::rtree::flat
+#endif // DOXYGEN_NO_DETAIL
+
+/*!
+\brief The read-only R-tree spatial index stored in contiguous arrays.
+
+This is the immutable version of the rtree. The nodes of the tree are stored in breadth-first
+order in contiguous arrays and the coordinates of the bounding boxes of nodes are stored
+in separate arrays for each dimension and corner (structure of arrays). Values are stored
+in one array in the order of leafs. There are no pointers and no per-node allocations so
+the container takes less memory and the queries are faster than in the rtree but Values can't
+be inserted or removed.
+
+The flat_rtree is created from an rtree or from a range of Values. In the latter case
+the rtree is created with the packing algorithm and then converted.
+The same predicates as in the rtree can be passed to query() and qbegin().
+
+For cartesian boxes with float or double coordinates, the bounding boxes of all children
+of a node are tested at once with SIMD instructions if a single intersects(), covered_by(),
+overlaps(), touches(), within() or nearest() predicate is passed and the default strategy
+is used. The instruction set is chosen at compile time (AVX2 or SSE2).
+Define BOOST_GEOMETRY_INDEX_NO_SIMD to use the scalar version.
+
+If quantized_node_boxes are passed the bounding boxes of nodes are stored as small integers
+relative to the boxes of groups of neighbouring nodes and are rounded outwards. The nodes take
+several times less memory and the queries return the same Values but more nodes may be visited,
+the boxes are not tested with SIMD instructions, bounds() may return a bigger box and the tree
+can't be written in the binary format.
+
+\tparam Value           The type of objects stored in the container.
+\tparam Parameters      Compile-time parameters used to create the tree.
+\tparam IndexableGetter The function object extracting Indexable from Value.
+\tparam EqualTo         The function object comparing objects of type Value.
+\tparam Allocator       The allocator used to allocate/deallocate memory and construct/destroy Values.
+\tparam NodeBoxes       The storage of the bounding boxes of nodes, exact_node_boxes or quantized_node_boxes.
+*/
+template
+<
+    typename Value,
+    typename Parameters,
+    typename IndexableGetter = index::indexable<Value>,
+    typename EqualTo = index::equal_to<Value>,
+    typename Allocator = boost::container::new_allocator<Value>,
+    typename NodeBoxes = index::exact_node_boxes
+>
+class flat_rtree
+    : public detail::rtree::flat::flat_rtree_base
+        <
+            typename detail::rtree::flat::select_members
+                <
+                    Value, Parameters, IndexableGetter, EqualTo, Allocator,
+                    typename index::rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::bounds_type,
+                    NodeBoxes
+                >::type
+        >
+{
+    typedef detail::rtree::flat::flat_rtree_base
+        <
+            typename detail::rtree::flat::select_members
+                <
+                    Value, Parameters, IndexableGetter, EqualTo, Allocator,
+                    typename index::rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::bounds_type,
+                    NodeBoxes
+                >::type
+        > base_type;
+
+    typedef typename base_type::members_type members_type;
+    typedef typename base_type::allocators_type allocators_type;
+
+public:
+    /*! \brief The type of the rtree from which the flat_rtree may be created. */
+    typedef index::rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> rtree_type;
+
+    /*! \brief The type of allocator used by the container. */
+    typedef Allocator allocator_type;
+    /*! \brief The Indexable type to which Value is translated. */
+    typedef typename rtree_type::indexable_type indexable_type;
+
+    /*! \brief Type of reference to Value. */
+    typedef typename allocators_type::reference reference;
+    /*! \brief Type of pointer to Value. */
+    typedef typename allocators_type::pointer pointer;
+
+    using typename base_type::value_type;
+    using typename base_type::parameters_type;
+    using typename base_type::indexable_getter;
+    using typename base_type::value_equal;
+    using typename base_type::bounds_type;
+    using typename base_type::size_type;
+
+    /*!
+    \brief The constructor.
+
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    If allocator copy constructor throws.
+    */
+    inline explicit flat_rtree(parameters_type const& parameters = parameters_type(),
+                               indexable_getter const& getter = indexable_getter(),
+                               value_equal const& equal = value_equal(),
+                               allocator_type const& allocator = allocator_type())
+        : base_type(getter, equal, parameters, allocator)
+    {}
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using packing algorithm.
+
+    \param first        The beginning of the range of Values.
+    \param last         The end of the range of Values.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    */
+    template <typename Iterator>
+    inline flat_rtree(Iterator first, Iterator last,
+                      parameters_type const& parameters = parameters_type(),
+                      indexable_getter const& getter = indexable_getter(),
+                      value_equal const& equal = value_equal(),
+                      allocator_type const& allocator = allocator_type())
+        : base_type(getter, equal, parameters, allocator)
+    {
+        build(rtree_type(first, last, parameters, getter, equal, allocator));
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using packing algorithm.
+
+    \param rng          The range of Values.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    */
+    template <typename Range>
+    inline explicit flat_rtree(Range const& rng,
+                               parameters_type const& parameters = parameters_type(),
+                               indexable_getter const& getter = indexable_getter(),
+                               value_equal const& equal = value_equal(),
+                               allocator_type const& allocator = allocator_type())
+        : base_type(getter, equal, parameters, allocator)
+    {
+        build(rtree_type(::boost::begin(rng), ::boost::end(rng), parameters, getter, equal, allocator));
+    }
+
+    /*!
+    \brief The constructor.
+
+    The structure of the rtree is copied so the nodes of the flat_rtree are the same.
+
+    \param tree         The rtree.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor throws.
+    \li If allocation throws.
+    */
+    inline explicit flat_rtree(rtree_type const& tree)
+        : base_type(tree.indexable_get(), tree.value_eq(), tree.parameters(), tree.get_allocator())
+    {
+        build(tree);
+    }
+
+    /*!
+    \brief Swaps contents of two flat_rtrees.
+
+    \param other    The flat_rtree which content will be swapped with this flat_rtree content.
+
+    \par Throws
+    If allocators swap throws.
+    */
+    void swap(flat_rtree & other)
+    {
+        this->m_members.swap(other.m_members);
+    }
+
+    /*!
+    \brief Returns allocator used by the flat_rtree.
+
+    \return     The allocator.
+
+    \par Throws
+    If allocator copy constructor throws.
+    */
+    allocator_type get_allocator() const
+    {
+        return this->m_members.get_allocator();
+    }
+
+    /*!
+    \brief Writes the flat_rtree in the binary format.
+
+    The arrays of the flat_rtree are written as they are stored in memory, together with
+    a versioned header. The data can be mapped into memory, e.g. with mmap, and queried
+    in place with flat_rtree_view without deserialization. The data can be read only with
+    the same Value, Parameters, IndexableGetter and EqualTo types and on a platform with
+    the same byte order. Value must be trivially copyable. The padding bytes of values are
+    written as zeros if Value assigns its members one by one, like std::pair, otherwise
+    the same values are written as the same data only if Value has no padding.
+
+    \param os   The output stream opened in binary mode.
+
+    \par Throws
+    If the stream throws.
+    */
+    void write(std::ostream & os) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT((detail::rtree::flat::is_binary_value<value_type>::value),
+            "Value must be trivially copyable.",
+            value_type);
+        BOOST_GEOMETRY_STATIC_ASSERT((members_type::has_coordinates),
+            "The quantized node boxes can't be written.",
+            NodeBoxes);
+
+        detail::rtree::flat::write_binary(os, this->m_members);
+    }
+
+private:
+    void build(rtree_type const& tree)
+    {
+        detail::rtree::utilities::view<rtree_type> const tree_view(tree);
+        detail::rtree::flat::build
+            <
+                typename detail::rtree::utilities::view<rtree_type>::members_holder,
+                members_type
+            > build_v(this->m_members);
+
+        build_v.apply(tree_view, tree.size());                                              // MAY THROW (A, V: copy)
+        detail::rtree::flat::finish_build(this->m_members);                                 // MAY THROW (A)
+    }
+};
+
+/*!
+\brief The read-only R-tree spatial index stored in external memory.
+
+The view allows to query the data written by flat_rtree::write() in place. The data is not
+copied nor deserialized so it can be mapped into memory, e.g. with mmap, and shared
+by several processes. The memory has to be aligned to 64 bytes, which is always the case for
+mapped files, and has to outlive the view.
+
+\tparam Value           The type of objects stored in the container.
+\tparam Parameters      Compile-time parameters used to create the tree.
+\tparam IndexableGetter The function object extracting Indexable from Value.
+\tparam EqualTo         The function object comparing objects of type Value.
+*/
+template
+<
+    typename Value,
+    typename Parameters,
+    typename IndexableGetter = index::indexable<Value>,
+    typename EqualTo = index::equal_to<Value>
+>
+class flat_rtree_view
+    : public detail::rtree::flat::flat_rtree_base
+        <
+            detail::rtree::flat::view_members
+                <
+                    Value, Parameters, IndexableGetter, EqualTo,
+                    typename index::rtree<Value, Parameters, IndexableGetter, EqualTo>::bounds_type
+                >
+        >
+{
+    BOOST_GEOMETRY_STATIC_ASSERT((detail::rtree::flat::is_binary_value<Value>::value),
+        "Value must be trivially copyable.",
+        Value);
+
+    typedef detail::rtree::flat::flat_rtree_base
+        <
+            detail::rtree::flat::view_members
+                <
+                    Value, Parameters, IndexableGetter, EqualTo,
+                    typename index::rtree<Value, Parameters, IndexableGetter, EqualTo>::bounds_type
+                >
+        > base_type;
+
+public:
+    /*! \brief The Indexable type to which Value is translated. */
+    typedef typename index::rtree<Value, Parameters, IndexableGetter, EqualTo>::indexable_type indexable_type;
+
+    using typename base_type::parameters_type;
+    using typename base_type::indexable_getter;
+    using typename base_type::value_equal;
+
+    /*!
+    \brief The constructor.
+
+    \param data         The pointer to the data written by flat_rtree::write().
+    \param size         The size of the data in bytes.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+
+    \par Throws
+    std::invalid_argument if the data is not aligned, has different version, was written
+    with different types or is corrupted.
+    */
+    inline flat_rtree_view(void const* data, std::size_t size,
+                           parameters_type const& parameters = parameters_type(),
+                           indexable_getter const& getter = indexable_getter(),
+                           value_equal const& equal = value_equal())
+        : base_type(getter, equal, parameters)
+    {
+        this->m_members.assign(data, size);
+    }
+
+    /*!
+    \brief Swaps contents of two flat_rtree_views.
+
+    \param other    The flat_rtree_view which content will be swapped with this view content.
+
+    \par Throws
+    Nothing.
+    */
+    void swap(flat_rtree_view & other)
+    {
+        this->m_members.swap(other.m_members);
+    }
+};
+
+/*!
+\brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
+
+It calls <tt>flat_rtree::query(Predicates const&, OutIter)</tt>.
+
+\ingroup rtree_functions
+
+\param tree         The flat_rtree or flat_rtree_view.
+\param predicates   Predicates.
+\param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+\return             The number of values found.
+*/
+template <typename Members, typename Predicates, typename OutIter> inline
+typename detail::rtree::flat::flat_rtree_base<Members>::size_type
+query(detail::rtree::flat::flat_rtree_base<Members> const& tree,
+      Predicates const& predicates,
+      OutIter out_it)
+{
+    return tree.query(predicates, out_it);
+}
+
+/*!
+\brief Returns the query iterator pointing at the begin of the query range.
+
+It calls <tt>flat_rtree::qbegin(Predicates const&)</tt>.
+
+\ingroup rtree_functions
+
+\param tree         The flat_rtree or flat_rtree_view.
+\param predicates   Predicates.
+
+\return             The iterator pointing at the begin of the query range.
+*/
+template <typename Members, typename Predicates> inline
+typename detail::rtree::flat::flat_rtree_base<Members>::const_query_iterator
+qbegin(detail::rtree::flat::flat_rtree_base<Members> const& tree,
+       Predicates const& predicates)
+{
+    return tree.qbegin(predicates);
+}
+
+/*!
+\brief Returns the query iterator pointing at the end of the query range.
+
+It calls <tt>flat_rtree::qend()</tt>.
+
+\ingroup rtree_functions
+
+\param tree         The flat_rtree or flat_rtree_view.
+
+\return             The iterator pointing at the end of the query range.
+*/
+template <typename Members> inline
+typename detail::rtree::flat::flat_rtree_base<Members>::const_query_iterator
+qend(detail::rtree::flat::flat_rtree_base<Members> const& tree)
+{
+    return tree.qend();
+}
+
+/*!
+\brief Returns the iterator pointing at the begin of the values range.
+
+It calls <tt>flat_rtree::begin()</tt>.
+
+\ingroup rtree_functions
+
+\param tree         The flat_rtree or flat_rtree_view.
+
+\return             The iterator pointing at the begin of the range.
+*/
+template <typename Members> inline
+typename detail::rtree::flat::flat_rtree_base<Members>::const_iterator
+begin(detail::rtree::flat::flat_rtree_base<Members> const& tree)
+{
+    return tree.begin();
+}
+
+/*!
+\brief Returns the iterator pointing at the end of the values range.
+
+It calls <tt>flat_rtree::end()</tt>.
+
+\ingroup rtree_functions
+
+\param tree         The flat_rtree or flat_rtree_view.
+
+\return             The iterator pointing at the end of the range.
+*/
+template <typename Members> inline
+typename detail::rtree::flat::flat_rtree_base<Members>::const_iterator
+end(detail::rtree::flat::flat_rtree_base<Members> const& tree)
+{
+    return tree.end();
+}
+
+/*!
+\brief Get the number of values stored in the index.
+
+It calls <tt>flat_rtree::size()</tt>.
+
+\ingroup rtree_functions
+
+\param tree     The flat_rtree or flat_rtree_view.
+
+\return         The number of values stored in the index.
+*/
+template <typename Members> inline
+typename detail::rtree::flat::flat_rtree_base<Members>::size_type
+size(detail::rtree::flat::flat_rtree_base<Members> const& tree)
+{
+    return tree.size();
+}
+
+/*!
+\brief Query if there are no values stored in the index.
+
+It calls <tt>flat_rtree::empty()</tt>.
+
+\ingroup rtree_functions
+
+\param tree     The flat_rtree or flat_rtree_view.
+
+\return         true if there are no values in the index.
+*/
+template <typename Members> inline
+bool empty(detail::rtree::flat::flat_rtree_base<Members> const& tree)
+{
+    return tree.empty();
+}
+
+/*!
+\brief Get the box containing all stored values or an invalid box if the index has no values.
+
+It calls <tt>flat_rtree::bounds()</tt>.
+
+\ingroup rtree_functions
+
+\param tree     The flat_rtree or flat_rtree_view.
+
+\return         The box containing all stored values or an invalid box.
+*/
+template <typename Members> inline
+typename detail::rtree::flat::flat_rtree_base<Members>::bounds_type
+bounds(detail::rtree::flat::flat_rtree_base<Members> const& tree)
+{
+    return tree.bounds();
+}
+
+/*!
+\brief Exchanges the contents of the container with those of other.
+
+It calls <tt>flat_rtree::swap()</tt>.
+
+\ingroup rtree_functions
+
+\param l     The first flat_rtree.
+\param r     The second flat_rtree.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+          typename NodeBoxes>
+inline void swap(flat_rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator, NodeBoxes> & l,
+                 flat_rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator, NodeBoxes> & r)
+{
+    return l.swap(r);
+}
+
+}}} // namespace boost::geometry::index
+
+#include <boost/geometry/index/detail/config_end.hpp>
+
+#endif // BOOST_GEOMETRY_INDEX_FLAT_RTREE_HPP
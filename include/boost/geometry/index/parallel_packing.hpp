@@ -0,0 +1,71 @@
+// Boost.Geometry Index
+//
+// The packing policy creating the rtree using many threads
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_PARALLEL_PACKING_HPP
+#define BOOST_GEOMETRY_INDEX_PARALLEL_PACKING_HPP
+
+#include <cstddef>
+
+#include <boost/geometry/index/parameters.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief Parallel r-tree packing algorithm parameters.
+
+The tree is created with the default packing algorithm but subtrees created for disjoint
+ranges of values are built concurrently. The resulting tree is the same as the one created
+by the sequential algorithm.
+
+\warning
+Nodes are created concurrently so the allocator has to be safe to use from many threads.
+The tree using arena_allocator, which is not thread-safe, is created by one thread.
+
+\par Example
+\verbatim
+#include <boost/geometry/index/parallel_packing.hpp>
+
+bgi::rtree<Value, bgi::rstar<16>> rt(values, bgi::parallel_packing(4));
+\endverbatim
+*/
+class parallel_packing
+{
+public:
+    /*!
+    \brief The constructor.
+
+    \param threads  The maximum number of threads building the tree, including the calling
+                    thread. If 0 the number of hardware threads is used. Default: 0.
+    */
+    explicit parallel_packing(size_t threads = 0)
+        : m_threads(threads)
+    {}
+
+    size_t get_threads() const { return m_threads; }
+
+private:
+    size_t m_threads;
+};
+
+namespace detail {
+
+template <>
+struct is_packing<parallel_packing>
+{
+    static const bool value = true;
+};
+
+} // namespace detail
+
+}}} // namespace boost::geometry::index
+
+#include <boost/geometry/index/detail/rtree/pack_create_parallel.hpp>
+
+#endif // BOOST_GEOMETRY_INDEX_PARALLEL_PACKING_HPP
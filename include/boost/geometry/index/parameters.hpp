@@ -15,6 +15,7 @@
 #ifndef BOOST_GEOMETRY_INDEX_PARAMETERS_HPP
 #define BOOST_GEOMETRY_INDEX_PARAMETERS_HPP
 
+#include <cstdint>
 #include <limits>
 
 #include <boost/geometry/core/static_assert.hpp>
@@ -150,12 +151,29 @@ struct rstar
     static size_t get_overlap_cost_threshold() { return OverlapCostThreshold; }
 };
 
-//template <size_t MaxElements, size_t MinElements>
-//struct kmeans
-//{
-//    static const size_t max_elements = MaxElements;
-//    static const size_t min_elements = MinElements;
-//};
+/*!
+\brief K-means r-tree creation algorithm parameters.
+
+Overflowing nodes are split into two clusters of elements with close centers
+found with the k-means algorithm.
+
+\tparam MaxElements     Maximum number of elements in nodes.
+\tparam MinElements     Minimum number of elements in nodes. Default: 0.3*Max.
+*/
+template <size_t MaxElements,
+          size_t MinElements = detail::default_min_elements_s<MaxElements>::value>
+struct kmeans
+{
+    BOOST_GEOMETRY_STATIC_ASSERT((0 < MinElements && 2*MinElements <= MaxElements+1),
+        "Invalid MaxElements or MinElements.",
+        std::integer_sequence<size_t, MaxElements, MinElements>);
+
+    static const size_t max_elements = MaxElements;
+    static const size_t min_elements = MinElements;
+
+    static size_t get_max_elements() { return MaxElements; }
+    static size_t get_min_elements() { return MinElements; }
+};
 
 /*!
 \brief Linear r-tree creation algorithm parameters - run-time version.
@@ -260,6 +278,43 @@ private:
     size_t m_overlap_cost_threshold;
 };
 
+/*!
+\brief Hilbert curve r-tree packing algorithm parameters.
+
+Values are sorted by the Hilbert curve index of the centroids of their Indexables and then
+the nodes are filled sequentially, level by level. The tree is created faster than with the
+default packing algorithm and the leafs are compact for Points distributed uniformly. The
+structure may be worse for big Boxes or Segments.
+*/
+class hilbert_packing
+{
+};
+
+/*!
+\brief The bounding boxes of nodes of flat_rtree stored with the coordinates of the Indexables.
+
+This is the default storage of flat_rtree.
+*/
+struct exact_node_boxes
+{
+};
+
+/*!
+\brief The bounding boxes of nodes of flat_rtree stored as small integers.
+
+The coordinates of a node box are stored as the numbers of steps from the minimum corner of
+a frame, the box containing the boxes of a few consecutive nodes, and are rounded outwards.
+So the node boxes contain the exact boxes and the queries return the same Values but
+the nodes take several times less memory. Only floating point coordinates can be stored
+this way.
+
+\tparam Integer    Unsigned integral type of the stored coordinates, e.g. std::uint8_t or std::uint16_t.
+*/
+template <typename Integer = std::uint16_t>
+struct quantized_node_boxes
+{
+};
+
 
 template <typename Parameters, typename Strategy>
 class parameters
@@ -329,6 +384,19 @@ inline typename strategy_type<Parameters>::result_type
     return get_strategy_impl<Parameters>::apply(parameters);
 }
 
+
+template <typename Packing>
+struct is_packing
+{
+    static const bool value = false;
+};
+
+template <>
+struct is_packing<hilbert_packing>
+{
+    static const bool value = true;
+};
+
 } // namespace detail
 
 
@@ -22,6 +22,8 @@
 #endif
 
 #include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/join_predicates.hpp>
+#include <boost/geometry/index/detail/within_distance_predicate.hpp>
 #include <boost/geometry/util/tuples.hpp>
 
 /*!
@@ -317,6 +319,39 @@ satisfies(UnaryPredicate const& pred)
     return detail::predicates::satisfies<UnaryPredicate, false>(pred);
 }
 
+/*!
+\brief Generate within_distance() predicate.
+
+Generate a predicate defining Value and Geometry relationship. With this
+predicate query returns indexed Values which Indexables are not farther from
+passed Geometry than passed distance.
+Value is returned by the query if <tt>bg::distance(Geometry, Indexable) <= distance</tt>.
+Contrary to \c nearest() the number of returned Values is not limited, the Values are not sorted
+and the predicate may be used in spatial queries. Internally boost::geometry::comparable_distance()
+is used to check Indexables and nodes of the rtree and the distance is converted to comparable distance.
+The distance is calculated with the strategy passed to the rtree in the parameters.
+
+\par Example
+\verbatim
+bgi::query(spatial_index, bgi::within_distance(pt, 10.0), std::back_inserter(result));
+bgi::query(spatial_index, bgi::within_distance(pt, 10.0) && bgi::satisfies(is_red), std::back_inserter(result));
+\endverbatim
+
+\ingroup predicates
+
+\tparam Geometry    The Geometry type.
+\tparam T           The type of distance.
+
+\param g            The Geometry object.
+\param distance     The maximum distance between the Geometry and Indexables.
+*/
+template <typename Geometry, typename T> inline
+detail::predicates::within_distance<Geometry, T>
+within_distance(Geometry const& g, T const& distance)
+{
+    return detail::predicates::within_distance<Geometry, T>(g, distance);
+}
+
 /*!
 \brief Generate nearest() predicate.
 
@@ -347,6 +382,55 @@ nearest(Geometry const& geometry, std::size_t k)
     return detail::predicates::nearest<Geometry>(geometry, k);
 }
 
+/*!
+\brief Generate join_intersects() predicate.
+
+Generate a predicate defining the relationship of Values stored in two rtrees. With this
+predicate join returns pairs of Values which Indexables intersect.
+A pair is returned if <tt>bg::intersects(Indexable1, Indexable2)</tt> returns <tt>true</tt>.
+
+\par Example
+\verbatim
+bgi::join(rtree1, rtree2, bgi::join_intersects(), [&](Value1 const& v1, Value2 const& v2) {
+    pairs.emplace_back(v1, v2);
+});
+\endverbatim
+
+\ingroup predicates
+*/
+inline detail::predicates::join_intersects join_intersects()
+{
+    return detail::predicates::join_intersects();
+}
+
+/*!
+\brief Generate join_within_distance() predicate.
+
+Generate a predicate defining the relationship of Values stored in two rtrees. With this
+predicate join returns pairs of Values which Indexables are not farther from each other
+than the passed distance.
+A pair is returned if <tt>bg::distance(Indexable1, Indexable2) <= distance</tt>.
+
+\par Example
+\verbatim
+bgi::join(rtree1, rtree2, bgi::join_within_distance(10.0), [&](Value1 const& v1, Value2 const& v2) {
+    pairs.emplace_back(v1, v2);
+});
+\endverbatim
+
+\ingroup predicates
+
+\tparam T           The type of distance.
+
+\param distance     The maximum distance between Indexables.
+*/
+template <typename T> inline
+detail::predicates::join_within_distance<T>
+join_within_distance(T const& distance)
+{
+    return detail::predicates::join_within_distance<T>(distance);
+}
+
 #ifdef BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL_PREDICATES
 
 /*!
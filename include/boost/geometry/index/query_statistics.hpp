@@ -0,0 +1,110 @@
+// Boost.Geometry Index
+//
+// R-tree query statistics
+//
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_QUERY_STATISTICS_HPP
+#define BOOST_GEOMETRY_INDEX_QUERY_STATISTICS_HPP
+
+#include <cstddef>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The counters of the work done by queries.
+
+The object may be passed to rtree::query(). The counters are incremented by the query and
+are not reset so the work of many queries may be gathered in one object.
+
+\par Example
+\verbatim
+bgi::query_statistics stats;
+tree.query(bgi::intersects(box), std::back_inserter(result), stats);
+std::cout << stats.leaves << " leaves visited\n";
+\endverbatim
+*/
+struct query_statistics
+{
+    query_statistics()
+    {
+        clear();
+    }
+
+    /*!
+    \brief Sets all counters to 0.
+    */
+    void clear()
+    {
+        internal_nodes = 0;
+        leaves = 0;
+        boxes = 0;
+        values = 0;
+        queue_pushes = 0;
+        queue_pops = 0;
+        queue_max_size = 0;
+    }
+
+    /*! \brief The number of internal nodes visited. */
+    std::size_t internal_nodes;
+    /*! \brief The number of leaves visited. */
+    std::size_t leaves;
+    /*! \brief The number of boxes of children of internal nodes checked. */
+    std::size_t boxes;
+    /*! \brief The number of values checked. */
+    std::size_t values;
+    /*! \brief The number of nodes pushed to the queue of the nearest query. */
+    std::size_t queue_pushes;
+    /*! \brief The number of nodes popped from the queue of the nearest query. */
+    std::size_t queue_pops;
+    /*! \brief The maximum size of the queue of the nearest query. */
+    std::size_t queue_max_size;
+};
+
+namespace detail {
+
+// The hooks called by query visitors
+
+// Used by default, calls are optimized away
+struct no_query_statistics
+{
+    void internal_node() {}
+    void leaf() {}
+    void box() {}
+    void value() {}
+    void push(std::size_t /*queue_size*/) {}
+    void pop() {}
+};
+
+struct query_statistics_counter
+{
+    explicit query_statistics_counter(query_statistics & s)
+        : stats(s)
+    {}
+
+    void internal_node() { ++stats.internal_nodes; }
+    void leaf() { ++stats.leaves; }
+    void box() { ++stats.boxes; }
+    void value() { ++stats.values; }
+    void push(std::size_t queue_size)
+    {
+        ++stats.queue_pushes;
+        if (stats.queue_max_size < queue_size)
+        {
+            stats.queue_max_size = queue_size;
+        }
+    }
+    void pop() { ++stats.queue_pops; }
+
+    query_statistics & stats;
+};
+
+} // namespace detail
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_QUERY_STATISTICS_HPP
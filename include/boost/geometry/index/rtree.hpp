@@ -57,6 +57,7 @@
 
 #include <boost/geometry/index/predicates.hpp>
 #include <boost/geometry/index/distance_predicates.hpp>
+#include <boost/geometry/index/query_statistics.hpp>
 #include <boost/geometry/index/detail/rtree/adaptors.hpp>
 
 #include <boost/geometry/index/detail/meta.hpp>
@@ -68,9 +69,11 @@
 #include <boost/geometry/index/detail/rtree/visitors/insert.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/iterator.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/remove.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/update.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/copy.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/spatial_query.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/join.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/distance_query.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/count.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/children_box.hpp>
@@ -78,9 +81,13 @@
 #include <boost/geometry/index/detail/rtree/linear/linear.hpp>
 #include <boost/geometry/index/detail/rtree/quadratic/quadratic.hpp>
 #include <boost/geometry/index/detail/rtree/rstar/rstar.hpp>
-//#include <boost/geometry/extensions/index/detail/rtree/kmeans/kmeans.hpp>
+#include <boost/geometry/index/detail/rtree/kmeans/kmeans.hpp>
 
 #include <boost/geometry/index/detail/rtree/pack_create.hpp>
+#include <boost/geometry/index/detail/rtree/pack_hilbert.hpp>
+#include <boost/geometry/index/detail/rtree/bulk_insert.hpp>
+#include <boost/geometry/index/detail/rtree/bulk_remove.hpp>
+#include <boost/geometry/index/detail/rtree/graft.hpp>
 
 #include <boost/geometry/index/inserter.hpp>
 
@@ -128,7 +135,8 @@ algorithm with specific parameters like min and max number of elements in node.
 Predefined algorithms with compile-time parameters are:
  \li <tt>boost::geometry::index::linear</tt>,
  \li <tt>boost::geometry::index::quadratic</tt>,
- \li <tt>boost::geometry::index::rstar</tt>.
+ \li <tt>boost::geometry::index::rstar</tt>,
+ \li <tt>boost::geometry::index::kmeans</tt>.
 
 \par
 Predefined algorithms with run-time parameters are:
@@ -317,6 +325,8 @@ private:
     typedef typename members_holder::allocator_traits_type allocator_traits_type;
 
     friend class detail::rtree::utilities::view<rtree>;
+    template <typename V, typename P, typename I, typename E, typename A>
+    friend class rtree;
 #ifdef BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL_SERIALIZATION
     friend class detail::rtree::private_view<rtree>;
     friend class detail::rtree::const_private_view<rtree>;
@@ -349,6 +359,13 @@ public:
             value_type, allocators_type
         > const_query_iterator;
 
+    /*! \brief Type of the workspace which memory is reused by nearest queries, see qbegin(). */
+    template <typename Predicates>
+    using nearest_workspace = typename index::detail::rtree::iterators::distance_query_iterator
+        <
+            members_holder, Predicates
+        >::workspace_type;
+
 public:
 
     /*!
@@ -589,6 +606,77 @@ public:
         pack_construct(::boost::begin(rng), ::boost::end(rng), temp_allocator);
     }
 
+    /*!
+    \brief The constructor.
+
+    The tree is created using packing algorithm defined by the packing policy,
+    e.g. parallel_packing or hilbert_packing.
+
+    \param first        The beginning of the range of Values.
+    \param last         The end of the range of Values.
+    \param packing      The packing policy object.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    \li If a thread can't be created.
+    */
+    template
+    <
+        typename Iterator, typename Packing,
+        std::enable_if_t<detail::is_packing<Packing>::value, int> = 0
+    >
+    inline rtree(Iterator first, Iterator last,
+                 Packing const& packing,
+                 parameters_type const& parameters = parameters_type(),
+                 indexable_getter const& getter = indexable_getter(),
+                 value_equal const& equal = value_equal(),
+                 allocator_type const& allocator = allocator_type())
+        : m_members(getter, equal, parameters, allocator)
+    {
+        pack_construct(first, last, boost::container::new_allocator<void>(), packing);
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using packing algorithm defined by the packing policy,
+    e.g. parallel_packing or hilbert_packing.
+
+    \param rng          The range of Values.
+    \param packing      The packing policy object.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    \li If a thread can't be created.
+    */
+    template
+    <
+        typename Range, typename Packing,
+        std::enable_if_t<detail::is_packing<Packing>::value, int> = 0
+    >
+    inline rtree(Range const& rng,
+                 Packing const& packing,
+                 parameters_type const& parameters = parameters_type(),
+                 indexable_getter const& getter = indexable_getter(),
+                 value_equal const& equal = value_equal(),
+                 allocator_type const& allocator = allocator_type())
+        : m_members(getter, equal, parameters, allocator)
+    {
+        pack_construct(::boost::begin(rng), ::boost::end(rng), boost::container::new_allocator<void>(), packing);
+    }
+
     /*!
     \brief The destructor.
 
@@ -597,7 +685,11 @@ public:
     */
     inline ~rtree()
     {
-        this->raw_destroy(*this);
+        // The nodes released together with the allocators are not visited
+        if ( ! detail::rtree::release_nodes<allocators_type>::apply(m_members.allocators()) )
+        {
+            this->raw_destroy(*this);
+        }
     }
 
     /*!
@@ -993,6 +1085,364 @@ public:
         return this->remove_dispatch(conv_or_rng, is_conv_t());
     }
 
+    /*!
+    \brief Insert a range of values to the index at once.
+
+    The values are passed down the tree in groups. In internal nodes each value goes to the child
+    which content is the least enlarged and each overflowing node is split at most once, into as
+    many nodes as needed, in Hilbert order. This is faster than inserting big ranges one by one
+    but the structure of the tree is different than the one created by the balancing algorithm
+    defined by the Parameters.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    template <typename Iterator>
+    inline void bulk_insert(Iterator first, Iterator last)
+    {
+        if ( !m_members.root )
+            this->raw_create();
+
+        this->raw_bulk_insert(first, last);
+    }
+
+    /*!
+    \brief Insert a range of values to the index at once.
+
+    \param rng      The range of values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    template <typename Range>
+    inline void bulk_insert(Range const& rng)
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT((range::detail::is_range<Range>::value),
+            "The argument has to be a Range.",
+            Range);
+
+        this->bulk_insert(boost::const_begin(rng), boost::const_end(rng));
+    }
+
+    /*!
+    \brief Remove a range of values from the container at once.
+
+    Like remove() this method removes only one value for each one passed in the range.
+    The values are passed down the tree in groups, each node is visited once and the elements
+    of underflowed nodes are inserted back together with bulk_insert(). This is faster than
+    removing big ranges one by one but the structure of the tree is different than the one
+    created by the balancing algorithm defined by the Parameters.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \return         The number of removed values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    template <typename Iterator>
+    inline size_type bulk_remove(Iterator first, Iterator last)
+    {
+        if ( !m_members.root )
+            return 0;
+
+        return this->raw_bulk_remove(first, last);
+    }
+
+    /*!
+    \brief Remove a range of values from the container at once.
+
+    \param rng      The range of values.
+
+    \return         The number of removed values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    template <typename Range>
+    inline size_type bulk_remove(Range const& rng)
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT((range::detail::is_range<Range>::value),
+            "The argument has to be a Range.",
+            Range);
+
+        return this->bulk_remove(boost::const_begin(rng), boost::const_end(rng));
+    }
+
+    /*!
+    \brief Remove all values meeting passed predicates from the container.
+
+    Only the nodes meeting spatial predicates are traversed and the values meeting
+    the predicates and the unary predicate are removed from the leafs during one traversal
+    of the tree. The elements of nodes which underflow are inserted back at the end at once.
+    So this is faster than querying the values and removing them one by one.
+
+    \par Example
+    \verbatim
+    // remove expired values intersecting box
+    tree.remove_if(bgi::intersects(box), [&](Value const& v) { return v.expires < now; });
+    \endverbatim
+
+    \param predicates   Spatial predicates, e.g. generated by bgi::intersects().
+    \param fun          The unary predicate taking Value and returning true if the value should be removed.
+
+    \return             The number of removed values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    \li If UnaryPredicate throws.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    template <typename Predicates, typename UnaryPredicate>
+    inline size_type remove_if(Predicates const& predicates, UnaryPredicate const& fun)
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT((detail::predicates_count_distance<Predicates>::value == 0),
+            "Distance predicates can't be passed.",
+            Predicates);
+
+        if ( !m_members.root )
+            return 0;
+
+        detail::rtree::bulk_remove<members_holder>
+            remove_v(m_members.root, m_members.leafs_level,
+                     m_members.parameters(), m_members.translator(), m_members.allocators());
+
+        size_type const result = remove_v.apply_if(predicates, fun);                                // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        BOOST_GEOMETRY_INDEX_ASSERT(result <= m_members.values_count, "unexpected state");
+        m_members.values_count -= result;
+
+        return result;
+    }
+
+    /*!
+    \brief Replace a value stored in the container with another value.
+
+    The result is the same as of <tt>remove(old_value)</tt> followed by <tt>insert(new_value)</tt>
+    but if the indexable of the new value is covered by the box of the leaf containing the old value
+    or by the box of the parent of this leaf the old value is replaced in place and only the boxes
+    of the ancestors of the leaf are adjusted. So small moves of values are much faster than
+    the removal and insertion. Otherwise the value is removed and the new value is inserted.
+
+    \param old_value    The value which will be replaced.
+    \param new_value    The value which will be stored in the container.
+
+    \return             1 if the value was replaced, 0 otherwise. If the old value is not found
+                        the new value is not inserted.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    inline size_type update(value_type const& old_value, value_type const& new_value)
+    {
+        if ( !m_members.root )
+            return 0;
+
+        // CONSIDER: alternative - ignore invalid indexable or throw an exception
+        BOOST_GEOMETRY_INDEX_ASSERT(detail::is_valid(m_members.translator()(new_value)), "Indexable is invalid");
+
+        detail::rtree::visitors::update<members_holder>
+            update_v(old_value, new_value, m_members.parameters(), m_members.translator());
+
+        detail::rtree::apply_visitor(update_v, *m_members.root);                                    // MAY THROW (V: copy)
+
+        if ( update_v.is_value_updated() )
+            return 1;
+
+        if ( ! update_v.is_value_found() )
+            return 0;
+
+        // relocate the value
+        this->raw_remove(old_value);                                                                // MAY THROW (V, E: alloc, copy, N: alloc)
+        if ( !m_members.root )
+            this->raw_create();                                                                     // MAY THROW (N: alloc)
+        this->raw_insert(new_value);                                                                // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        return 1;
+    }
+
+    /*!
+    \brief Move all values of another container into this container.
+
+    If the allocators are equal the nodes of the other container are not copied. Its root is grafted
+    into this container as an element of a node at its level, or both roots become the children of
+    a new root if their heights are equal. Only the nodes at the seam are modified, e.g. the roots
+    having less than Min elements are decomposed and their elements are inserted. So merging is much
+    faster than inserting the values. Otherwise the values are inserted. The other container is empty
+    afterwards.
+
+    \par Example
+    \verbatim
+    // merge the shards
+    tree.merge(std::move(shard));
+    \endverbatim
+
+    \param other    The container which values will be moved. It must have the same parameters.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    inline void merge(rtree&& other)
+    {
+        if ( this == &other || !other.m_members.root )
+            return;
+
+        BOOST_GEOMETRY_INDEX_ASSERT(m_members.parameters().get_max_elements() == other.m_members.parameters().get_max_elements()
+                                 && m_members.parameters().get_min_elements() == other.m_members.parameters().get_min_elements(),
+                                    "the parameters must be the same");
+
+        if ( !(m_members.allocators() == other.m_members.allocators()) )
+        {
+            this->insert(other.begin(), other.end());                                               // MAY THROW (V, E: alloc, copy, N: alloc)
+            other.clear();
+            return;
+        }
+
+        typedef detail::rtree::graft<members_holder> graft_type;
+
+        typename graft_type::subtrees_type subtrees;
+        subtrees.push_back(std::make_pair(other.m_members.leafs_level + 1, other.m_members.root)); // MAY THROW (A)
+        size_type const count = other.m_members.values_count;
+        other.m_members.root = 0;
+        other.m_members.values_count = 0;
+        other.m_members.leafs_level = 0;
+
+        std::vector<value_type> values;
+        graft_type graft_v(m_members.root, m_members.leafs_level,
+                           m_members.parameters(), m_members.translator(), m_members.allocators());
+
+        graft_v.apply(subtrees, values);                                                            // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        m_members.values_count += count;
+    }
+
+    /*!
+    \brief Move all values meeting passed predicates out of this container into a new container.
+
+    Only the nodes meeting spatial predicates are traversed. Whole subtrees which all values surely
+    meet the predicates, e.g. nodes which boxes are covered by the Geometry passed into intersects(),
+    are detached without traversing them and grafted into the new container. The values of other nodes
+    are moved out of the leafs. So the cost depends on the number of touched nodes rather than
+    on the number of extracted values. The nodes of this container which underflow are handled
+    as in remove_if().
+
+    \par Example
+    \verbatim
+    // split the index into two regions
+    Rtree west = tree.extract(bgi::covered_by(west_box));
+    \endverbatim
+
+    \param predicates   Spatial predicates, e.g. generated by bgi::intersects().
+
+    \return             The container storing extracted values, using parameters, observers
+                        and allocator of this container.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    template <typename Predicates>
+    inline rtree extract(Predicates const& predicates)
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT((detail::predicates_count_distance<Predicates>::value == 0),
+            "Distance predicates can't be passed.",
+            Predicates);
+
+        rtree result(m_members.parameters(), m_members.indexable_getter(), m_members.equal_to(),
+                     this->get_allocator());                                                        // MAY THROW (A)
+
+        if ( !m_members.root )
+            return result;
+
+        typedef detail::rtree::graft<members_holder> graft_type;
+
+        typename graft_type::subtrees_type subtrees;
+        std::vector<value_type> values;
+        graft_type graft_v(result.m_members.root, result.m_members.leafs_level,
+                           m_members.parameters(), m_members.translator(), result.m_members.allocators());
+
+        BOOST_TRY
+        {
+            detail::rtree::bulk_remove<members_holder>
+                remove_v(m_members.root, m_members.leafs_level,
+                         m_members.parameters(), m_members.translator(), m_members.allocators());
+
+            size_type const count = remove_v.apply_extract(predicates, subtrees, values);           // MAY THROW (V, E: alloc, copy, N: alloc)
+
+            BOOST_GEOMETRY_INDEX_ASSERT(count <= m_members.values_count, "unexpected state");
+            m_members.values_count -= count;
+            result.m_members.values_count = count;
+        }
+        BOOST_CATCH(...)
+        {
+            graft_v.destroy(subtrees);
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        graft_v.apply(subtrees, values);                                                            // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        return result;
+    }
+
     /*!
     \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
 
@@ -1076,17 +1526,184 @@ public:
     \warning
     Only one \c nearest() predicate may be passed to the query. Passing more of them results in compile-time error.
 
-    \param predicates   Predicates.
-    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it) const
+    {
+        return m_members.root
+             ? query_dispatch(predicates, out_it, detail::no_query_statistics())
+             : 0;
+    }
+
+    /*!
+    \brief Finds values meeting passed predicates and counts the work done by the query.
+
+    This query function works the same way as <tt>query(Predicates const&, OutIter)</tt>
+    and additionally increments the counters of the statistics object: the number of
+    internal nodes and leaves visited, the number of boxes and values checked and in case of
+    the nearest query the number of nodes pushed to and popped from the priority queue and
+    its maximum size. The counters are not reset. The statistics are gathered only if this
+    function is called so other queries are not slowed down.
+
+    \par Example
+    \verbatim
+    bgi::query_statistics stats;
+    tree.query(bgi::nearest(pt, 5), std::back_inserter(result), stats);
+    \endverbatim
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If predicates copy throws.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+    \param stats        The statistics object.
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it,
+                    query_statistics & stats) const
+    {
+        return m_members.root
+             ? query_dispatch(predicates, out_it, detail::query_statistics_counter(stats))
+             : 0;
+    }
+
+    /*!
+    \brief Finds values meeting predicates of many spatial queries at once.
+
+    This method performs many spatial queries during one traversal of the tree. The nodes
+    meeting predicates of several queries are visited once so this is faster than performing
+    the queries one by one, especially if the queries are close to each other.
+    For each value meeting the predicates of a query the function object is called
+    with the index of the query in the range and the value. Values are not passed in
+    any particular order and the calls for different queries may be interleaved.
+    For the information about predicates which may be passed see query().
+
+    If the predicates contain the \c nearest() predicate, e.g. to find k nearest neighbors of
+    many points, the queries are performed one by one in the order of the Hilbert curve so the
+    consecutive queries are close to each other. The neighbors found by the previous query
+    are checked first, which limits the distance to the furthest neighbor before the tree is
+    traversed so fewer nodes are visited. Only one \c nearest() predicate may be passed
+    per query.
+
+    \par Example
+    \verbatim
+    std::vector<Box> boxes = ...;
+    std::vector<std::vector<Value>> results(boxes.size());
+    std::vector<decltype(bgi::intersects(Box()))> predicates;
+    for (Box const& b : boxes)
+        predicates.push_back(bgi::intersects(b));
+
+    tree.batch_query(predicates, [&](std::size_t i, Value const& v) {
+        results[i].push_back(v);
+    });
+
+    std::vector<decltype(bgi::nearest(Point(), 1))> knn_predicates;
+    for (Point const& p : points)
+        knn_predicates.push_back(bgi::nearest(p, 1));
+
+    tree.batch_query(knn_predicates, [&](std::size_t i, Value const& v) {
+        nearest_values[i] = v;
+    });
+    \endverbatim
+
+    \par Throws
+    If the function object throws.
+    If allocation throws.
+
+    \param predicates   The random access range of Predicates.
+    \param fun          The function object called for each found value and query.
+
+    \return             The number of values found for all queries.
+    */
+    template <typename PredicatesRange, typename Function>
+    size_type batch_query(PredicatesRange const& predicates, Function fun) const
+    {
+        typedef typename boost::range_const_iterator<PredicatesRange>::type iterator_type;
+        typedef typename std::iterator_traits<iterator_type>::value_type predicates_type;
+
+        BOOST_GEOMETRY_STATIC_ASSERT((detail::predicates_count_distance<predicates_type>::value <= 1),
+                                     "Only one distance predicate can be passed.",
+                                     predicates_type);
+        BOOST_GEOMETRY_STATIC_ASSERT((std::is_base_of
+                                        <
+                                            std::random_access_iterator_tag,
+                                            typename std::iterator_traits<iterator_type>::iterator_category
+                                        >::value),
+                                     "Random access range of predicates is required.",
+                                     PredicatesRange);
+
+        size_type const count = static_cast<size_type>(::boost::size(predicates));
+        if ( ! m_members.root || count == 0 )
+            return 0;
+
+        return batch_query_dispatch<predicates_type>(::boost::begin(predicates), count, fun);
+    }
+
+    /*!
+    \brief Finds pairs of values stored in this and other rtree meeting the join predicate.
+
+    This method traverses both trees together and descends only into pairs of nodes which
+    bounding boxes meet the predicate, so it's faster than querying one tree for each
+    value stored in the other one. For each pair of values meeting the predicate the function
+    object is called with the value stored in this rtree and the value stored in the other one.
+    Pairs are not passed in any particular order.
+
+    <b>Join predicates</b>
+
+    The join predicate may be generated by one of the functions listed below:
+    \li \c boost::geometry::index::join_intersects(),
+    \li \c boost::geometry::index::join_within_distance().
+
+    The distance is calculated with the strategy of this rtree.
+
+    \par Example
+    \verbatim
+    parcels.join(flood_zones, bgi::join_intersects(),
+                 [&](Parcel const& p, Zone const& z) {
+                     affected.emplace_back(p.id, z.id);
+                 });
+    \endverbatim
+
+    \par Throws
+    If the function object throws.
+    If allocation throws.
 
-    \return             The number of values found.
+    \param other        The other rtree.
+    \param predicate    The join predicate.
+    \param fun          The function object called for each pair of values meeting the predicate.
+
+    \return             The number of pairs found.
     */
-    template <typename Predicates, typename OutIter>
-    size_type query(Predicates const& predicates, OutIter out_it) const
+    template <typename OtherValue, typename OtherParameters, typename OtherIndexableGetter,
+              typename OtherEqualTo, typename OtherAllocator,
+              typename JoinPredicate, typename Function>
+    size_type join(rtree<OtherValue, OtherParameters, OtherIndexableGetter, OtherEqualTo, OtherAllocator> const& other,
+                   JoinPredicate const& predicate, Function fun) const
     {
-        return m_members.root
-             ? query_dispatch(predicates, out_it)
-             : 0;
+        typedef typename rtree
+            <
+                OtherValue, OtherParameters, OtherIndexableGetter, OtherEqualTo, OtherAllocator
+            >::members_holder other_members_holder;
+
+        BOOST_GEOMETRY_STATIC_ASSERT((detail::is_join_predicate<JoinPredicate>::value),
+                                     "Join predicate is required.",
+                                     JoinPredicate);
+
+        if ( ! m_members.root || ! other.m_members.root )
+            return 0;
+
+        detail::rtree::visitors::spatial_join
+            <
+                members_holder, other_members_holder, JoinPredicate, Function
+            > join_v(m_members, other.m_members, predicate, fun);
+        return join_v.apply(m_members, bounds(), other.m_members, other.bounds());
     }
 
     /*!
@@ -1137,6 +1754,62 @@ public:
         return const_query_iterator(qbegin_(predicates));
     }
 
+    /*!
+    \brief Returns a nearest query iterator using the memory of the workspace.
+
+    This method returns an iterator which may be used to perform iterative nearest queries like the
+    one returned by qbegin(Predicates const&). The containers used by the iterator take the memory
+    of the workspace and give it back when the iterator is destroyed. So if the same workspace is
+    passed to subsequent queries the memory allocated by the previous queries is reused and
+    the queries which don't need more memory don't allocate it. Copies of the iterator don't
+    use the workspace.
+
+    The type of the returned iterator is not type-erased so it may be compared with the iterator
+    returned by qend() without allocating memory.
+
+    \par Example
+    \verbatim
+    Rtree::nearest_workspace<decltype(bgi::nearest(Point(), 3))> workspace;
+    for ( Point const& pt : points )
+    {
+        for ( auto it = tree.qbegin(bgi::nearest(pt, 3), workspace) ; it != tree.qend() ; ++it )
+        {
+            // do something with value
+        }
+    }
+    \endverbatim
+
+    \par Iterator category
+    ForwardIterator
+
+    \par Throws
+    If predicates copy throws.
+    If allocation throws.
+
+    \warning
+    The modification of the rtree may invalidate the iterators.
+    The workspace must outlive the iterator and must not be used by many threads at the same time.
+
+    \param predicates   Predicates containing one distance predicate.
+    \param workspace    The workspace which memory is reused.
+
+    \return             The iterator pointing at the begin of the query range.
+    */
+    template <typename Predicates>
+    detail::rtree::iterators::distance_query_iterator<members_holder, Predicates>
+    qbegin(Predicates const& predicates, nearest_workspace<Predicates> & workspace) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT((detail::predicates_count_distance<Predicates>::value == 1),
+            "One distance predicate must be passed.",
+            Predicates);
+
+        typedef detail::rtree::iterators::distance_query_iterator<members_holder, Predicates> iterator_type;
+
+        return m_members.root
+             ? iterator_type(m_members, predicates, workspace)
+             : iterator_type(predicates);
+    }
+
     /*!
     \brief Returns a query iterator pointing at the end of the query range.
 
@@ -1709,6 +2382,69 @@ private:
         return 0;
     }
 
+    /*!
+    \pre Root node must exist - m_root != 0.
+
+    \brief Insert a range of values to the index at once.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \par Exception-safety
+    basic
+    */
+    template <typename Iterator>
+    inline void raw_bulk_insert(Iterator first, Iterator last)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_members.root, "The root must exist");
+
+        std::vector<value_type> values(first, last);                                                // MAY THROW (V, E: alloc, copy)
+
+        for ( typename std::vector<value_type>::const_iterator it = values.begin() ; it != values.end() ; ++it )
+        {
+            // CONSIDER: alternative - ignore invalid indexable or throw an exception
+            BOOST_GEOMETRY_INDEX_ASSERT(detail::is_valid(m_members.translator()(*it)), "Indexable is invalid");
+        }
+
+        detail::rtree::bulk_insert<members_holder>
+            insert_v(m_members.root, m_members.leafs_level,
+                     m_members.parameters(), m_members.translator(), m_members.allocators());
+
+        insert_v.apply(values, 0);                                                                  // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        m_members.values_count += values.size();
+    }
+
+    /*!
+    \pre Root node must exist - m_root != 0.
+
+    \brief Remove a range of values from the container at once.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \par Exception-safety
+    basic
+    */
+    template <typename Iterator>
+    inline size_type raw_bulk_remove(Iterator first, Iterator last)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_members.root, "The root must exist");
+
+        std::vector<value_type> values(first, last);                                                // MAY THROW (V, E: alloc, copy)
+
+        detail::rtree::bulk_remove<members_holder>
+            remove_v(m_members.root, m_members.leafs_level,
+                     m_members.parameters(), m_members.translator(), m_members.allocators());
+
+        size_type const result = remove_v.apply(values);                                            // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        BOOST_GEOMETRY_INDEX_ASSERT(result <= m_members.values_count, "unexpected state");
+        m_members.values_count -= result;
+
+        return result;
+    }
+
     /*!
     \brief Create an empty R-tree i.e. new empty root node and clear other attributes.
 
@@ -1858,13 +2594,14 @@ private:
     */
     template
     <
-        typename Predicates, typename OutIter,
+        typename Predicates, typename OutIter, typename Statistics,
         std::enable_if_t<(detail::predicates_count_distance<Predicates>::value == 0), int> = 0
     >
-    size_type query_dispatch(Predicates const& predicates, OutIter out_it) const
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it,
+                             Statistics const& stats) const
     {
-        detail::rtree::visitors::spatial_query<members_holder, Predicates, OutIter>
-            query(m_members, predicates, out_it);
+        detail::rtree::visitors::spatial_query<members_holder, Predicates, OutIter, Statistics>
+            query(m_members, predicates, out_it, stats);
         return query.apply(m_members);
     }
 
@@ -1876,21 +2613,58 @@ private:
     */
     template
     <
-        typename Predicates, typename OutIter,
+        typename Predicates, typename OutIter, typename Statistics,
         std::enable_if_t<(detail::predicates_count_distance<Predicates>::value > 0), int> = 0
     >
-    size_type query_dispatch(Predicates const& predicates, OutIter out_it) const
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it,
+                             Statistics const& stats) const
     {
         BOOST_GEOMETRY_STATIC_ASSERT((detail::predicates_count_distance<Predicates>::value == 1),
                                      "Only one distance predicate can be passed.",
                                      Predicates);
 
-        detail::rtree::visitors::distance_query<members_holder, Predicates>
-            distance_v(m_members, predicates);
+        detail::rtree::visitors::distance_query<members_holder, Predicates, Statistics>
+            distance_v(m_members, predicates, stats);
 
         return distance_v.apply(m_members, out_it);
     }
 
+    /*!
+    \brief Perform many spatial queries.
+
+    \par Exception-safety
+    strong
+    */
+    template
+    <
+        typename Predicates, typename PredicatesIterator, typename Function,
+        std::enable_if_t<(detail::predicates_count_distance<Predicates>::value == 0), int> = 0
+    >
+    size_type batch_query_dispatch(PredicatesIterator first, size_type count, Function & fun) const
+    {
+        detail::rtree::visitors::spatial_query_batch<members_holder, PredicatesIterator, Function>
+            query(m_members, first, count, fun);
+        return query.apply(m_members);
+    }
+
+    /*!
+    \brief Perform many nearest neighbour searches.
+
+    \par Exception-safety
+    strong
+    */
+    template
+    <
+        typename Predicates, typename PredicatesIterator, typename Function,
+        std::enable_if_t<(detail::predicates_count_distance<Predicates>::value > 0), int> = 0
+    >
+    size_type batch_query_dispatch(PredicatesIterator first, size_type count, Function & fun) const
+    {
+        detail::rtree::visitors::distance_query_batch<members_holder, PredicatesIterator, Function>
+            distance_v(m_members, first, count, fun);
+        return distance_v.apply(m_members);
+    }
+
     /*!
     \brief Count elements corresponding to value or indexable.
 
@@ -1939,6 +2713,62 @@ private:
         m_members.leafs_level = ll;
     }
 
+    /*!
+    \brief Packs the values with the packing policy.
+
+    The tree is created using packing algorithm and the packing policy.
+
+    \param first             The beginning of the range of Values.
+    \param last              The end of the range of Values.
+    \param temp_allocator    The temporary allocator object to be used by the packing algorithm.
+    \param packing           The packing policy object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    \li If a thread can't be created.
+    */
+    template<typename Iterator, typename PackAlloc, typename Packing>
+    inline void pack_construct(Iterator first, Iterator last, PackAlloc const& temp_allocator,
+                               Packing const& packing)
+    {
+        typedef detail::rtree::pack<members_holder> pack;
+        size_type vc = 0, ll = 0;
+        m_members.root = pack::apply(first, last, vc, ll,
+                                     m_members.parameters(), m_members.translator(),
+                                     m_members.allocators(), temp_allocator, packing);
+        m_members.values_count = vc;
+        m_members.leafs_level = ll;
+    }
+
+    /*!
+    \brief Packs the values in the order of the Hilbert curve.
+
+    The tree is created using Hilbert curve packing algorithm.
+
+    \param first             The beginning of the range of Values.
+    \param last              The end of the range of Values.
+    \param temp_allocator    The temporary allocator object to be used by the packing algorithm.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    */
+    template<typename Iterator, typename PackAlloc>
+    inline void pack_construct(Iterator first, Iterator last, PackAlloc const& temp_allocator,
+                               index::hilbert_packing const&)
+    {
+        typedef detail::rtree::pack_hilbert<members_holder> pack;
+        size_type vc = 0, ll = 0;
+        m_members.root = pack::apply(first, last, vc, ll,
+                                     m_members.parameters(), m_members.translator(),
+                                     m_members.allocators(), temp_allocator);
+        m_members.values_count = vc;
+        m_members.leafs_level = ll;
+    }
+
     members_holder m_members;
 };
 
@@ -2072,6 +2902,92 @@ remove(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> & tree,
     return tree.remove(conv_or_rng);
 }
 
+/*!
+\brief Remove all values meeting passed predicates from the container.
+
+It calls <tt>rtree::remove_if(Predicates const&, UnaryPredicate const&)</tt>.
+
+\ingroup rtree_functions
+
+\param tree         The spatial index.
+\param predicates   Spatial predicates.
+\param fun          The unary predicate taking Value and returning true if the value should be removed.
+
+\return             The number of removed values.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+         typename Predicates, typename UnaryPredicate>
+inline typename rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::size_type
+remove_if(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> & tree,
+          Predicates const& predicates, UnaryPredicate const& fun)
+{
+    return tree.remove_if(predicates, fun);
+}
+
+/*!
+\brief Replace a value stored in the container with another value.
+
+It calls <tt>rtree::update(value_type const&, value_type const&)</tt>.
+
+\ingroup rtree_functions
+
+\param tree         The spatial index.
+\param old_value    The value which will be replaced.
+\param new_value    The value which will be stored in the index.
+
+\return             1 if the value was replaced, 0 otherwise.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline typename rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::size_type
+update(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> & tree,
+       Value const& old_value, Value const& new_value)
+{
+    return tree.update(old_value, new_value);
+}
+
+/*!
+\brief Merge two containers.
+
+It calls <tt>rtree::merge(rtree &&)</tt>. Both containers are empty afterwards.
+
+\ingroup rtree_functions
+
+\param l            The first container.
+\param r            The second container.
+
+\return             The container storing the values of both containers.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>
+merge(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> && l,
+      rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> && r)
+{
+    rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> result(std::move(l));
+    result.merge(std::move(r));
+    return result;
+}
+
+/*!
+\brief Move values meeting passed predicates out of the container into a new container.
+
+It calls <tt>rtree::extract(Predicates const&)</tt>.
+
+\ingroup rtree_functions
+
+\param tree         The spatial index.
+\param predicates   Spatial predicates.
+
+\return             The container storing extracted values.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+          typename Predicates> inline
+rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>
+extract(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> & tree,
+        Predicates const& predicates)
+{
+    return tree.extract(predicates);
+}
+
 /*!
 \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
 
@@ -2155,6 +3071,92 @@ query(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
     return tree.query(predicates, out_it);
 }
 
+/*!
+\brief Finds values meeting passed predicates and counts the work done by the query.
+
+It calls <tt>rtree::query(Predicates const&, OutIter, query_statistics&)</tt>.
+
+\ingroup rtree_functions
+
+\param tree         The rtree.
+\param predicates   Predicates.
+\param out_it       The output iterator, e.g. generated by std::back_inserter().
+\param stats        The statistics object.
+
+\return             The number of values found.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+          typename Predicates, typename OutIter> inline
+typename rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::size_type
+query(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
+      Predicates const& predicates,
+      OutIter out_it,
+      query_statistics & stats)
+{
+    return tree.query(predicates, out_it, stats);
+}
+
+/*!
+\brief Finds values meeting predicates of many spatial queries at once.
+
+It calls <tt>rtree::batch_query(PredicatesRange const&, Function)</tt>.
+
+\ingroup rtree_functions
+
+\param tree         The rtree.
+\param predicates   The random access range of Predicates.
+\param fun          The function object called with the index of the query and the found value.
+
+\return             The number of values found for all queries.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+          typename PredicatesRange, typename Function> inline
+typename rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::size_type
+batch_query(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
+            PredicatesRange const& predicates,
+            Function fun)
+{
+    return tree.batch_query(predicates, fun);
+}
+
+/*!
+\brief Finds pairs of values stored in two rtrees meeting the join predicate.
+
+It calls <tt>rtree::join(rtree const&, JoinPredicate const&, Function)</tt>.
+
+\par Example
+\verbatim
+bgi::join(parcels, flood_zones, bgi::join_intersects(),
+          [&](Parcel const& p, Zone const& z) {
+              affected.emplace_back(p.id, z.id);
+          });
+bgi::join(parcels, flood_zones, bgi::join_within_distance(100.0),
+          [&](Parcel const& p, Zone const& z) {
+              close.emplace_back(p.id, z.id);
+          });
+\endverbatim
+
+\ingroup rtree_functions
+
+\param tree1        The first rtree.
+\param tree2        The second rtree.
+\param predicate    The join predicate.
+\param fun          The function object called with the values stored in the first and the second rtree.
+
+\return             The number of pairs found.
+*/
+template <typename Value1, typename Parameters1, typename IndexableGetter1, typename EqualTo1, typename Allocator1,
+          typename Value2, typename Parameters2, typename IndexableGetter2, typename EqualTo2, typename Allocator2,
+          typename JoinPredicate, typename Function> inline
+typename rtree<Value1, Parameters1, IndexableGetter1, EqualTo1, Allocator1>::size_type
+join(rtree<Value1, Parameters1, IndexableGetter1, EqualTo1, Allocator1> const& tree1,
+     rtree<Value2, Parameters2, IndexableGetter2, EqualTo2, Allocator2> const& tree2,
+     JoinPredicate const& predicate,
+     Function fun)
+{
+    return tree1.join(tree2, predicate, fun);
+}
+
 /*!
 \brief Returns the query iterator pointing at the begin of the query range.
 
@@ -0,0 +1,187 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_OBSERVED_OVERLAY_HPP
+#define BOOST_GEOMETRY_STRATEGIES_OBSERVED_OVERLAY_HPP
+
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include <boost/geometry/algorithms/detail/overlay/overlay_phase.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/strategies/detail.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategies
+{
+
+
+/*!
+\brief Umbrella strategy reporting the phases of overlay operations to an observer.
+
+The strategy behaves exactly like the wrapped umbrella strategy but the overlay operations
+of areal geometries (intersection, union, difference, sym_difference) call the observer
+before and after each phase:
+\li observer.phase_start(overlay_phase phase)
+\li observer.phase_end(overlay_phase phase, overlay_counts const& counts)
+
+The phases are not reported if any of the geometries is empty because the result is then
+created without computing the turns. The observer is referenced by the strategy and has to
+outlive it. The overlay operations called with other strategies don't call any observer.
+
+\tparam Strategy An umbrella strategy, e.g. strategies::relate::cartesian<>.
+\tparam Observer The observer type, e.g. overlay_statistics.
+
+\par Example
+\verbatim
+bg::overlay_statistics statistics;
+bg::strategies::observed_overlay
+    <
+        bg::strategies::relate::cartesian<>, bg::overlay_statistics
+    > strategy(statistics);
+bg::union_(multi_polygon1, multi_polygon2, result, strategy);
+\endverbatim
+*/
+template <typename Strategy, typename Observer>
+class observed_overlay
+    : public Strategy
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (strategies::detail::is_umbrella_strategy<Strategy>::value),
+        "The wrapped strategy has to be an umbrella strategy.",
+        Strategy);
+
+public:
+    /*!
+    \brief The constructor.
+
+    \param observer The observer, it has to outlive the strategy.
+    */
+    explicit observed_overlay(Observer& observer)
+        : m_observer(std::addressof(observer))
+    {}
+
+    /*!
+    \brief The constructor.
+
+    \param strategy The wrapped strategy.
+    \param observer The observer, it has to outlive the strategy.
+    */
+    observed_overlay(Strategy const& strategy, Observer& observer)
+        : Strategy(strategy)
+        , m_observer(std::addressof(observer))
+    {}
+
+    Observer& observer() const
+    {
+        return *m_observer;
+    }
+
+private:
+    Observer* m_observer;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+template <typename Strategy>
+struct is_observed_overlay
+    : std::false_type
+{};
+
+template <typename Strategy, typename Observer>
+struct is_observed_overlay<observed_overlay<Strategy, Observer> >
+    : std::true_type
+{};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+} // namespace strategies
+
+
+/*!
+\brief Observer of overlay operations measuring the time spent in each phase.
+\details The times and the sizes are accumulated over all observed overlay operations.
+    The sizes are the final sizes of each operation.
+*/
+class overlay_statistics
+{
+public:
+    using clock_type = std::chrono::steady_clock;
+    using duration_type = clock_type::duration;
+
+    overlay_statistics()
+        : m_durations()
+        , m_operations(0)
+    {}
+
+    void phase_start(overlay_phase)
+    {
+        m_start = clock_type::now();
+    }
+
+    void phase_end(overlay_phase phase, overlay_counts const& counts)
+    {
+        m_durations[static_cast<std::size_t>(phase)] += clock_type::now() - m_start;
+        if (phase == overlay_phase::add_rings)
+        {
+            m_counts += counts;
+            ++m_operations;
+        }
+    }
+
+    //! Time spent in the phase
+    duration_type duration(overlay_phase phase) const
+    {
+        return m_durations[static_cast<std::size_t>(phase)];
+    }
+
+    //! Time spent in all phases
+    duration_type duration() const
+    {
+        duration_type result = duration_type::zero();
+        for (duration_type const& d : m_durations)
+        {
+            result += d;
+        }
+        return result;
+    }
+
+    //! Sum of the sizes of the data analysed by the operations
+    overlay_counts const& counts() const { return m_counts; }
+
+    //! The number of completed operations
+    std::size_t operations() const { return m_operations; }
+
+    void clear()
+    {
+        *this = overlay_statistics();
+    }
+
+private:
+    std::array<duration_type, overlay_phase_count> m_durations;
+    overlay_counts m_counts;
+    std::size_t m_operations;
+    clock_type::time_point m_start;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_OBSERVED_OVERLAY_HPP
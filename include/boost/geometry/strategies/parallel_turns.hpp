@@ -0,0 +1,136 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_PARALLEL_TURNS_HPP
+#define BOOST_GEOMETRY_STRATEGIES_PARALLEL_TURNS_HPP
+
+
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/strategies/detail.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategies
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Base class of parallel_turns, also found in strategies wrapping it
+struct parallel_turns_base {};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Umbrella strategy computing the turns of overlay operations using many threads.
+
+The strategy behaves exactly like the wrapped umbrella strategy but the turns of two
+geometries (the segment-segment intersections of overlapping monotonic sections) are
+computed by several threads. The turns are gathered in the same order as when they are
+computed by one thread so the results of the algorithms are the same.
+
+The wrapped strategy is used by many threads at the same time so it has to be safe
+to use concurrently. The default strategies are.
+
+\tparam Strategy An umbrella strategy, e.g. strategies::relate::cartesian<>.
+
+\par Example
+\verbatim
+bg::strategies::parallel_turns<bg::strategies::relate::cartesian<> > strategy(4);
+bg::intersection(multi_polygon1, multi_polygon2, result, strategy);
+\endverbatim
+*/
+template <typename Strategy>
+class parallel_turns
+    : public Strategy
+    , public detail::parallel_turns_base
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (strategies::detail::is_umbrella_strategy<Strategy>::value),
+        "The wrapped strategy has to be an umbrella strategy.",
+        Strategy);
+
+public:
+    /*!
+    \brief The constructor.
+
+    \param threads  The maximum number of threads computing the turns, including the calling
+                    thread. If 0 the number of hardware threads is used. Default: 0.
+    */
+    explicit parallel_turns(std::size_t threads = 0)
+        : m_threads(threads)
+    {}
+
+    /*!
+    \brief The constructor.
+
+    \param strategy The wrapped strategy.
+    \param threads  The maximum number of threads computing the turns, including the calling
+                    thread. If 0 the number of hardware threads is used. Default: 0.
+    */
+    explicit parallel_turns(Strategy const& strategy, std::size_t threads = 0)
+        : Strategy(strategy)
+        , m_threads(threads)
+    {}
+
+    std::size_t threads() const
+    {
+        if (m_threads == 0)
+        {
+            std::size_t const hardware = std::thread::hardware_concurrency();
+            return hardware > 0 ? hardware : 1;
+        }
+        return m_threads;
+    }
+
+    /*!
+    \brief Returns the wrapped strategy, computing the turns by one thread.
+    */
+    Strategy const& sequential() const
+    {
+        return *this;
+    }
+
+private:
+    std::size_t m_threads;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+template <typename Strategy>
+struct is_parallel_turns
+    : std::is_base_of<parallel_turns_base, Strategy>
+{};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+} // namespace strategies
+
+}} // namespace boost::geometry
+
+
+// The threads are used only by the code including this strategy
+#include <boost/geometry/algorithms/detail/overlay/get_turns_parallel.hpp>
+#include <boost/geometry/algorithms/detail/unary_union/unary_union_parallel.hpp>
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_PARALLEL_TURNS_HPP
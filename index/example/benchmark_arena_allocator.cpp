@@ -0,0 +1,104 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/arena_allocator.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+typedef boost::chrono::thread_clock thread_clock_t;
+typedef boost::chrono::duration<float> dur_t;
+
+template <typename Allocator, typename B>
+void test_allocator(std::vector<B> const& values, const char * name)
+{
+    namespace bgi = boost::geometry::index;
+    typedef bgi::rtree<B, bgi::rstar<16, 4>, bgi::indexable<B>, bgi::equal_to<B>, Allocator> RT;
+
+    {
+        thread_clock_t::time_point start = thread_clock_t::now();
+        {
+            RT t(values.begin(), values.end());
+            dur_t time = thread_clock_t::now() - start;
+            std::cout << time << " - " << name << " pack " << values.size() << '\n';
+            start = thread_clock_t::now();
+        }
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - " << name << " destroy " << values.size() << '\n';
+    }
+
+    {
+        thread_clock_t::time_point start = thread_clock_t::now();
+        {
+            RT t;
+            for ( size_t i = 0 ; i < values.size() ; ++i )
+                t.insert(values[i]);
+            dur_t time = thread_clock_t::now() - start;
+            std::cout << time << " - " << name << " insert " << values.size() << '\n';
+
+            start = thread_clock_t::now();
+            for ( size_t i = 0 ; i < values.size() / 2 ; ++i )
+                t.remove(values[i]);
+            for ( size_t i = 0 ; i < values.size() / 2 ; ++i )
+                t.insert(values[i]);
+            time = thread_clock_t::now() - start;
+            std::cout << time << " - " << name << " remove and insert " << values.size() / 2 << '\n';
+            start = thread_clock_t::now();
+        }
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - " << name << " destroy " << values.size() << '\n';
+    }
+}
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+
+    size_t values_count = 1000000;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::box<P> B;
+
+    std::vector<B> values;
+
+    //randomize values
+    {
+        boost::mt19937 rng;
+        float max_val = 1000;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+
+        std::cout << "randomizing data\n";
+        values.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            float x = rnd();
+            float y = rnd();
+            values.push_back(B(P(x - 0.5f, y - 0.5f), P(x + 0.5f, y + 0.5f)));
+        }
+        std::cout << "randomized\n";
+    }
+
+    for (;;)
+    {
+        test_allocator<std::allocator<B> >(values, "std::allocator");
+        test_allocator<bgi::arena_allocator<B> >(values, "arena_allocator");
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
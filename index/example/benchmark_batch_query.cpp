@@ -0,0 +1,150 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+    typedef boost::chrono::thread_clock clock_t;
+    typedef boost::chrono::duration<float> dur_t;
+
+    size_t values_count = 1000000;
+    size_t queries_count = 1000000;
+    size_t batch_sizes[] = { 1, 4, 16, 64, 256 };
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::box<P> B;
+    typedef bgi::rtree<B, bgi::rstar<16, 4> > RT;
+    typedef decltype(bgi::intersects(B())) Pred;
+    typedef decltype(bgi::nearest(P(), 1)) NPred;
+
+    std::vector<B> values;
+    std::vector<B> queries;
+
+    //randomize values and queries
+    {
+        boost::mt19937 rng;
+        // ~25 values in the area of a query
+        float max_val = 1000;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+        boost::uniform_real<float> range_near(-20, 20);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd_near(rng, range_near);
+
+        std::cout << "randomizing data\n";
+        values.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            float x = rnd();
+            float y = rnd();
+            values.push_back(B(P(x - 0.5f, y - 0.5f), P(x + 0.5f, y + 0.5f)));
+        }
+
+        // groups of queries close to each other, e.g. generated by a spatial join
+        queries.reserve(queries_count);
+        for ( size_t i = 0 ; i < queries_count ; i += 256 )
+        {
+            float x = rnd();
+            float y = rnd();
+            for ( size_t j = 0 ; j < 256 && i + j < queries_count ; ++j )
+            {
+                float qx = x + rnd_near();
+                float qy = y + rnd_near();
+                queries.push_back(B(P(qx - 5, qy - 5), P(qx + 5, qy + 5)));
+            }
+        }
+        std::cout << "randomized\n";
+    }
+
+    RT t(values.begin(), values.end());
+
+    for (;;)
+    {
+        {
+            std::vector<B> result;
+            clock_t::time_point start = clock_t::now();
+            size_t temp = 0;
+            for ( size_t i = 0 ; i < queries_count ; ++i )
+            {
+                result.clear();
+                t.query(bgi::intersects(queries[i]), std::back_inserter(result));
+                temp += result.size();
+            }
+            dur_t time = clock_t::now() - start;
+            std::cout << time << " - query(B) " << queries_count << " found " << temp << '\n';
+        }
+
+        for ( size_t b = 0 ; b < sizeof(batch_sizes) / sizeof(batch_sizes[0]) ; ++b )
+        {
+            size_t batch_size = batch_sizes[b];
+            std::vector<Pred> predicates;
+            predicates.reserve(batch_size);
+
+            clock_t::time_point start = clock_t::now();
+            size_t temp = 0;
+            for ( size_t i = 0 ; i < queries_count ; i += batch_size )
+            {
+                predicates.clear();
+                for ( size_t j = i ; j < i + batch_size && j < queries_count ; ++j )
+                    predicates.push_back(bgi::intersects(queries[j]));
+                temp += t.batch_query(predicates, [](size_t, B const&) {});
+            }
+            dur_t time = clock_t::now() - start;
+            std::cout << time << " - batch_query(B) " << queries_count << " batch " << batch_size
+                      << " found " << temp << '\n';
+        }
+
+        {
+            std::vector<B> result;
+            clock_t::time_point start = clock_t::now();
+            size_t temp = 0;
+            for ( size_t i = 0 ; i < queries_count ; ++i )
+            {
+                result.clear();
+                t.query(bgi::nearest(queries[i].min_corner(), 5), std::back_inserter(result));
+                temp += result.size();
+            }
+            dur_t time = clock_t::now() - start;
+            std::cout << time << " - query(nearest(P, 5)) " << queries_count << " found " << temp << '\n';
+        }
+
+        for ( size_t b = 0 ; b < sizeof(batch_sizes) / sizeof(batch_sizes[0]) ; ++b )
+        {
+            size_t batch_size = batch_sizes[b];
+            std::vector<NPred> predicates;
+            predicates.reserve(batch_size);
+
+            clock_t::time_point start = clock_t::now();
+            size_t temp = 0;
+            for ( size_t i = 0 ; i < queries_count ; i += batch_size )
+            {
+                predicates.clear();
+                for ( size_t j = i ; j < i + batch_size && j < queries_count ; ++j )
+                    predicates.push_back(bgi::nearest(queries[j].min_corner(), 5));
+                temp += t.batch_query(predicates, [](size_t, B const&) {});
+            }
+            dur_t time = clock_t::now() - start;
+            std::cout << time << " - batch_query(nearest(P, 5)) " << queries_count << " batch " << batch_size
+                      << " found " << temp << '\n';
+        }
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+template <typename Tree, typename B>
+void test_queries(Tree const& t, std::vector<B> const& queries, const char * name)
+{
+    typedef boost::chrono::thread_clock clock_t;
+    typedef boost::chrono::duration<float> dur_t;
+
+    std::vector<B> result;
+    clock_t::time_point start = clock_t::now();
+    size_t temp = 0;
+    for ( size_t i = 0 ; i < queries.size() ; ++i )
+    {
+        result.clear();
+        t.query(boost::geometry::index::intersects(queries[i]), std::back_inserter(result));
+        temp += result.size();
+    }
+    dur_t time = clock_t::now() - start;
+    std::cout << time << " - " << name << " query(B) " << queries.size() << " found " << temp << '\n';
+}
+
+template <typename Tree, typename B>
+void test_delta(std::vector<B> const& values, std::vector<B> const& delta,
+                std::vector<B> const& queries, const char * name)
+{
+    typedef boost::chrono::thread_clock clock_t;
+    typedef boost::chrono::duration<float> dur_t;
+
+    Tree t1(values.begin(), values.end());
+    Tree t2(values.begin(), values.end());
+
+    clock_t::time_point start = clock_t::now();
+    for ( size_t i = 0 ; i < delta.size() ; ++i )
+        t1.insert(delta[i]);
+    dur_t time = clock_t::now() - start;
+    std::cout << time << " - " << name << " insert(V) loop " << delta.size() << '\n';
+
+    start = clock_t::now();
+    t2.bulk_insert(delta.begin(), delta.end());
+    time = clock_t::now() - start;
+    std::cout << time << " - " << name << " bulk_insert(first, last) " << delta.size() << '\n';
+
+    test_queries(t1, queries, "after insert(V) loop");
+    test_queries(t2, queries, "after bulk_insert(first, last)");
+
+    start = clock_t::now();
+    size_t removed = 0;
+    for ( size_t i = 0 ; i < delta.size() ; ++i )
+        removed += t1.remove(delta[i]);
+    time = clock_t::now() - start;
+    std::cout << time << " - " << name << " remove(V) loop " << delta.size() << " removed " << removed << '\n';
+
+    start = clock_t::now();
+    removed = t2.bulk_remove(delta.begin(), delta.end());
+    time = clock_t::now() - start;
+    std::cout << time << " - " << name << " bulk_remove(first, last) " << delta.size() << " removed " << removed << '\n';
+
+    test_queries(t1, queries, "after remove(V) loop");
+    test_queries(t2, queries, "after bulk_remove(first, last)");
+}
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+
+    size_t values_count = 2000000;
+    size_t delta_count = 200000;
+    size_t queries_count = 100000;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::box<P> B;
+
+    std::vector<B> values;
+    std::vector<B> delta;
+    std::vector<B> queries;
+
+    //randomize values and queries
+    {
+        boost::mt19937 rng;
+        float max_val = 1000;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+
+        std::cout << "randomizing data\n";
+        values.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            float x = rnd();
+            float y = rnd();
+            values.push_back(B(P(x - 0.5f, y - 0.5f), P(x + 0.5f, y + 0.5f)));
+        }
+
+        delta.reserve(delta_count);
+        for ( size_t i = 0 ; i < delta_count ; ++i )
+        {
+            float x = rnd();
+            float y = rnd();
+            delta.push_back(B(P(x - 0.5f, y - 0.5f), P(x + 0.5f, y + 0.5f)));
+        }
+
+        queries.reserve(queries_count);
+        for ( size_t i = 0 ; i < queries_count ; ++i )
+        {
+            float x = rnd();
+            float y = rnd();
+            queries.push_back(B(P(x - 5, y - 5), P(x + 5, y + 5)));
+        }
+        std::cout << "randomized\n";
+    }
+
+    for (;;)
+    {
+        test_delta<bgi::rtree<B, bgi::linear<16, 4> > >(values, delta, queries, "linear");
+        test_delta<bgi::rtree<B, bgi::quadratic<16, 4> > >(values, delta, queries, "quadratic");
+        test_delta<bgi::rtree<B, bgi::rstar<16, 4> > >(values, delta, queries, "rstar");
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/concurrent_rtree.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+typedef boost::chrono::steady_clock steady_clock_t;
+typedef boost::chrono::duration<float> dur_t;
+
+// The rtree locked with a mutex for queries and for each burst of updates
+template <typename B, typename Params>
+struct locked_rtree
+{
+    typedef boost::geometry::index::rtree<B, Params> rtree_type;
+
+    explicit locked_rtree(std::vector<B> const& values)
+        : tree(values)
+    {}
+
+    template <typename Predicates, typename OutIter>
+    size_t query(Predicates const& pred, OutIter out_it) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return tree.query(pred, out_it);
+    }
+
+    void insert(std::vector<B> const& burst)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tree.insert(burst);
+    }
+
+    void remove(std::vector<B> const& burst)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tree.remove(burst);
+    }
+
+    rtree_type tree;
+    mutable std::mutex mutex;
+};
+
+// The concurrent_rtree queried through snapshots
+template <typename B, typename Params>
+struct snapshot_rtree
+{
+    typedef boost::geometry::index::concurrent_rtree<B, Params> rtree_type;
+
+    explicit snapshot_rtree(std::vector<B> const& values)
+        : tree(values)
+    {}
+
+    template <typename Predicates, typename OutIter>
+    size_t query(Predicates const& pred, OutIter out_it) const
+    {
+        return tree.snapshot().query(pred, out_it);
+    }
+
+    void insert(std::vector<B> const& burst)
+    {
+        tree.insert(burst);
+    }
+
+    void remove(std::vector<B> const& burst)
+    {
+        tree.remove(burst);
+    }
+
+    rtree_type tree;
+};
+
+template <typename Tree, typename B>
+void test_readers(std::vector<B> const& values, std::vector<std::vector<B> > const& bursts,
+                  std::vector<B> const& queries, size_t readers_count, const char * name)
+{
+    Tree t(values);
+
+    std::atomic<bool> done(false);
+    std::vector<size_t> counts(readers_count, 0);
+    std::vector<size_t> found(readers_count, 0);
+    std::vector<float> max_latency(readers_count, 0);
+
+    std::vector<std::thread> readers;
+    for ( size_t r = 0 ; r < readers_count ; ++r )
+    {
+        readers.push_back(std::thread([&, r]()
+        {
+            std::vector<B> result;
+            for ( size_t i = r ; ! done ; i = (i + 1) % queries.size() )
+            {
+                result.clear();
+                steady_clock_t::time_point start = steady_clock_t::now();
+                t.query(boost::geometry::index::intersects(queries[i]), std::back_inserter(result));
+                dur_t time = steady_clock_t::now() - start;
+                max_latency[r] = (std::max)(max_latency[r], time.count());
+                found[r] += result.size();
+                ++counts[r];
+            }
+        }));
+    }
+
+    steady_clock_t::time_point start = steady_clock_t::now();
+    for ( size_t i = 0 ; i < bursts.size() ; ++i )
+        t.insert(bursts[i]);
+    for ( size_t i = 0 ; i < bursts.size() ; ++i )
+        t.remove(bursts[i]);
+    dur_t time = steady_clock_t::now() - start;
+
+    done = true;
+    for ( size_t r = 0 ; r < readers_count ; ++r )
+        readers[r].join();
+
+    size_t queries_count = 0;
+    size_t found_count = 0;
+    float latency = 0;
+    for ( size_t r = 0 ; r < readers_count ; ++r )
+    {
+        queries_count += counts[r];
+        found_count += found[r];
+        latency = (std::max)(latency, max_latency[r]);
+    }
+
+    std::cout << time << " - " << name << " updates " << 2 * bursts.size() << " bursts, "
+              << queries_count << " queries found " << found_count
+              << ", max query latency " << latency * 1000 << " ms\n";
+}
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+
+    size_t values_count = 1000000;
+    size_t bursts_count = 20;
+    size_t burst_size = 20000;
+    size_t queries_count = 100000;
+    size_t readers_count = 3;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::box<P> B;
+
+    std::vector<B> values;
+    std::vector<std::vector<B> > bursts;
+    std::vector<B> queries;
+
+    //randomize values and queries
+    {
+        boost::mt19937 rng;
+        float max_val = 1000;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+
+        std::cout << "randomizing data\n";
+        values.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            float x = rnd();
+            float y = rnd();
+            values.push_back(B(P(x - 0.5f, y - 0.5f), P(x + 0.5f, y + 0.5f)));
+        }
+
+        bursts.resize(bursts_count);
+        for ( size_t j = 0 ; j < bursts_count ; ++j )
+        {
+            bursts[j].reserve(burst_size);
+            for ( size_t i = 0 ; i < burst_size ; ++i )
+            {
+                float x = rnd();
+                float y = rnd();
+                bursts[j].push_back(B(P(x - 0.5f, y - 0.5f), P(x + 0.5f, y + 0.5f)));
+            }
+        }
+
+        queries.reserve(queries_count);
+        for ( size_t i = 0 ; i < queries_count ; ++i )
+        {
+            float x = rnd();
+            float y = rnd();
+            queries.push_back(B(P(x - 5, y - 5), P(x + 5, y + 5)));
+        }
+        std::cout << "randomized\n";
+    }
+
+    for (;;)
+    {
+        test_readers<locked_rtree<B, bgi::rstar<16, 4> > >(values, bursts, queries, readers_count, "rtree + mutex");
+        test_readers<snapshot_rtree<B, bgi::rstar<16, 4> > >(values, bursts, queries, readers_count, "concurrent_rtree");
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/flat_rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+typedef boost::chrono::thread_clock thread_clock_t;
+typedef boost::chrono::duration<float> dur_t;
+
+struct get_weight
+{
+    template <typename Value>
+    double operator()(Value const& v) const
+    {
+        return v.second;
+    }
+};
+
+// The heatmap of values, the tiles of the grid are queried
+template <typename Tree, typename B>
+void test_tiles(Tree const& t, std::vector<B> const& tiles, const char * name)
+{
+    typedef typename Tree::value_type V;
+
+    {
+        std::vector<V> result;
+        thread_clock_t::time_point start = thread_clock_t::now();
+        size_t count = 0;
+        double sum = 0;
+        for ( size_t i = 0 ; i < tiles.size() ; ++i )
+        {
+            result.clear();
+            t.query(boost::geometry::index::intersects(tiles[i]), std::back_inserter(result));
+            count += result.size();
+            for ( size_t j = 0 ; j < result.size() ; ++j )
+                sum += result[j].second;
+        }
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - " << name << " query(B) " << tiles.size() << " found " << count << " sum " << sum << '\n';
+    }
+
+    {
+        thread_clock_t::time_point start = thread_clock_t::now();
+        size_t count = 0;
+        for ( size_t i = 0 ; i < tiles.size() ; ++i )
+            count += t.query_count(boost::geometry::index::intersects(tiles[i]));
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - " << name << " query_count(B) " << tiles.size() << " found " << count << '\n';
+    }
+
+    {
+        thread_clock_t::time_point start = thread_clock_t::now();
+        auto const weights = t.aggregates(0.0, get_weight());
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - " << name << " aggregates()\n";
+
+        start = thread_clock_t::now();
+        double sum = 0;
+        for ( size_t i = 0 ; i < tiles.size() ; ++i )
+            sum += t.query_aggregate(boost::geometry::index::intersects(tiles[i]), weights);
+        time = thread_clock_t::now() - start;
+        std::cout << time << " - " << name << " query_aggregate(B) " << tiles.size() << " sum " << sum << '\n';
+    }
+}
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+
+    size_t values_count = 1000000;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::box<P> B;
+    typedef std::pair<P, double> V;
+    typedef bgi::flat_rtree<V, bgi::rstar<16, 4> > FRT;
+
+    std::vector<V> values;
+
+    //randomize values
+    {
+        boost::mt19937 rng;
+        float max_val = 1000;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+
+        std::cout << "randomizing data\n";
+        values.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            float x = rnd();
+            float y = rnd();
+            values.push_back(std::make_pair(P(x, y), rnd()));
+        }
+        std::cout << "randomized\n";
+    }
+
+    FRT ft(values);
+
+    for (;;)
+    {
+        for ( size_t tiles_per_side : { size_t(10), size_t(100), size_t(500) } )
+        {
+            std::vector<B> tiles;
+            double const size = 2000.0 / tiles_per_side;
+            for ( size_t i = 0 ; i < tiles_per_side ; ++i )
+                for ( size_t j = 0 ; j < tiles_per_side ; ++j )
+                    tiles.push_back(B(P(-1000 + i * size, -1000 + j * size),
+                                      P(-1000 + (i + 1) * size, -1000 + (j + 1) * size)));
+
+            std::cout << tiles_per_side << "x" << tiles_per_side << " tiles\n";
+            test_tiles(ft, tiles, "flat_rtree");
+        }
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
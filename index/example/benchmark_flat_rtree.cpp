@@ -0,0 +1,144 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/index/flat_rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+template <typename Tree, typename B>
+void test_queries(Tree const& t, std::vector<B> const& queries, const char * name)
+{
+    typedef boost::chrono::thread_clock clock_t;
+    typedef boost::chrono::duration<float> dur_t;
+
+    {
+        std::vector<B> result;
+        clock_t::time_point start = clock_t::now();
+        size_t temp = 0;
+        for ( size_t i = 0 ; i < queries.size() ; ++i )
+        {
+            result.clear();
+            t.query(boost::geometry::index::intersects(queries[i]), std::back_inserter(result));
+            temp += result.size();
+        }
+        dur_t time = clock_t::now() - start;
+        std::cout << time << " - " << name << " query(B) " << queries.size() << " found " << temp << '\n';
+    }
+
+    {
+        clock_t::time_point start = clock_t::now();
+        size_t temp = 0;
+        for ( size_t i = 0 ; i < queries.size() ; ++i )
+        {
+            for ( auto it = t.qbegin(boost::geometry::index::intersects(queries[i])) ; it != t.qend() ; ++it )
+                ++temp;
+        }
+        dur_t time = clock_t::now() - start;
+        std::cout << time << " - " << name << " qbegin(B) qend() " << queries.size() << " found " << temp << '\n';
+    }
+
+    {
+        std::vector<B> result;
+        clock_t::time_point start = clock_t::now();
+        size_t temp = 0;
+        for ( size_t i = 0 ; i < queries.size() / 10 ; ++i )
+        {
+            result.clear();
+            t.query(boost::geometry::index::nearest(queries[i].min_corner(), 5), std::back_inserter(result));
+            temp += result.size();
+        }
+        dur_t time = clock_t::now() - start;
+        std::cout << time << " - " << name << " query(nearest(P, 5)) " << queries.size() / 10 << " found " << temp << '\n';
+    }
+}
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+    typedef boost::chrono::thread_clock clock_t;
+    typedef boost::chrono::duration<float> dur_t;
+
+    size_t values_count = 1000000;
+    size_t queries_count = 1000000;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::box<P> B;
+    typedef bgi::rtree<B, bgi::rstar<16, 4> > RT;
+    typedef bgi::flat_rtree<B, bgi::rstar<16, 4> > FRT;
+    typedef bgi::flat_rtree<B, bgi::rstar<16, 4>, bgi::indexable<B>, bgi::equal_to<B>,
+                            boost::container::new_allocator<B>, bgi::quantized_node_boxes<> > QFRT;
+    typedef bgi::flat_rtree<B, bgi::rstar<16, 4>, bgi::indexable<B>, bgi::equal_to<B>,
+                            boost::container::new_allocator<B>, bgi::quantized_node_boxes<std::uint8_t> > Q8FRT;
+
+    std::vector<B> values;
+    std::vector<B> queries;
+
+    //randomize values and queries
+    {
+        boost::mt19937 rng;
+        float max_val = 1000;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+
+        std::cout << "randomizing data\n";
+        values.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            float x = rnd();
+            float y = rnd();
+            values.push_back(B(P(x - 0.5f, y - 0.5f), P(x + 0.5f, y + 0.5f)));
+        }
+
+        queries.reserve(queries_count);
+        for ( size_t i = 0 ; i < queries_count ; ++i )
+        {
+            float x = rnd();
+            float y = rnd();
+            queries.push_back(B(P(x - 5, y - 5), P(x + 5, y + 5)));
+        }
+        std::cout << "randomized\n";
+    }
+
+    for (;;)
+    {
+        clock_t::time_point start = clock_t::now();
+        RT t(values.begin(), values.end());
+        dur_t time = clock_t::now() - start;
+        std::cout << time << " - pack " << values_count << '\n';
+
+        start = clock_t::now();
+        FRT ft(t);
+        time = clock_t::now() - start;
+        std::cout << time << " - flatten " << values_count << '\n';
+
+        start = clock_t::now();
+        QFRT qft(t);
+        time = clock_t::now() - start;
+        std::cout << time << " - flatten quantized " << values_count << '\n';
+
+        Q8FRT q8ft(t);
+
+        test_queries(t, queries, "rtree");
+        test_queries(ft, queries, "flat_rtree");
+        test_queries(qft, queries, "flat_rtree quantized 16");
+        test_queries(q8ft, queries, "flat_rtree quantized 8");
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+    typedef boost::chrono::thread_clock clock_t;
+    typedef boost::chrono::duration<float> dur_t;
+
+    size_t values1_count = 1000000;
+    size_t values2_count = 200000;
+    double distance = 0.5;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::box<P> B;
+    typedef bgi::rtree<B, bgi::rstar<16, 4> > RT1;
+    typedef bgi::rtree<P, bgi::rstar<16, 4> > RT2;
+
+    std::vector<B> values1;
+    std::vector<P> values2;
+
+    //randomize values
+    {
+        boost::mt19937 rng;
+        float max_val = 1000;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+
+        std::cout << "randomizing data\n";
+        values1.reserve(values1_count);
+        for ( size_t i = 0 ; i < values1_count ; ++i )
+        {
+            float x = rnd();
+            float y = rnd();
+            values1.push_back(B(P(x - 0.5f, y - 0.5f), P(x + 0.5f, y + 0.5f)));
+        }
+        values2.reserve(values2_count);
+        for ( size_t i = 0 ; i < values2_count ; ++i )
+        {
+            values2.push_back(P(rnd(), rnd()));
+        }
+        std::cout << "randomized\n";
+    }
+
+    RT1 t1(values1.begin(), values1.end());
+    RT2 t2(values2.begin(), values2.end());
+
+    for (;;)
+    {
+        {
+            std::vector<B> result;
+            clock_t::time_point start = clock_t::now();
+            size_t temp = 0;
+            for ( P const& p : t2 )
+            {
+                result.clear();
+                t1.query(bgi::intersects(p), std::back_inserter(result));
+                temp += result.size();
+            }
+            dur_t time = clock_t::now() - start;
+            std::cout << time << " - query(P) " << values2_count << " found " << temp << '\n';
+        }
+
+        {
+            clock_t::time_point start = clock_t::now();
+            size_t temp = t1.join(t2, bgi::join_intersects(), [](B const&, P const&) {});
+            dur_t time = clock_t::now() - start;
+            std::cout << time << " - join(intersects) found " << temp << '\n';
+        }
+
+        {
+            std::vector<B> result;
+            clock_t::time_point start = clock_t::now();
+            size_t temp = 0;
+            for ( P const& p : t2 )
+            {
+                B b(P(bg::get<0>(p) - distance, bg::get<1>(p) - distance),
+                    P(bg::get<0>(p) + distance, bg::get<1>(p) + distance));
+                result.clear();
+                t1.query(bgi::intersects(b)
+                         && bgi::satisfies([&](B const& v) { return bg::distance(v, p) <= distance; }),
+                         std::back_inserter(result));
+                temp += result.size();
+            }
+            dur_t time = clock_t::now() - start;
+            std::cout << time << " - query(B && distance) " << values2_count << " found " << temp << '\n';
+        }
+
+        {
+            clock_t::time_point start = clock_t::now();
+            size_t temp = t1.join(t2, bgi::join_within_distance(distance), [](B const&, P const&) {});
+            dur_t time = clock_t::now() - start;
+            std::cout << time << " - join(within_distance) found " << temp << '\n';
+        }
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
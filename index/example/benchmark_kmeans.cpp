@@ -0,0 +1,146 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+typedef boost::chrono::thread_clock thread_clock_t;
+typedef boost::chrono::duration<float> dur_t;
+
+template <typename Params, typename P, typename B>
+void test_rtree(std::vector<P> const& values, std::vector<B> const& queries,
+                std::vector<P> const& nearest_queries, const char * name)
+{
+    namespace bgi = boost::geometry::index;
+
+    bgi::rtree<P, Params> t;
+
+    {
+        thread_clock_t::time_point start = thread_clock_t::now();
+        for ( size_t i = 0 ; i < values.size() ; ++i )
+            t.insert(values[i]);
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - " << name << " insert " << values.size() << '\n';
+    }
+
+    std::vector<P> result;
+    result.reserve(100);
+
+    {
+        thread_clock_t::time_point start = thread_clock_t::now();
+        size_t temp = 0;
+        for ( size_t i = 0 ; i < queries.size() ; ++i )
+        {
+            result.clear();
+            t.query(bgi::intersects(queries[i]), std::back_inserter(result));
+            temp += result.size();
+        }
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - " << name << " query(B) " << queries.size() << " found " << temp << '\n';
+    }
+
+    {
+        thread_clock_t::time_point start = thread_clock_t::now();
+        size_t temp = 0;
+        for ( size_t i = 0 ; i < nearest_queries.size() ; ++i )
+        {
+            result.clear();
+            t.query(bgi::nearest(nearest_queries[i], 10), std::back_inserter(result));
+            temp += result.size();
+        }
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - " << name << " query(nearest(P, 10)) " << nearest_queries.size()
+                  << " found " << temp << '\n';
+    }
+}
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+
+    size_t values_count = 1000000;
+    size_t clusters_count = 200;
+    size_t queries_count = 100000;
+    size_t nearest_queries_count = 100000;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::box<P> B;
+
+    std::vector<P> values;
+    std::vector<B> queries;
+    std::vector<P> nearest_queries;
+
+    // randomize values in clusters, e.g. GPS positions recorded along the roads in cities,
+    // inserted in the order of recording
+    {
+        boost::mt19937 rng;
+        float max_val = 1000;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+        boost::normal_distribution<float> spread(0, 2);
+        boost::variate_generator<boost::mt19937&, boost::normal_distribution<float> > rnd_spread(rng, spread);
+        boost::uniform_int<size_t> cluster_range(0, clusters_count - 1);
+        boost::variate_generator<boost::mt19937&, boost::uniform_int<size_t> > rnd_cluster(rng, cluster_range);
+
+        std::cout << "randomizing data\n";
+        std::vector<P> centers;
+        for ( size_t i = 0 ; i < clusters_count ; ++i )
+            centers.push_back(P(rnd(), rnd()));
+
+        values.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; )
+        {
+            // a track of points in a cluster
+            P const& c = centers[rnd_cluster()];
+            float x = bg::get<0>(c) + rnd_spread() * 10;
+            float y = bg::get<1>(c) + rnd_spread() * 10;
+            for ( size_t j = 0 ; j < 100 && i < values_count ; ++j, ++i )
+            {
+                x += rnd_spread() * 0.1f;
+                y += rnd_spread() * 0.1f;
+                values.push_back(P(x, y));
+            }
+        }
+
+        for ( size_t i = 0 ; i < queries_count ; ++i )
+        {
+            P const& c = centers[rnd_cluster()];
+            float x = bg::get<0>(c) + rnd_spread() * 10;
+            float y = bg::get<1>(c) + rnd_spread() * 10;
+            queries.push_back(B(P(x - 1, y - 1), P(x + 1, y + 1)));
+        }
+
+        for ( size_t i = 0 ; i < nearest_queries_count ; ++i )
+        {
+            P const& c = centers[rnd_cluster()];
+            nearest_queries.push_back(P(bg::get<0>(c) + rnd_spread() * 10,
+                                        bg::get<1>(c) + rnd_spread() * 10));
+        }
+        std::cout << "randomized\n";
+    }
+
+    for (;;)
+    {
+        test_rtree< bgi::linear<16, 4> >(values, queries, nearest_queries, "linear<16, 4>");
+        test_rtree< bgi::quadratic<16, 4> >(values, queries, nearest_queries, "quadratic<16, 4>");
+        test_rtree< bgi::rstar<16, 4> >(values, queries, nearest_queries, "rstar<16, 4>");
+        test_rtree< bgi::kmeans<16, 4> >(values, queries, nearest_queries, "kmeans<16, 4>");
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
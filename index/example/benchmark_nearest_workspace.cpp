@@ -0,0 +1,100 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+typedef boost::chrono::thread_clock thread_clock_t;
+typedef boost::chrono::duration<float> dur_t;
+
+// Many short nearest queries, e.g. performed by a routing service
+template <typename RT, typename P>
+void test_nearest(RT const& t, std::vector<P> const& points, unsigned k)
+{
+    namespace bgi = boost::geometry::index;
+
+    {
+        size_t found = 0;
+        thread_clock_t::time_point start = thread_clock_t::now();
+        for ( size_t i = 0 ; i < points.size() ; ++i )
+        {
+            for ( auto it = t.qbegin(bgi::nearest(points[i], k)) ; it != t.qend() ; ++it )
+                ++found;
+        }
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - qbegin(nearest(" << k << ")) " << points.size() << " found " << found << '\n';
+    }
+
+    {
+        typename RT::template nearest_workspace<decltype(bgi::nearest(points[0], k))> workspace;
+
+        size_t found = 0;
+        thread_clock_t::time_point start = thread_clock_t::now();
+        for ( size_t i = 0 ; i < points.size() ; ++i )
+        {
+            for ( auto it = t.qbegin(bgi::nearest(points[i], k), workspace) ; it != t.qend() ; ++it )
+                ++found;
+        }
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - qbegin(nearest(" << k << "), workspace) " << points.size() << " found " << found << '\n';
+    }
+}
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+
+    size_t values_count = 1000000;
+    size_t queries_count = 1000000;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef std::pair<P, size_t> V;
+    typedef bgi::rtree<V, bgi::rstar<16, 4> > RT;
+
+    std::vector<V> values;
+    std::vector<P> points;
+
+    //randomize values and query points
+    {
+        boost::mt19937 rng;
+        float max_val = 1000;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+
+        std::cout << "randomizing data\n";
+        values.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+            values.push_back(std::make_pair(P(rnd(), rnd()), i));
+        points.reserve(queries_count);
+        for ( size_t i = 0 ; i < queries_count ; ++i )
+            points.push_back(P(rnd(), rnd()));
+        std::cout << "randomized\n";
+    }
+
+    RT t(values.begin(), values.end());
+
+    for (;;)
+    {
+        test_nearest(t, points, 1);
+        test_nearest(t, points, 5);
+        test_nearest(t, points, 50);
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
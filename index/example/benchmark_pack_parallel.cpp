@@ -0,0 +1,83 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/index/parallel_packing.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+    // the packing is done by many threads so the wall clock is used
+    typedef boost::chrono::steady_clock clock_t;
+    typedef boost::chrono::duration<float> dur_t;
+
+    size_t values_count = 10000000;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::box<P> B;
+    typedef bgi::rtree<B, bgi::linear<16, 4> > RT;
+
+    std::vector<B> values;
+
+    //randomize values
+    {
+        boost::mt19937 rng;
+        float max_val = static_cast<float>(values_count / 2);
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+
+        values.reserve(values_count);
+
+        std::cout << "randomizing data\n";
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            float x = rnd();
+            float y = rnd();
+            values.push_back(B(P(x - 0.5f, y - 0.5f), P(x + 0.5f, y + 0.5f)));
+        }
+        std::cout << "randomized\n";
+    }
+
+    size_t max_threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+
+    for (;;)
+    {
+        float sequential_time = 0;
+
+        {
+            clock_t::time_point start = clock_t::now();
+            RT t(values.begin(), values.end());
+            dur_t time = clock_t::now() - start;
+            sequential_time = time.count();
+            std::cout << time << " - pack " << values_count << " sequential\n";
+        }
+
+        for ( size_t threads = 1 ; threads <= max_threads ; threads *= 2 )
+        {
+            clock_t::time_point start = clock_t::now();
+            RT t(values.begin(), values.end(), bgi::parallel_packing(threads));
+            dur_t time = clock_t::now() - start;
+            std::cout << time << " - pack " << values_count << " threads " << threads
+                      << " speedup " << sequential_time / time.count() << '\n';
+        }
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
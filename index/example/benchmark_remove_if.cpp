@@ -0,0 +1,102 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+typedef boost::chrono::thread_clock thread_clock_t;
+typedef boost::chrono::duration<float> dur_t;
+
+// Removes the values with odd ids from a region, e.g. expired objects
+template <typename RT, typename V, typename B>
+void test_region(std::vector<V> const& values, B const& region)
+{
+    namespace bgi = boost::geometry::index;
+
+    auto const is_odd = [](V const& v) { return v.second % 2 == 1; };
+
+    {
+        RT t(values.begin(), values.end());
+        thread_clock_t::time_point start = thread_clock_t::now();
+        std::vector<V> result;
+        t.query(bgi::intersects(region) && bgi::satisfies(is_odd), std::back_inserter(result));
+        for ( V const& v : result )
+            t.remove(v);
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - query() remove() " << result.size() << '\n';
+    }
+
+    {
+        RT t(values.begin(), values.end());
+        thread_clock_t::time_point start = thread_clock_t::now();
+        std::vector<V> result;
+        t.query(bgi::intersects(region) && bgi::satisfies(is_odd), std::back_inserter(result));
+        t.remove(result);
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - query() remove(range) " << result.size() << '\n';
+    }
+
+    {
+        RT t(values.begin(), values.end());
+        thread_clock_t::time_point start = thread_clock_t::now();
+        size_t count = t.remove_if(bgi::intersects(region), is_odd);
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - remove_if() " << count << '\n';
+    }
+}
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+
+    size_t values_count = 1000000;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::box<P> B;
+    typedef std::pair<P, size_t> V;
+    typedef bgi::rtree<V, bgi::rstar<16, 4> > RT;
+
+    std::vector<V> values;
+
+    //randomize values
+    {
+        boost::mt19937 rng;
+        float max_val = 1000;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+
+        std::cout << "randomizing data\n";
+        values.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            values.push_back(std::make_pair(P(rnd(), rnd()), i));
+        }
+        std::cout << "randomized\n";
+    }
+
+    for (;;)
+    {
+        test_region<RT>(values, B(P(-100, -100), P(100, 100)));
+        test_region<RT>(values, B(P(-500, -500), P(500, 500)));
+        test_region<RT>(values, B(P(-1000, -1000), P(1000, 1000)));
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+typedef boost::chrono::thread_clock thread_clock_t;
+typedef boost::chrono::duration<float> dur_t;
+
+// Moves all values by the offsets, e.g. the positions of vehicles
+template <typename RT, typename V, typename P>
+void test_moves(std::vector<V> const& values, std::vector<P> const& offsets, double step)
+{
+    namespace bg = boost::geometry;
+
+    std::vector<V> current = values;
+    std::vector<V> moved = values;
+    for ( size_t i = 0 ; i < moved.size() ; ++i )
+    {
+        bg::set<0>(moved[i].first, bg::get<0>(moved[i].first) + bg::get<0>(offsets[i]) * step);
+        bg::set<1>(moved[i].first, bg::get<1>(moved[i].first) + bg::get<1>(offsets[i]) * step);
+    }
+
+    {
+        RT t(values.begin(), values.end());
+        thread_clock_t::time_point start = thread_clock_t::now();
+        for ( size_t i = 0 ; i < values.size() ; ++i )
+        {
+            t.remove(values[i]);
+            t.insert(moved[i]);
+        }
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - remove() insert() " << values.size() << " step " << step << '\n';
+    }
+
+    {
+        RT t(values.begin(), values.end());
+        thread_clock_t::time_point start = thread_clock_t::now();
+        for ( size_t i = 0 ; i < values.size() ; ++i )
+        {
+            t.update(values[i], moved[i]);
+        }
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - update() " << values.size() << " step " << step << '\n';
+    }
+}
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+
+    size_t values_count = 1000000;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef std::pair<P, size_t> V;
+    typedef bgi::rtree<V, bgi::rstar<16, 4> > RT;
+
+    std::vector<V> values;
+    std::vector<P> offsets;
+
+    //randomize values and offsets
+    {
+        boost::mt19937 rng;
+        float max_val = 1000;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+        boost::uniform_real<float> unit_range(-1, 1);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > unit_rnd(rng, unit_range);
+
+        std::cout << "randomizing data\n";
+        values.reserve(values_count);
+        offsets.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            values.push_back(std::make_pair(P(rnd(), rnd()), i));
+            offsets.push_back(P(unit_rnd(), unit_rnd()));
+        }
+        std::cout << "randomized\n";
+    }
+
+    for (;;)
+    {
+        test_moves<RT>(values, offsets, 0.1);
+        test_moves<RT>(values, offsets, 1.0);
+        test_moves<RT>(values, offsets, 10.0);
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
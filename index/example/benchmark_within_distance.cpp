@@ -0,0 +1,126 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+typedef boost::chrono::thread_clock thread_clock_t;
+typedef boost::chrono::duration<float> dur_t;
+
+// Finds the values within the distance from the query points
+template <typename RT, typename P>
+void test_distance(RT const& t, std::vector<P> const& points, double distance)
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+
+    typedef bg::model::box<P> B;
+
+    {
+        thread_clock_t::time_point start = thread_clock_t::now();
+        size_t count = 0;
+        std::vector<P> result;
+        for ( P const& pt : points )
+        {
+            B b(P(bg::get<0>(pt) - distance, bg::get<1>(pt) - distance),
+                P(bg::get<0>(pt) + distance, bg::get<1>(pt) + distance));
+            result.clear();
+            t.query(bgi::intersects(b), std::back_inserter(result));
+            for ( P const& v : result )
+            {
+                if ( bg::distance(pt, v) <= distance )
+                    ++count;
+            }
+        }
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - intersects(box) distance() " << points.size() << " found " << count << '\n';
+    }
+
+    {
+        thread_clock_t::time_point start = thread_clock_t::now();
+        size_t count = 0;
+        std::vector<P> result;
+        for ( P const& pt : points )
+        {
+            result.clear();
+            t.query(bgi::within_distance(pt, distance), std::back_inserter(result));
+            count += result.size();
+        }
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - within_distance() " << points.size() << " found " << count << '\n';
+    }
+
+    {
+        thread_clock_t::time_point start = thread_clock_t::now();
+        size_t count = 0;
+        for ( P const& pt : points )
+        {
+            for ( auto it = t.qbegin(bgi::nearest(pt, t.size())) ; it != t.qend() ; ++it )
+            {
+                if ( bg::distance(pt, *it) > distance )
+                    break;
+                ++count;
+            }
+        }
+        dur_t time = thread_clock_t::now() - start;
+        std::cout << time << " - nearest() iterator " << points.size() << " found " << count << '\n';
+    }
+}
+
+int main()
+{
+    namespace bg = boost::geometry;
+    namespace bgi = bg::index;
+
+    size_t values_count = 1000000;
+    size_t queries_count = 10000;
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bgi::rtree<P, bgi::rstar<16, 4> > RT;
+
+    std::vector<P> values;
+    std::vector<P> points;
+
+    //randomize values and query points
+    {
+        boost::mt19937 rng;
+        float max_val = 1000;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+
+        std::cout << "randomizing data\n";
+        values.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+            values.push_back(P(rnd(), rnd()));
+        points.reserve(queries_count);
+        for ( size_t i = 0 ; i < queries_count ; ++i )
+            points.push_back(P(rnd(), rnd()));
+        std::cout << "randomized\n";
+    }
+
+    RT t(values.begin(), values.end());
+
+    for (;;)
+    {
+        test_distance(t, points, 1.0);
+        test_distance(t, points, 5.0);
+        test_distance(t, points, 20.0);
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
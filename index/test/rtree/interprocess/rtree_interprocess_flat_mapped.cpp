@@ -0,0 +1,73 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <boost/geometry/index/flat_rtree.hpp>
+
+template <typename Params>
+void test_flat_mapped(Params const& params = Params())
+{
+    namespace bi = boost::interprocess;
+    typedef bgi::flat_rtree<box_value_t, Params> flat_rtree_t;
+    typedef bgi::flat_rtree_view<box_value_t, Params> view_t;
+
+    struct file_remove
+    {
+        file_remove() { std::remove("rtree_flat_mapped.dat"); }
+        ~file_remove(){ std::remove("rtree_flat_mapped.dat"); }
+    } remover;
+
+    std::vector<box_value_t> const boxes = generate::scattered_values<box_value_t>(1000, 100, 97);
+
+    flat_rtree_t frt(boxes, params);
+    {
+        std::ofstream os("rtree_flat_mapped.dat", std::ios::binary);
+        frt.write(os);
+        BOOST_CHECK(os.good());
+    }
+
+    bi::file_mapping file("rtree_flat_mapped.dat", bi::read_only);
+    bi::mapped_region region(file, bi::read_only);
+    view_t view(region.get_address(), region.get_size(), params);
+
+    BOOST_CHECK_EQUAL(view.size(), frt.size());
+    BOOST_CHECK(bg::equals(view.bounds(), frt.bounds()));
+
+    box_t const qbox(point_t(20, 30), point_t(45, 60));
+    std::vector<box_value_t> expected, result;
+    frt.query(bgi::intersects(qbox), std::back_inserter(expected));
+    view.query(bgi::intersects(qbox), std::back_inserter(result));
+    BOOST_CHECK(! expected.empty());
+    BOOST_CHECK(basictest::sorted_ids(result) == basictest::sorted_ids(expected));
+
+    expected.clear(); result.clear();
+    frt.query(bgi::nearest(point_t(50.3, 40.7), 10), std::back_inserter(expected));
+    std::copy(view.qbegin(bgi::nearest(point_t(50.3, 40.7), 10)), view.qend(), std::back_inserter(result));
+    BOOST_CHECK(basictest::sorted_ids(result) == basictest::sorted_ids(expected));
+}
+
+int test_main(int, char* [])
+{
+    test_flat_mapped< bgi::linear<4> >();
+    test_flat_mapped< bgi::rstar<16> >();
+    test_flat_mapped(bgi::dynamic_quadratic(8));
+
+    return 0;
+}
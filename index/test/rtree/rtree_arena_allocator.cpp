@@ -0,0 +1,166 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/index/arena_allocator.hpp>
+#include <boost/geometry/index/parallel_packing.hpp>
+
+template <typename Params>
+void test_arena(Params const& params = Params())
+{
+    typedef bgi::arena_allocator<box_value_t> allocator_t;
+    typedef bgi::rtree<box_value_t, Params, bgi::indexable<box_value_t>,
+                       bgi::equal_to<box_value_t>, allocator_t> rtree_t;
+    typedef bgi::rtree<box_value_t, Params> std_rtree_t;
+
+    std::vector<box_value_t> const values = generate::scattered_values<box_value_t>(10000);
+
+    box_t const qbox(point_t(100, 200), point_t(300, 350));
+    std::vector<box_value_t> expected;
+    std_rtree_t srt(values, params);
+    srt.query(bgi::intersects(qbox), std::back_inserter(expected));
+
+    // packing
+    {
+        allocator_t alloc(64 * 1024);
+        rtree_t rt(values, params, bgi::indexable<box_value_t>(), bgi::equal_to<box_value_t>(), alloc);
+        BOOST_CHECK(rt.get_allocator() == alloc);
+        BOOST_CHECK(0 < alloc.slabs_count());
+
+        std::vector<box_value_t> result;
+        rt.query(bgi::intersects(qbox), std::back_inserter(result));
+        basictest::compare_outputs(rt, result, expected);
+
+        // the memory of removed nodes is reused, repeating the same modifications
+        // doesn't allocate new slabs
+        std::size_t slabs_count = 0;
+        for ( int k = 0 ; k < 2 ; ++k )
+        {
+            for ( int j = 0 ; j < 3 ; ++j )
+            {
+                rt.remove(values.begin(), values.begin() + values.size() / 2);
+                rt.insert(values.begin(), values.begin() + values.size() / 2);
+            }
+            rt.clear();
+            rt.insert(values);
+
+            if ( k == 0 )
+                slabs_count = alloc.slabs_count();
+        }
+        BOOST_CHECK_EQUAL(alloc.slabs_count(), slabs_count);
+
+        result.clear();
+        rt.query(bgi::intersects(qbox), std::back_inserter(result));
+        basictest::compare_outputs(rt, result, expected);
+
+        // the copy shares the slabs
+        rtree_t rt2(rt);
+        BOOST_CHECK(rt2.get_allocator() == alloc);
+        rt.clear();
+        result.clear();
+        rt2.query(bgi::intersects(qbox), std::back_inserter(result));
+        basictest::compare_outputs(rt2, result, expected);
+
+        // the moved-from tree may still be used
+        rtree_t rt3(std::move(rt2));
+        rt2.insert(values.begin(), values.begin() + 100);
+        BOOST_CHECK_EQUAL(rt2.size(), 100u);
+        BOOST_CHECK_EQUAL(rt3.size(), values.size());
+    }
+
+    // the arena is not thread-safe so the parallel packing creates the tree with one thread
+    {
+        typedef typename bgi::detail::rtree::utilities::view<rtree_t>::allocators_type allocators_t;
+        BOOST_CHECK(! bgi::detail::rtree::is_thread_safe_allocators<allocators_t>::value);
+
+        rtree_t rt(values.begin(), values.end(), bgi::parallel_packing(4), params);
+        BOOST_CHECK_EQUAL(rt.size(), values.size());
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+
+        std::vector<box_value_t> result;
+        rt.query(bgi::intersects(qbox), std::back_inserter(result));
+        basictest::compare_outputs(rt, result, expected);
+    }
+
+    // trees using different slabs
+    {
+        rtree_t rt1(values.begin(), values.begin() + 100, params);
+        rtree_t rt2(values, params);
+        BOOST_CHECK(rt1.get_allocator() != rt2.get_allocator());
+
+        rt1.swap(rt2);
+        BOOST_CHECK_EQUAL(rt1.size(), values.size());
+        BOOST_CHECK_EQUAL(rt2.size(), 100u);
+        rt2 = rt1;
+        BOOST_CHECK(rt1.get_allocator() == rt2.get_allocator());
+        rt1 = rtree_t(values.begin(), values.begin() + 10, params);
+        BOOST_CHECK_EQUAL(rt1.size(), 10u);
+
+        std::vector<box_value_t> result;
+        rt2.query(bgi::intersects(qbox), std::back_inserter(result));
+        basictest::compare_outputs(rt2, result, expected);
+    }
+}
+
+template <typename Params>
+void test_release_nodes(bool static_nodes, Params const& params = Params())
+{
+    typedef bgi::arena_allocator<box_value_t> allocator_t;
+    typedef bgi::rtree<box_value_t, Params, bgi::indexable<box_value_t>,
+                       bgi::equal_to<box_value_t>, allocator_t> rtree_t;
+    typedef typename bgi::detail::rtree::utilities::view<rtree_t>::allocators_type allocators_t;
+    typedef bgi::detail::rtree::release_nodes<allocators_t> release_t;
+
+    // the nodes are released without visiting them only with the last copy of the allocator
+    {
+        allocators_t allocs((allocator_t(4096)));
+        BOOST_CHECK_EQUAL(release_t::apply(allocs), static_nodes);
+
+        allocator_t alloc(allocs.allocator());
+        BOOST_CHECK(! release_t::apply(allocs));
+    }
+
+    // the slabs are released by the destructor of the tree
+    std::vector<box_value_t> values;
+    for ( int i = 0 ; i < 1000 ; ++i )
+    {
+        double x = (i * 37) % 100;
+        values.push_back(std::make_pair(box_t(point_t(x, i), point_t(x + 1.5, i + 2)), i));
+    }
+    for ( int j = 0 ; j < 10 ; ++j )
+    {
+        rtree_t rt(values, params, bgi::indexable<box_value_t>(), bgi::equal_to<box_value_t>(),
+                   allocator_t(4096));
+        rt.insert(values.begin(), values.begin() + 100);
+        BOOST_CHECK_EQUAL(rt.size(), values.size() + 100);
+    }
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> Point;
+
+    test_rtree_for_box<Point>(bgi::rstar<8, 3>(), bgi::arena_allocator<int>(4096));
+    test_rtree_for_box<Point>(bgi::dynamic_quadratic(6, 2), bgi::arena_allocator<int>(4096));
+
+    test_arena< bgi::linear<16, 4> >();
+    test_arena< bgi::rstar<8, 3> >();
+    test_arena(bgi::dynamic_quadratic(64, 16));
+
+    test_release_nodes< bgi::linear<16, 4> >(true);
+    test_release_nodes< bgi::rstar<8, 3> >(true);
+    test_release_nodes(false, bgi::dynamic_quadratic(64, 16));
+
+    return 0;
+}
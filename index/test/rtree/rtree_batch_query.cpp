@@ -0,0 +1,168 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <vector>
+
+struct is_even
+{
+    bool operator()(box_value_t const& v) const { return v.second % 2 == 0; }
+};
+
+struct value_less
+{
+    bool operator()(box_value_t const& v1, box_value_t const& v2) const { return v1.second < v2.second; }
+};
+
+template <typename Rtree, typename Predicates>
+void check_batch(Rtree const& rt, std::vector<Predicates> const& predicates)
+{
+    std::vector<std::vector<box_value_t> > results(predicates.size());
+    std::size_t found = rt.batch_query(predicates, [&](std::size_t i, box_value_t const& v) {
+        BOOST_CHECK(i < results.size());
+        results[i].push_back(v);
+    });
+
+    std::size_t expected_found = 0;
+    for ( std::size_t i = 0 ; i < predicates.size() ; ++i )
+    {
+        std::vector<box_value_t> expected;
+        expected_found += rt.query(predicates[i], std::back_inserter(expected));
+
+        std::sort(expected.begin(), expected.end(), value_less());
+        std::sort(results[i].begin(), results[i].end(), value_less());
+
+        BOOST_CHECK_EQUAL(results[i].size(), expected.size());
+        bool same = results[i].size() == expected.size();
+        for ( std::size_t j = 0 ; same && j < expected.size() ; ++j )
+            same = results[i][j].second == expected[j].second;
+        BOOST_CHECK(same);
+    }
+
+    BOOST_CHECK_EQUAL(found, expected_found);
+
+    // free function
+    std::size_t count = 0;
+    BOOST_CHECK_EQUAL(bgi::batch_query(rt, predicates, [&](std::size_t, box_value_t const&) { ++count; }),
+                      expected_found);
+    BOOST_CHECK_EQUAL(count, expected_found);
+}
+
+// Neighbors with equal distances may be different so distances are compared
+template <typename Rtree, typename Predicates>
+void check_batch_nearest(Rtree const& rt, std::vector<Predicates> const& predicates,
+                         std::vector<point_t> const& points)
+{
+    std::vector<std::vector<double> > results(predicates.size());
+    std::size_t found = rt.batch_query(predicates, [&](std::size_t i, box_value_t const& v) {
+        BOOST_CHECK(i < results.size());
+        results[i].push_back(bg::comparable_distance(points[i], v.first));
+    });
+
+    std::size_t expected_found = 0;
+    for ( std::size_t i = 0 ; i < predicates.size() ; ++i )
+    {
+        std::vector<box_value_t> expected_values;
+        expected_found += rt.query(predicates[i], std::back_inserter(expected_values));
+        std::vector<double> expected;
+        for ( box_value_t const& v : expected_values )
+            expected.push_back(bg::comparable_distance(points[i], v.first));
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(results[i].begin(), results[i].end());
+        BOOST_CHECK(results[i] == expected);
+    }
+
+    BOOST_CHECK_EQUAL(found, expected_found);
+}
+
+template <typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::rtree<box_value_t, Params> rtree_t;
+
+    std::vector<box_value_t> const values = generate::scattered_values<box_value_t>(1000, 100, 97);
+
+    std::vector<box_t> boxes;
+    for ( int i = 0 ; i < 50 ; ++i )
+    {
+        // overlapping queries close to each other
+        double x = i * 1.5;
+        double y = (i % 7) * 3.0;
+        boxes.push_back(box_t(point_t(x, y), point_t(x + 10, y + 10)));
+    }
+
+    std::vector<decltype(bgi::intersects(box_t()))> intersects;
+    std::vector<decltype(bgi::within(box_t()) && bgi::satisfies(is_even()))> within_even;
+    std::vector<decltype(!bgi::covered_by(box_t()))> not_covered;
+    for ( std::size_t i = 0 ; i < boxes.size() ; ++i )
+    {
+        intersects.push_back(bgi::intersects(boxes[i]));
+        within_even.push_back(bgi::within(boxes[i]) && bgi::satisfies(is_even()));
+        not_covered.push_back(!bgi::covered_by(boxes[i]));
+    }
+
+    rtree_t empty_rt(params);
+    check_batch(empty_rt, intersects);
+
+    rtree_t rt(values, params);
+    check_batch(rt, intersects);
+    check_batch(rt, within_even);
+    check_batch(rt, not_covered);
+    check_batch(rt, std::vector<decltype(bgi::intersects(box_t()))>());
+
+    rtree_t rt_ins(params);
+    rt_ins.insert(values);
+    check_batch(rt_ins, intersects);
+
+    // coherent and scattered query points
+    std::vector<point_t> points;
+    for ( int i = 0 ; i < 200 ; ++i )
+        points.push_back(point_t(i * 0.5, 20 + (i % 10) * 0.3));
+    for ( int i = 0 ; i < 100 ; ++i )
+        points.push_back(point_t((i * 41) % 120 - 10, (i * 29) % 110 - 5));
+
+    std::vector<decltype(bgi::nearest(point_t(), 1))> nearest1, nearest5, nearest0, nearest100;
+    std::vector<decltype(bgi::nearest(point_t(), 3) && bgi::satisfies(is_even()))> nearest_even;
+    for ( std::size_t i = 0 ; i < points.size() ; ++i )
+    {
+        nearest1.push_back(bgi::nearest(points[i], 1));
+        nearest5.push_back(bgi::nearest(points[i], 5 + i % 3));
+        nearest0.push_back(bgi::nearest(points[i], i % 2));
+        nearest100.push_back(bgi::nearest(points[i], 100));
+        nearest_even.push_back(bgi::nearest(points[i], 3) && bgi::satisfies(is_even()));
+    }
+
+    check_batch_nearest(empty_rt, nearest1, points);
+    check_batch_nearest(rt, nearest1, points);
+    check_batch_nearest(rt, nearest5, points);
+    check_batch_nearest(rt, nearest0, points);
+    check_batch_nearest(rt, nearest100, points);
+    check_batch_nearest(rt, nearest_even, points);
+    check_batch_nearest(rt_ins, nearest5, points);
+    check_batch_nearest(rt, std::vector<decltype(bgi::nearest(point_t(), 1))>(), points);
+
+    std::vector<box_value_t> few(values.begin(), values.begin() + 3);
+    check_batch_nearest(rtree_t(few, params), nearest5, points);
+}
+
+int test_main(int, char* [])
+{
+    test_rtree< bgi::linear<4> >();
+    test_rtree< bgi::quadratic<8> >();
+    test_rtree< bgi::rstar<16> >();
+
+    test_rtree(bgi::dynamic_linear(4));
+    test_rtree(bgi::dynamic_quadratic(8));
+    test_rtree(bgi::dynamic_rstar(16));
+
+    return 0;
+}
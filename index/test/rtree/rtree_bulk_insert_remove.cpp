@@ -0,0 +1,207 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+#include <rtree/exceptions/test_throwing_node.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <utility>
+#include <vector>
+
+template <typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::rtree<box_value_t, Params> rtree_t;
+
+    std::vector<box_value_t> const values = generate::scattered_values<box_value_t>(3000);
+
+    // insert into an empty tree, a tree with a leaf root and a taller tree
+    for ( std::size_t count : { std::size_t(0), std::size_t(3), std::size_t(500) } )
+    {
+        rtree_t rt(values.begin(), values.begin() + count, params);
+        rt.bulk_insert(values.begin() + count, values.end());
+        basictest::check_rtree(rt, values);
+    }
+
+    // small deltas
+    {
+        rtree_t rt(params);
+        for ( std::size_t i = 0 ; i < values.size() ; i += 7 )
+            rt.bulk_insert(values.begin() + i, values.begin() + (std::min)(i + 7, values.size()));
+        basictest::check_rtree(rt, values);
+    }
+
+    // input iterators and ranges
+    {
+        std::list<box_value_t> list(values.begin(), values.end());
+        rtree_t rt(params);
+        rt.bulk_insert(list.begin(), list.end());
+        rtree_t rt2(params);
+        rt2.bulk_insert(list);
+        basictest::check_rtree(rt, values);
+        basictest::check_rtree(rt2, values);
+    }
+
+    // remove deltas of different sizes, one value removed for each passed
+    {
+        rtree_t rt(values, params);
+        std::vector<box_value_t> expected = values;
+
+        std::vector<box_value_t> removed;
+        for ( std::size_t i = 0 ; i < expected.size() ; i += 3 )
+            removed.push_back(expected[i]);
+        // missing and duplicated values
+        removed.push_back(generate::scattered_value<box_value_t>::apply(5000, 1000, 997));
+        removed.push_back(removed.front());
+
+        BOOST_CHECK_EQUAL(rt.bulk_remove(removed.begin(), removed.end()), removed.size() - 2);
+
+        std::vector<box_value_t> rest;
+        for ( std::size_t i = 0 ; i < expected.size() ; ++i )
+            if ( i % 3 != 0 )
+                rest.push_back(expected[i]);
+        basictest::check_rtree(rt, rest);
+
+        // a region of the tree
+        box_t const region(point_t(0, 0), point_t(600, 600));
+        std::vector<box_value_t> in_region, out_region;
+        for ( auto const& v : rest )
+            (bg::covered_by(v.first, region) ? in_region : out_region).push_back(v);
+        BOOST_CHECK_EQUAL(rt.bulk_remove(in_region), in_region.size());
+        basictest::check_rtree(rt, out_region);
+
+        // insert them back
+        rt.bulk_insert(in_region);
+        basictest::check_rtree(rt, rest);
+
+        // duplicated values
+        rt.bulk_insert(in_region);
+        rt.bulk_insert(in_region);
+        BOOST_CHECK_EQUAL(rt.bulk_remove(in_region), in_region.size());
+        BOOST_CHECK_EQUAL(rt.bulk_remove(in_region), in_region.size());
+        basictest::check_rtree(rt, rest);
+
+        // everything
+        BOOST_CHECK_EQUAL(rt.bulk_remove(rest), rest.size());
+        basictest::check_rtree(rt, std::vector<box_value_t>());
+        BOOST_CHECK_EQUAL(rt.bulk_remove(rest), 0u);
+
+        rt.bulk_insert(rest);
+        basictest::check_rtree(rt, rest);
+    }
+
+    // remove most values
+    {
+        rtree_t rt(values, params);
+        std::vector<box_value_t> removed(values.begin(), values.end() - 5);
+        std::vector<box_value_t> rest(values.end() - 5, values.end());
+        BOOST_CHECK_EQUAL(rt.bulk_remove(removed), removed.size());
+        basictest::check_rtree(rt, rest);
+    }
+}
+
+// the nodes are not leaked and the counts are valid if the elements of the nodes throw
+template <typename Parameters>
+void test_exceptions(Parameters const& parameters = Parameters())
+{
+    typedef std::pair<bg::model::point<float, 2, bg::cs::cartesian>, throwing_value> Value;
+    typedef bgi::rtree<Value, Parameters> Tree;
+    typedef typename Tree::bounds_type B;
+
+    throwing_value::reset_calls_counter();
+    throwing_value::set_max_calls((std::numeric_limits<size_t>::max)());
+
+    std::vector<Value> input;
+    B qbox;
+    generate::input<2>::apply(input, qbox, 2);
+
+    for ( size_t i = 0 ; i < 100 ; i += 2 )
+    {
+        throwing_static_vector_settings::reset_calls_counter();
+        throwing_static_vector_settings::set_max_calls(10000);
+
+        throwing_nodes_stats::reset_counters();
+
+        {
+            Tree tree(parameters);
+
+            throwing_static_vector_settings::reset_calls_counter();
+            throwing_static_vector_settings::set_max_calls(i);
+
+            BOOST_CHECK_THROW( tree.bulk_insert(input.begin(), input.end()), throwing_static_vector_exception );
+
+            BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(tree, false));
+        }
+
+        BOOST_CHECK_EQUAL(throwing_nodes_stats::internal_nodes_count(), 0u);
+        BOOST_CHECK_EQUAL(throwing_nodes_stats::leafs_count(), 0u);
+    }
+
+    // removing all values doesn't require to add elements to nodes so only a part is removed
+    std::vector<Value> removed;
+    for ( size_t i = 0 ; i < input.size() ; i += 2 )
+        removed.push_back(input[i]);
+
+    // the number of calls which may throw
+    size_t remove_calls = 0;
+    {
+        throwing_static_vector_settings::reset_calls_counter();
+        throwing_static_vector_settings::set_max_calls(10000);
+
+        Tree tree(parameters);
+
+        tree.insert(input.begin(), input.end());
+
+        throwing_static_vector_settings::reset_calls_counter();
+        tree.bulk_remove(removed.begin(), removed.end());
+        remove_calls = throwing_static_vector_settings::get_calls_counter_ref();
+        BOOST_CHECK(0 < remove_calls);
+    }
+
+    for ( size_t i = 0 ; i < remove_calls ; i += 2 )
+    {
+        throwing_static_vector_settings::reset_calls_counter();
+        throwing_static_vector_settings::set_max_calls(10000);
+
+        throwing_nodes_stats::reset_counters();
+
+        {
+            Tree tree(parameters);
+
+            tree.insert(input.begin(), input.end());
+
+            throwing_static_vector_settings::reset_calls_counter();
+            throwing_static_vector_settings::set_max_calls(i);
+
+            BOOST_CHECK_THROW( tree.bulk_remove(removed.begin(), removed.end()), throwing_static_vector_exception );
+
+            BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(tree, false));
+        }
+
+        BOOST_CHECK_EQUAL(throwing_nodes_stats::internal_nodes_count(), 0u);
+        BOOST_CHECK_EQUAL(throwing_nodes_stats::leafs_count(), 0u);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_rtree< bgi::linear<4, 2> >();
+    test_rtree< bgi::quadratic<16> >();
+    test_rtree< bgi::rstar<8, 3> >();
+    test_rtree< bgi::rstar<32> >();
+    test_rtree(bgi::dynamic_linear(5, 2));
+    test_rtree(bgi::dynamic_rstar(16, 4));
+
+    test_exceptions< bgi::linear_throwing<4, 2> >();
+    test_exceptions< bgi::rstar_throwing<4, 2> >();
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/index/concurrent_rtree.hpp>
+
+template <typename Snapshot>
+void check_snapshot(Snapshot const& s, std::vector<box_value_t> const& expected)
+{
+    BOOST_CHECK_EQUAL(s.size(), expected.size());
+    BOOST_CHECK_EQUAL(s.empty(), expected.empty());
+
+    // all values are found in the bounds
+    std::vector<box_value_t> all;
+    if ( ! s.empty() )
+        s.query(bgi::intersects(s.bounds()), std::back_inserter(all));
+    BOOST_CHECK(basictest::sorted_ids(all) == basictest::sorted_ids(expected));
+
+    for ( int i = 0 ; i < 10 ; ++i )
+    {
+        double const x = (i * 97) % 1000;
+        double const y = (i * 89) % 997;
+        box_t const qbox(point_t(x, y), point_t(x + 150, y + 200));
+
+        std::vector<box_value_t> found, brute;
+        s.query(bgi::intersects(qbox), std::back_inserter(found));
+        for ( auto const& v : expected )
+            if ( bg::intersects(v.first, qbox) )
+                brute.push_back(v);
+        BOOST_CHECK(basictest::sorted_ids(found) == basictest::sorted_ids(brute));
+    }
+
+    // the same distances as in the rtree
+    bgi::rtree<box_value_t, bgi::quadratic<8> > rt(expected);
+    for ( int i = 0 ; i < 10 ; ++i )
+    {
+        point_t const pt((i * 131) % 1000, (i * 71) % 997);
+
+        std::vector<box_value_t> found, brute;
+        s.query(bgi::nearest(pt, 7), std::back_inserter(found));
+        rt.query(bgi::nearest(pt, 7), std::back_inserter(brute));
+        BOOST_CHECK_EQUAL(found.size(), brute.size());
+
+        std::vector<double> found_dists, brute_dists;
+        for ( auto const& v : found )
+            found_dists.push_back(bg::comparable_distance(pt, v.first));
+        for ( auto const& v : brute )
+            brute_dists.push_back(bg::comparable_distance(pt, v.first));
+        std::sort(found_dists.begin(), found_dists.end());
+        std::sort(brute_dists.begin(), brute_dists.end());
+        BOOST_CHECK(found_dists == brute_dists);
+    }
+}
+
+template <typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::concurrent_rtree<box_value_t, Params> rtree_t;
+
+    std::vector<box_value_t> const values = generate::scattered_values<box_value_t>(3000);
+
+    // empty
+    {
+        rtree_t rt(params);
+        check_snapshot(rt.snapshot(), std::vector<box_value_t>());
+        BOOST_CHECK_EQUAL(rt.remove(values[0]), 0u);
+        check_snapshot(typename rtree_t::snapshot_type(), std::vector<box_value_t>());
+    }
+
+    // packing and conversion from the rtree
+    {
+        rtree_t rt(values, params);
+        check_snapshot(rt.snapshot(), values);
+
+        bgi::rtree<box_value_t, Params> rt2(values, params);
+        rtree_t rt3(rt2);
+        check_snapshot(rt3.snapshot(), values);
+        BOOST_CHECK(bg::equals(rt3.bounds(), rt2.bounds()));
+    }
+
+    // one by one, the previous snapshots aren't modified
+    {
+        rtree_t rt(params);
+        std::vector<box_value_t> expected;
+        for ( std::size_t i = 0 ; i < values.size() ; ++i )
+        {
+            typename rtree_t::snapshot_type const s = rt.snapshot();
+            rt.insert(values[i]);
+            if ( i % 500 == 0 )
+            {
+                check_snapshot(s, expected);
+                expected.push_back(values[i]);
+                check_snapshot(rt.snapshot(), expected);
+            }
+            else
+            {
+                expected.push_back(values[i]);
+            }
+        }
+        check_snapshot(rt.snapshot(), values);
+
+        std::vector<box_value_t> rest;
+        for ( std::size_t i = 0 ; i < values.size() ; ++i )
+        {
+            if ( i % 3 == 0 )
+                BOOST_CHECK_EQUAL(rt.remove(values[i]), 1u);
+            else
+                rest.push_back(values[i]);
+        }
+        BOOST_CHECK_EQUAL(rt.remove(generate::scattered_value<box_value_t>::apply(5000, 1000, 997)), 0u);
+        check_snapshot(rt.snapshot(), rest);
+
+        for ( auto const& v : rest )
+            BOOST_CHECK_EQUAL(rt.remove(v), 1u);
+        check_snapshot(rt.snapshot(), std::vector<box_value_t>());
+    }
+
+    // ranges
+    {
+        rtree_t rt(values.begin(), values.begin() + 1000, params);
+        typename rtree_t::snapshot_type const s = rt.snapshot();
+
+        rt.insert(values.begin() + 1000, values.end());
+        check_snapshot(rt.snapshot(), values);
+        check_snapshot(s, std::vector<box_value_t>(values.begin(), values.begin() + 1000));
+
+        // a region of the tree
+        box_t const region(point_t(0, 0), point_t(600, 600));
+        std::vector<box_value_t> in_region, out_region;
+        for ( auto const& v : values )
+            (bg::covered_by(v.first, region) ? in_region : out_region).push_back(v);
+        BOOST_CHECK_EQUAL(rt.remove(in_region), in_region.size());
+        check_snapshot(rt.snapshot(), out_region);
+
+        rt.insert(in_region);
+        check_snapshot(rt.snapshot(), values);
+
+        // everything, the tree created by the packing algorithm is not modified
+        BOOST_CHECK_EQUAL(rt.remove(values), values.size());
+        check_snapshot(rt.snapshot(), std::vector<box_value_t>());
+        check_snapshot(s, std::vector<box_value_t>(values.begin(), values.begin() + 1000));
+
+        rt.insert(values);
+        rt.clear();
+        check_snapshot(rt.snapshot(), std::vector<box_value_t>());
+    }
+}
+
+// The values are inserted and removed in pairs, each snapshot contains both values of a pair
+// or none of them
+void test_concurrent_readers()
+{
+    typedef bgi::concurrent_rtree<box_value_t, bgi::rstar<8> > rtree_t;
+
+    std::vector<box_value_t> const values = generate::scattered_values<box_value_t>(2000);
+
+    rtree_t rt(values.begin(), values.begin() + 1000);
+    std::atomic<bool> done(false);
+    std::atomic<std::size_t> errors(0);
+
+    std::vector<std::thread> readers;
+    for ( int t = 0 ; t < 3 ; ++t )
+    {
+        readers.push_back(std::thread([&]()
+        {
+            do
+            {
+                rtree_t::snapshot_type const s = rt.snapshot();
+                std::vector<box_value_t> all;
+                if ( ! s.empty() )
+                    s.query(bgi::intersects(s.bounds()), std::back_inserter(all));
+                std::vector<int> ids = basictest::sorted_ids(all);
+
+                bool ok = ids.size() == s.size() && ids.size() % 2 == 0;
+                for ( std::size_t i = 0 ; ok && i < ids.size() ; i += 2 )
+                    ok = ids[i] % 2 == 0 && ids[i] + 1 == ids[i + 1];
+                if ( ! ok )
+                    ++errors;
+            }
+            while ( ! done );
+        }));
+    }
+
+    for ( int j = 0 ; j < 5 ; ++j )
+    {
+        for ( std::size_t i = 1000 ; i < values.size() ; i += 2 )
+            rt.insert(values.begin() + i, values.begin() + i + 2);
+        for ( std::size_t i = 0 ; i < values.size() ; i += 2 )
+            rt.remove(values.begin() + i, values.begin() + i + 2);
+        for ( std::size_t i = 0 ; i < 1000 ; i += 2 )
+            rt.insert(values.begin() + i, values.begin() + i + 2);
+    }
+
+    done = true;
+    for ( auto & t : readers )
+        t.join();
+
+    BOOST_CHECK_EQUAL(errors.load(), 0u);
+    check_snapshot(rt.snapshot(), std::vector<box_value_t>(values.begin(), values.begin() + 1000));
+}
+
+int test_main(int, char* [])
+{
+    test_rtree< bgi::linear<4, 2> >();
+    test_rtree< bgi::quadratic<16> >();
+    test_rtree< bgi::rstar<8, 3> >();
+    test_rtree(bgi::dynamic_linear(5, 2));
+    test_rtree(bgi::dynamic_rstar(16, 4));
+
+    test_concurrent_readers();
+
+    return 0;
+}
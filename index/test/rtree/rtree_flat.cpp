@@ -0,0 +1,240 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/algorithms/comparable_distance.hpp>
+#include <boost/geometry/index/flat_rtree.hpp>
+
+template <typename Rtree, typename FlatRtree, typename Predicates>
+void check_query(Rtree const& rt, FlatRtree const& frt, Predicates const& pred)
+{
+    typedef typename Rtree::value_type value_t;
+
+    std::vector<value_t> expected;
+    rt.query(pred, std::back_inserter(expected));
+
+    std::vector<value_t> result;
+    BOOST_CHECK_EQUAL(frt.query(pred, std::back_inserter(result)), expected.size());
+    BOOST_CHECK(basictest::sorted_ids(result) == basictest::sorted_ids(expected));
+
+    std::vector<value_t> result_it;
+    for ( auto it = frt.qbegin(pred) ; it != frt.qend() ; ++it )
+        result_it.push_back(*it);
+    BOOST_CHECK(basictest::sorted_ids(result_it) == basictest::sorted_ids(expected));
+
+    // free functions
+    std::vector<value_t> result_f;
+    bgi::query(frt, pred, std::back_inserter(result_f));
+    BOOST_CHECK(basictest::sorted_ids(result_f) == basictest::sorted_ids(expected));
+    BOOST_CHECK_EQUAL(std::distance(bgi::qbegin(frt, pred), bgi::qend(frt)),
+                      std::ptrdiff_t(expected.size()));
+}
+
+// Values with equal distances may be returned in any order so compare distances
+template <typename Rtree, typename FlatRtree>
+void check_nearest(Rtree const& rt, FlatRtree const& frt, point_t const& pt, std::size_t k)
+{
+    typedef typename Rtree::value_type value_t;
+
+    auto distances = [&](std::vector<value_t> const& values) {
+        std::vector<double> result;
+        for ( auto const& v : values )
+            result.push_back(bg::comparable_distance(pt, v.first));
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    std::vector<value_t> expected;
+    rt.query(bgi::nearest(pt, k), std::back_inserter(expected));
+
+    std::vector<value_t> result;
+    BOOST_CHECK_EQUAL(frt.query(bgi::nearest(pt, k), std::back_inserter(result)), expected.size());
+    BOOST_CHECK(distances(result) == distances(expected));
+
+    std::vector<value_t> result_it;
+    double prev = 0;
+    for ( auto it = frt.qbegin(bgi::nearest(pt, k)) ; it != frt.qend() ; ++it )
+    {
+        // incremental query returns values sorted by distance
+        double const d = bg::comparable_distance(pt, it->first);
+        BOOST_CHECK(prev <= d);
+        prev = d;
+        result_it.push_back(*it);
+    }
+    BOOST_CHECK(distances(result_it) == distances(expected));
+}
+
+template <typename Rtree, typename FlatRtree>
+void check_flat(Rtree const& rt, FlatRtree const& frt)
+{
+    BOOST_CHECK_EQUAL(frt.size(), rt.size());
+    BOOST_CHECK_EQUAL(frt.empty(), rt.empty());
+    BOOST_CHECK_EQUAL(std::size_t(std::distance(frt.begin(), frt.end())), rt.size());
+    BOOST_CHECK(basictest::sorted_ids(frt) == basictest::sorted_ids(rt));
+    if ( ! rt.empty() )
+        BOOST_CHECK(bg::equals(frt.bounds(), rt.bounds()));
+
+    point_t const pt(50.25, 40.5);
+    box_t const qbox(point_t(20, 30), point_t(45, 60));
+
+    check_query(rt, frt, bgi::intersects(qbox));
+    check_query(rt, frt, bgi::within(qbox));
+    check_query(rt, frt, bgi::disjoint(qbox));
+    check_query(rt, frt, bgi::intersects(qbox) && bgi::satisfies([](auto const& v) { return v.second % 3 == 0; }));
+    check_query(rt, frt, bgi::intersects(box_t(point_t(1000, 1000), point_t(1001, 1001))));
+
+    check_nearest(rt, frt, pt, 1);
+    check_nearest(rt, frt, pt, 17);
+    check_nearest(rt, frt, pt, 100000);
+    check_query(rt, frt, bgi::nearest(pt, 100000) && bgi::intersects(qbox));
+}
+
+template <typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::rtree<box_value_t, Params> box_rtree_t;
+    typedef bgi::rtree<point_value_t, Params> point_rtree_t;
+    typedef bgi::flat_rtree<box_value_t, Params> box_flat_rtree_t;
+    typedef bgi::flat_rtree<point_value_t, Params> point_flat_rtree_t;
+
+    std::vector<box_value_t> const boxes = generate::scattered_values<box_value_t>(500, 100, 97);
+
+    std::vector<point_value_t> points;
+    for ( int i = 0 ; i < 2000 ; ++i )
+    {
+        double x = (i * 17) % 103 + 0.25;
+        double y = (i * 29) % 89 + 0.5;
+        points.push_back(std::make_pair(point_t(x, y), i));
+    }
+
+    // packed trees
+    {
+        box_rtree_t rt(boxes, params);
+        check_flat(rt, box_flat_rtree_t(rt));
+        check_flat(rt, box_flat_rtree_t(boxes, params));
+    }
+    {
+        point_rtree_t rt(points.begin(), points.end(), params);
+        check_flat(rt, point_flat_rtree_t(rt));
+        check_flat(rt, point_flat_rtree_t(points.begin(), points.end(), params));
+    }
+
+    // tree created by insertion
+    {
+        box_rtree_t rt(params);
+        rt.insert(boxes);
+        check_flat(rt, box_flat_rtree_t(rt));
+    }
+
+    // root being a leaf
+    {
+        std::vector<point_value_t> few(points.begin(), points.begin() + 3);
+        point_rtree_t rt(few, params);
+        check_flat(rt, point_flat_rtree_t(rt));
+    }
+
+    // empty tree
+    {
+        point_rtree_t rt(params);
+        point_flat_rtree_t frt(rt);
+        check_flat(rt, frt);
+        BOOST_CHECK(frt.qbegin(bgi::intersects(box_t(point_t(0, 0), point_t(10, 10)))) == frt.qend());
+        BOOST_CHECK(frt.qbegin(bgi::nearest(point_t(0, 0), 3)) == frt.qend());
+
+        point_flat_rtree_t frt_def(params);
+        BOOST_CHECK(frt_def.empty());
+    }
+
+    // swap
+    {
+        box_rtree_t rt(boxes, params);
+        box_flat_rtree_t frt1(rt);
+        box_flat_rtree_t frt2(params);
+        bgi::swap(frt1, frt2);
+        BOOST_CHECK(frt1.empty());
+        check_flat(rt, frt2);
+    }
+}
+
+// Coordinate types, dimensions and numbers of children handled by the vectorized kernels
+template <typename Point, typename Params>
+void test_scan(Params const& params = Params())
+{
+    typedef bg::model::box<Point> box_type;
+    typedef std::pair<box_type, int> value_type;
+    typedef bgi::rtree<value_type, Params> rtree_type;
+    typedef bgi::flat_rtree<value_type, Params> flat_rtree_type;
+
+    std::vector<value_type> values;
+    for ( int i = 0 ; i < 3000 ; ++i )
+    {
+        Point min_p, max_p;
+        bg::set<0>(min_p, (i * 37) % 100 + 0.125); bg::set<0>(max_p, bg::get<0>(min_p) + 1.5);
+        bg::set<1>(min_p, (i * 53) % 97 + 0.25);   bg::set<1>(max_p, bg::get<1>(min_p) + 2);
+        bg::set<2>(min_p, (i * 11) % 13 + 0.5);    bg::set<2>(max_p, bg::get<2>(min_p) + 0.5);
+        values.push_back(std::make_pair(box_type(min_p, max_p), i));
+    }
+
+    rtree_type rt(values, params);
+    flat_rtree_type frt(rt);
+
+    Point const pt(50.3f, 40.7f, 3.1f);
+    box_type const qbox(Point(20, 30, 2), Point(45, 60, 7.5f));
+
+    check_query(rt, frt, bgi::intersects(qbox));
+    check_query(rt, frt, bgi::covered_by(qbox));
+    check_query(rt, frt, bgi::within(qbox));
+    check_query(rt, frt, bgi::intersects(rt.bounds()));
+
+    for ( std::size_t k : { 1, 10, 100 } )
+    {
+        std::vector<value_type> expected, result, result_it;
+        rt.query(bgi::nearest(pt, k), std::back_inserter(expected));
+        frt.query(bgi::nearest(pt, k), std::back_inserter(result));
+        std::copy(frt.qbegin(bgi::nearest(pt, k)), frt.qend(), std::back_inserter(result_it));
+
+        std::vector<double> dist_expected, dist_result, dist_result_it;
+        for ( auto const& v : expected ) dist_expected.push_back(bg::comparable_distance(pt, v.first));
+        for ( auto const& v : result ) dist_result.push_back(bg::comparable_distance(pt, v.first));
+        for ( auto const& v : result_it ) dist_result_it.push_back(bg::comparable_distance(pt, v.first));
+        std::sort(dist_expected.begin(), dist_expected.end());
+        std::sort(dist_result.begin(), dist_result.end());
+        BOOST_CHECK_EQUAL(result.size(), k);
+        BOOST_CHECK(dist_result == dist_expected);
+        BOOST_CHECK(std::is_sorted(dist_result_it.begin(), dist_result_it.end()));
+        std::sort(dist_result_it.begin(), dist_result_it.end());
+        BOOST_CHECK(dist_result_it == dist_expected);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_rtree< bgi::linear<4> >();
+    test_rtree< bgi::quadratic<8> >();
+    test_rtree< bgi::rstar<16> >();
+
+    test_rtree(bgi::dynamic_linear(4));
+    test_rtree(bgi::dynamic_quadratic(8));
+    test_rtree(bgi::dynamic_rstar(16));
+
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_t;
+    typedef bg::model::point<float, 3, bg::cs::cartesian> point3f_t;
+    test_scan<point3d_t, bgi::linear<16> >();
+    test_scan<point3f_t, bgi::rstar<32> >();
+    test_scan<point3d_t, bgi::quadratic<100> >();
+    test_scan<point3f_t>(bgi::dynamic_linear(70));
+
+    return 0;
+}
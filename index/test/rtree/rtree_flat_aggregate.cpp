@@ -0,0 +1,124 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/index/flat_rtree.hpp>
+
+struct get_id
+{
+    template <typename Value>
+    long operator()(Value const& v) const
+    {
+        return v.second;
+    }
+};
+
+struct max_id
+{
+    long operator()(long l, long r) const
+    {
+        return (std::max)(l, r);
+    }
+};
+
+template <typename Tree, typename Predicates>
+void check_predicates(Tree const& tree, Predicates const& pred)
+{
+    typedef typename Tree::value_type value_t;
+
+    std::vector<value_t> found;
+    tree.query(pred, std::back_inserter(found));
+    long sum = 0, max = -1;
+    for ( auto const& v : found )
+    {
+        sum += v.second;
+        max = (std::max)(max, long(v.second));
+    }
+
+    BOOST_CHECK_EQUAL(tree.query_count(pred), found.size());
+    BOOST_CHECK_EQUAL(tree.query_aggregate(pred, tree.aggregates(0L, get_id())), sum);
+    BOOST_CHECK_EQUAL(tree.query_aggregate(pred, tree.aggregates(-1L, get_id(), max_id())), max);
+}
+
+template <typename Tree>
+void check_tree(Tree const& tree)
+{
+    box_t const all(point_t(-10, -10), point_t(110, 110));
+    box_t const none(point_t(200, 200), point_t(300, 300));
+    BOOST_CHECK_EQUAL(tree.query_count(bgi::intersects(all)), tree.size());
+    BOOST_CHECK_EQUAL(tree.query_count(bgi::intersects(none)), 0u);
+    BOOST_CHECK_EQUAL(tree.query_count(bgi::disjoint(none)), tree.size());
+
+    for ( int i = 0 ; i < 10 ; ++i )
+    {
+        double const x = (i * 97) % 100;
+        double const y = (i * 89) % 97;
+        box_t const qbox(point_t(x - 20, y - 15), point_t(x + 15, y + 20));
+
+        check_predicates(tree, bgi::intersects(qbox));
+        check_predicates(tree, bgi::covered_by(qbox));
+        check_predicates(tree, bgi::within(qbox));
+        check_predicates(tree, bgi::disjoint(qbox));
+        check_predicates(tree, ! bgi::intersects(qbox));
+        check_predicates(tree, ! bgi::covered_by(qbox));
+        check_predicates(tree, ! bgi::disjoint(qbox));
+        check_predicates(tree, bgi::intersects(qbox)
+                            && bgi::satisfies([](typename Tree::value_type const& v) { return v.second % 3 == 0; }));
+        check_predicates(tree, bgi::intersects(qbox) && bgi::disjoint(all));
+    }
+}
+
+template <typename Value, typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::flat_rtree<Value, Params> flat_rtree_t;
+    typedef bgi::flat_rtree_view<Value, Params> view_t;
+
+    std::vector<Value> const values = generate::scattered_values<Value>(2000, 100, 97);
+
+    for ( std::size_t count : { std::size_t(0), std::size_t(1), std::size_t(5), std::size_t(100), values.size() } )
+    {
+        flat_rtree_t frt(values.begin(), values.begin() + count, params);
+        check_tree(frt);
+
+        std::ostringstream os;
+        frt.write(os);
+        std::string const data = os.str();
+
+        // memory aligned like mapped files
+        std::vector<char> storage(data.size() + 64);
+        void * ptr = storage.data();
+        std::size_t space = storage.size();
+        char * aligned = static_cast<char*>(std::align(64, data.size(), ptr, space));
+        std::memcpy(aligned, data.data(), data.size());
+
+        view_t view(aligned, data.size(), params);
+        check_tree(view);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_rtree<point_value_t, bgi::linear<4> >();
+    test_rtree<point_value_t, bgi::rstar<16> >();
+    test_rtree<box_value_t, bgi::quadratic<8> >();
+    test_rtree<box_value_t>(bgi::dynamic_rstar(16, 4));
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/index/flat_rtree.hpp>
+
+// Memory aligned like mapped files
+class aligned_buffer
+{
+public:
+    explicit aligned_buffer(std::string const& data)
+        : m_storage(data.size() + 64)
+    {
+        void * ptr = m_storage.data();
+        std::size_t space = m_storage.size();
+        m_data = static_cast<char*>(std::align(64, data.size(), ptr, space));
+        std::memcpy(m_data, data.data(), data.size());
+        m_size = data.size();
+    }
+
+    char * data() { return m_data; }
+    std::size_t size() const { return m_size; }
+
+private:
+    std::vector<char> m_storage;
+    char * m_data;
+    std::size_t m_size;
+};
+
+template <typename FlatRtree, typename View>
+void check_view(FlatRtree const& frt, View const& view)
+{
+    BOOST_CHECK_EQUAL(view.size(), frt.size());
+    BOOST_CHECK_EQUAL(view.empty(), frt.empty());
+    BOOST_CHECK(std::equal(view.begin(), view.end(), frt.begin(), frt.end(),
+                           [](box_value_t const& l, box_value_t const& r) {
+                               return bg::equals(l.first, r.first) && l.second == r.second;
+                           }));
+    if ( ! frt.empty() )
+        BOOST_CHECK(bg::equals(bgi::bounds(view), bgi::bounds(frt)));
+
+    box_t const qbox(point_t(20, 30), point_t(45, 60));
+    point_t const pt(50.3, 40.7);
+
+    std::vector<box_value_t> expected, result, result_it;
+    frt.query(bgi::intersects(qbox), std::back_inserter(expected));
+    BOOST_CHECK_EQUAL(view.query(bgi::intersects(qbox), std::back_inserter(result)), expected.size());
+    std::copy(view.qbegin(bgi::intersects(qbox)), view.qend(), std::back_inserter(result_it));
+    BOOST_CHECK(basictest::sorted_ids(result) == basictest::sorted_ids(expected));
+    BOOST_CHECK(basictest::sorted_ids(result_it) == basictest::sorted_ids(expected));
+
+    // both trees store the same nodes so the results are the same
+    expected.clear(); result.clear(); result_it.clear();
+    frt.query(bgi::nearest(pt, 10), std::back_inserter(expected));
+    bgi::query(view, bgi::nearest(pt, 10), std::back_inserter(result));
+    std::copy(bgi::qbegin(view, bgi::nearest(pt, 10)), bgi::qend(view), std::back_inserter(result_it));
+    BOOST_CHECK(basictest::sorted_ids(result) == basictest::sorted_ids(expected));
+    BOOST_CHECK(basictest::sorted_ids(result_it) == basictest::sorted_ids(expected));
+}
+
+template <typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::flat_rtree<box_value_t, Params> flat_rtree_t;
+    typedef bgi::flat_rtree_view<box_value_t, Params> view_t;
+
+    std::vector<box_value_t> const boxes = generate::scattered_values<box_value_t>(1000, 100, 97);
+
+    // in memory
+    for ( std::size_t count : { std::size_t(0), std::size_t(3), boxes.size() } )
+    {
+        flat_rtree_t frt(boxes.begin(), boxes.begin() + count, params);
+        std::ostringstream os;
+        frt.write(os);
+        aligned_buffer buffer(os.str());
+
+        view_t view(buffer.data(), buffer.size(), params);
+        check_view(frt, view);
+    }
+
+    // the padding of values is not written
+    {
+        std::vector<box_value_t> garbage(boxes.size());
+        std::memset(static_cast<void*>(garbage.data()), 0xAA, garbage.size() * sizeof(box_value_t));
+        for ( std::size_t i = 0 ; i < boxes.size() ; ++i )
+            ::new (&garbage[i]) box_value_t(boxes[i].first, boxes[i].second);
+
+        std::ostringstream os1, os2;
+        flat_rtree_t(boxes, params).write(os1);
+        flat_rtree_t(garbage, params).write(os2);
+        BOOST_CHECK(os1.str() == os2.str());
+    }
+
+    // invalid data
+    {
+        flat_rtree_t frt(boxes, params);
+        std::ostringstream os;
+        frt.write(os);
+        std::string const data = os.str();
+
+        {
+            aligned_buffer buffer(data);
+            BOOST_CHECK_THROW(view_t(buffer.data(), buffer.size() - 1, params), std::invalid_argument);
+            BOOST_CHECK_THROW(view_t(buffer.data(), 16, params), std::invalid_argument);
+            BOOST_CHECK_THROW(view_t(buffer.data() + 8, buffer.size() - 8, params), std::invalid_argument);
+        }
+        {
+            aligned_buffer buffer(data);
+            buffer.data()[0] = 'X'; // magic
+            BOOST_CHECK_THROW(view_t(buffer.data(), buffer.size(), params), std::invalid_argument);
+        }
+        {
+            aligned_buffer buffer(data);
+            buffer.data()[8] = 2; // version
+            BOOST_CHECK_THROW(view_t(buffer.data(), buffer.size(), params), std::invalid_argument);
+        }
+
+        // corrupted header, the counts and offsets can't overflow the size checks
+        typedef bgi::detail::rtree::flat::binary_header header_t;
+        auto const check_header = [&](std::function<void(header_t &)> const& corrupt)
+        {
+            aligned_buffer buffer(data);
+            corrupt(*reinterpret_cast<header_t*>(buffer.data()));
+            BOOST_CHECK_THROW(view_t(buffer.data(), buffer.size(), params), std::invalid_argument);
+        };
+        check_header([](header_t & h) { h.entries_count = std::uint64_t(-1); });
+        check_header([](header_t & h) { h.entries_count = std::uint64_t(1) << 61; });
+        check_header([](header_t & h) { h.values_count = std::uint64_t(-1); });
+        check_header([](header_t & h) { h.values_count = (std::uint64_t(1) << 63) / sizeof(box_value_t) + 1; });
+        check_header([](header_t & h) { h.values_count += 1; });
+        check_header([](header_t & h) { h.values_offset = std::uint64_t(-64); });
+        check_header([](header_t & h) { h.coordinates_offset = std::uint64_t(-64); });
+        check_header([](header_t & h) { h.root_count = 0; });
+        check_header([](header_t & h) { h.root_count = h.entries_count + 1; });
+
+        // corrupted indexes of children
+        header_t header;
+        std::memcpy(&header, data.data(), sizeof(header_t));
+        typedef typename flat_rtree_t::size_type size_type;
+        auto const check_indexes = [&](std::function<void(size_type *)> const& corrupt)
+        {
+            aligned_buffer buffer(data);
+            corrupt(reinterpret_cast<size_type*>(buffer.data() + header.indexes_offset));
+            BOOST_CHECK_THROW(view_t(buffer.data(), buffer.size(), params), std::invalid_argument);
+        };
+        size_type const entries_count = header.entries_count;
+        BOOST_CHECK(entries_count > 1);
+        check_indexes([&](size_type * first) { first[0] = 0; });
+        check_indexes([&](size_type * first) { first[1] = first[0]; });
+        check_indexes([&](size_type * first) { first[1] = size_type(-1); });
+        check_indexes([&](size_type * first) { first[entries_count] += 1; });
+        // the children of the last entry which has entries as children, both entries and values
+        check_indexes([&](size_type * first) {
+            size_type i = 0;
+            while ( first[i + 1] < entries_count )
+                ++i;
+            first[i + 1] = entries_count + 1;
+        });
+
+        // different types
+        typedef bg::model::box<bg::model::point<float, 2, bg::cs::cartesian> > fbox_t;
+        typedef bgi::flat_rtree_view<std::pair<fbox_t, int>, Params> fview_t;
+        aligned_buffer buffer(data);
+        BOOST_CHECK_THROW(fview_t(buffer.data(), buffer.size(), params), std::invalid_argument);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_rtree< bgi::linear<4> >();
+    test_rtree< bgi::rstar<16> >();
+    test_rtree(bgi::dynamic_quadratic(8));
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/algorithms/comparable_distance.hpp>
+#include <boost/geometry/index/flat_rtree.hpp>
+
+template <typename Rtree, typename FlatRtree, typename Predicates>
+void check_query(Rtree const& rt, FlatRtree const& frt, Predicates const& pred)
+{
+    typedef typename Rtree::value_type value_t;
+
+    std::vector<value_t> expected;
+    rt.query(pred, std::back_inserter(expected));
+
+    std::vector<value_t> result;
+    BOOST_CHECK_EQUAL(frt.query(pred, std::back_inserter(result)), expected.size());
+    BOOST_CHECK(basictest::sorted_ids(result) == basictest::sorted_ids(expected));
+
+    std::vector<value_t> result_it;
+    std::copy(frt.qbegin(pred), frt.qend(), std::back_inserter(result_it));
+    BOOST_CHECK(basictest::sorted_ids(result_it) == basictest::sorted_ids(expected));
+}
+
+template <typename Rtree, typename FlatRtree, typename Predicates>
+void check_count(Rtree const& rt, FlatRtree const& frt, Predicates const& pred)
+{
+    std::vector<typename Rtree::value_type> expected;
+    rt.query(pred, std::back_inserter(expected));
+    BOOST_CHECK_EQUAL(frt.query_count(pred), expected.size());
+}
+
+template <typename Rtree, typename FlatRtree, typename Point>
+void check_nearest(Rtree const& rt, FlatRtree const& frt, Point const& pt, std::size_t k)
+{
+    typedef typename Rtree::value_type value_t;
+
+    auto distances = [&](std::vector<value_t> const& values) {
+        std::vector<double> result;
+        for ( auto const& v : values )
+            result.push_back(bg::comparable_distance(pt, v.first));
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    std::vector<value_t> expected, result, result_it;
+    rt.query(bgi::nearest(pt, k), std::back_inserter(expected));
+    frt.query(bgi::nearest(pt, k), std::back_inserter(result));
+    std::copy(frt.qbegin(bgi::nearest(pt, k)), frt.qend(), std::back_inserter(result_it));
+
+    BOOST_CHECK(distances(result) == distances(expected));
+    BOOST_CHECK(distances(result_it) == distances(expected));
+}
+
+template <typename Value, typename Params, typename Integer, typename Box>
+void test_values(std::vector<Value> const& values, Box const& qbox, Params const& params)
+{
+    typedef bgi::rtree<Value, Params> rtree_t;
+    typedef bgi::flat_rtree
+        <
+            Value, Params, bgi::indexable<Value>, bgi::equal_to<Value>,
+            boost::container::new_allocator<Value>, bgi::quantized_node_boxes<Integer>
+        > flat_rtree_t;
+
+    typedef typename bg::point_type<Box>::type point_type;
+
+    rtree_t rt(values, params);
+    flat_rtree_t frt(rt);
+
+    BOOST_CHECK_EQUAL(frt.size(), rt.size());
+    BOOST_CHECK(basictest::sorted_ids(frt) == basictest::sorted_ids(rt));
+    if ( ! rt.empty() )
+        BOOST_CHECK(bg::covered_by(rt.bounds(), frt.bounds()));
+
+    check_query(rt, frt, bgi::intersects(qbox));
+    check_query(rt, frt, bgi::within(qbox));
+    check_query(rt, frt, bgi::covered_by(qbox));
+    check_query(rt, frt, bgi::disjoint(qbox));
+    check_query(rt, frt, ! bgi::intersects(qbox));
+    check_query(rt, frt, bgi::intersects(qbox) && bgi::satisfies([](Value const& v) { return v.second % 3 == 0; }));
+    check_query(rt, frt, bgi::intersects(rt.bounds()));
+    // boxes of single values
+    for ( std::size_t i = 0 ; i < values.size() ; i += 97 )
+        check_query(rt, frt, bgi::covered_by(bgi::indexable<Value>()(values[i])));
+
+    check_count(rt, frt, bgi::intersects(qbox));
+    check_count(rt, frt, bgi::covered_by(qbox));
+
+    point_type const pt = qbox.min_corner();
+    check_nearest(rt, frt, pt, 1);
+    check_nearest(rt, frt, pt, 10);
+    check_nearest(rt, frt, pt, 100);
+}
+
+template <typename Point, typename Integer, typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bg::model::box<Point> box_t;
+    typedef std::pair<box_t, int> box_value_t;
+    typedef std::pair<Point, int> point_value_t;
+
+    for ( double offset : { 0.0, -1000.0, 1000000.0 } )
+    {
+        std::vector<box_value_t> boxes;
+        std::vector<point_value_t> points;
+        for ( int i = 0 ; i < 3000 ; ++i )
+        {
+            double const x = offset + (i * 37) % 1000 + 0.125;
+            double const y = offset + (i * 53) % 997 + 0.25;
+            boxes.push_back(std::make_pair(box_t(Point(x, y), Point(x + 1.5, y + 0.001 * (i % 7))), i));
+            points.push_back(std::make_pair(Point(x, y), i));
+        }
+
+        box_t const qbox(Point(offset + 200.5, offset + 300.25), Point(offset + 450, offset + 600.75));
+
+        test_values<box_value_t, Params, Integer>(boxes, qbox, params);
+        test_values<point_value_t, Params, Integer>(points, qbox, params);
+    }
+
+    // the same Points
+    std::vector<point_value_t> same;
+    for ( int i = 0 ; i < 500 ; ++i )
+        same.push_back(std::make_pair(Point(1.5, 2.5), i));
+    test_values<point_value_t, Params, Integer>(same, box_t(Point(1, 2), Point(2, 3)), params);
+
+    // root being a leaf and empty tree
+    test_values<point_value_t, Params, Integer>(std::vector<point_value_t>(same.begin(), same.begin() + 2),
+                                                box_t(Point(1, 2), Point(2, 3)), params);
+    test_values<point_value_t, Params, Integer>(std::vector<point_value_t>(),
+                                                box_t(Point(1, 2), Point(2, 3)), params);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<float, 2, bg::cs::cartesian> pointf_t;
+
+    test_rtree<point_t, std::uint8_t, bgi::linear<4> >();
+    test_rtree<point_t, std::uint16_t, bgi::quadratic<8> >();
+    test_rtree<point_t, std::uint8_t, bgi::rstar<16> >();
+    test_rtree<pointf_t, std::uint16_t, bgi::rstar<16> >();
+    test_rtree<pointf_t, std::uint8_t>(bgi::dynamic_rstar(32));
+
+    return 0;
+}
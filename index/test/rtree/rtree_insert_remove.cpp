@@ -68,6 +68,7 @@ void test_rtree_all()
         test_rtree< bgi::linear<Max, Min> >(vcount);
         test_rtree< bgi::quadratic<Max, Min> >(vcount);
         test_rtree< bgi::rstar<Max, Min> >(vcount);
+        test_rtree< bgi::kmeans<Max, Min> >(vcount);
     }
 }
 
@@ -0,0 +1,114 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/algorithms/distance.hpp>
+
+template <typename Rtree1, typename Rtree2, typename Predicate, typename Check>
+void check_join(Rtree1 const& rt1, Rtree2 const& rt2, Predicate const& pred, Check const& check)
+{
+    typedef typename Rtree1::value_type value1_t;
+    typedef typename Rtree2::value_type value2_t;
+
+    std::vector<std::pair<int, int> > result;
+    std::size_t found = rt1.join(rt2, pred, [&](value1_t const& v1, value2_t const& v2) {
+        result.push_back(std::make_pair(v1.second, v2.second));
+    });
+
+    std::vector<std::pair<int, int> > expected;
+    for ( value1_t const& v1 : rt1 )
+        for ( value2_t const& v2 : rt2 )
+            if ( check(v1.first, v2.first) )
+                expected.push_back(std::make_pair(v1.second, v2.second));
+
+    std::sort(result.begin(), result.end());
+    std::sort(expected.begin(), expected.end());
+
+    BOOST_CHECK_EQUAL(found, expected.size());
+    BOOST_CHECK(result == expected);
+
+    // free function
+    std::size_t count = 0;
+    BOOST_CHECK_EQUAL(bgi::join(rt1, rt2, pred, [&](value1_t const&, value2_t const&) { ++count; }),
+                      expected.size());
+    BOOST_CHECK_EQUAL(count, expected.size());
+}
+
+struct intersects_check
+{
+    template <typename G1, typename G2>
+    bool operator()(G1 const& g1, G2 const& g2) const { return bg::intersects(g1, g2); }
+};
+
+struct distance_check
+{
+    explicit distance_check(double d) : distance(d) {}
+
+    template <typename G1, typename G2>
+    bool operator()(G1 const& g1, G2 const& g2) const { return bg::distance(g1, g2) <= distance; }
+
+    double distance;
+};
+
+template <typename Params1, typename Params2>
+void test_rtree(Params1 const& params1 = Params1(), Params2 const& params2 = Params2())
+{
+    typedef bgi::rtree<box_value_t, Params1> box_rtree_t;
+    typedef bgi::rtree<point_value_t, Params2> point_rtree_t;
+
+    std::vector<box_value_t> const boxes = generate::scattered_values<box_value_t>(500, 100, 97);
+
+    std::vector<point_value_t> points;
+    for ( int i = 0 ; i < 2000 ; ++i )
+    {
+        double x = (i * 17) % 103 + 0.25;
+        double y = (i * 29) % 89 + 0.5;
+        points.push_back(std::make_pair(point_t(x, y), i));
+    }
+
+    box_rtree_t empty_rt(params1);
+    box_rtree_t box_rt(boxes, params1);
+    point_rtree_t point_rt(points, params2);
+
+    // trees of different heights
+    check_join(box_rt, point_rt, bgi::join_intersects(), intersects_check());
+    check_join(point_rt, box_rt, bgi::join_intersects(), intersects_check());
+    check_join(box_rt, box_rt, bgi::join_intersects(), intersects_check());
+    check_join(box_rt, point_rt, bgi::join_within_distance(2.5), distance_check(2.5));
+    check_join(point_rt, point_rt, bgi::join_within_distance(1.5), distance_check(1.5));
+    // nothing is within a negative distance
+    check_join(box_rt, box_rt, bgi::join_within_distance(-2.0), distance_check(-2.0));
+    check_join(point_rt, point_rt, bgi::join_within_distance(-1.5), distance_check(-1.5));
+
+    check_join(empty_rt, point_rt, bgi::join_intersects(), intersects_check());
+    check_join(point_rt, empty_rt, bgi::join_within_distance(1.0), distance_check(1.0));
+
+    // trees created by insertion
+    box_rtree_t box_rt_ins(params1);
+    box_rt_ins.insert(boxes);
+    check_join(box_rt_ins, box_rt, bgi::join_intersects(), intersects_check());
+}
+
+int test_main(int, char* [])
+{
+    test_rtree< bgi::linear<4>, bgi::rstar<16> >();
+    test_rtree< bgi::quadratic<8>, bgi::linear<5> >();
+    test_rtree< bgi::rstar<16>, bgi::quadratic<4> >();
+
+    test_rtree(bgi::dynamic_linear(4), bgi::dynamic_rstar(16));
+    test_rtree(bgi::dynamic_quadratic(8), bgi::linear<5>());
+    test_rtree(bgi::dynamic_rstar(16), bgi::dynamic_quadratic(4));
+
+    return 0;
+}
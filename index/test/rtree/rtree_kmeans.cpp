@@ -0,0 +1,77 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <vector>
+
+// Points in dense clusters, e.g. GPS positions recorded in a few places
+template <typename Params>
+void test_clustered(Params const& params = Params())
+{
+    typedef bgi::rtree<point_value_t, Params> rtree_t;
+
+    std::vector<point_value_t> values;
+    for ( int i = 0 ; i < 5000 ; ++i )
+    {
+        double const cx = (i % 7) * 100;
+        double const cy = (i % 5) * 70;
+        values.push_back(point_value_t(point_t(cx + (i * 37) % 101 * 0.01,
+                                               cy + (i * 53) % 97 * 0.01), i));
+    }
+    // duplicated points
+    for ( int i = 0 ; i < 200 ; ++i )
+        values.push_back(point_value_t(point_t(350, 140), 5000 + i));
+
+    rtree_t rt(params);
+    for ( point_value_t const& v : values )
+        rt.insert(v);
+
+    basictest::check_rtree(rt, values);
+
+    // queries around the clusters
+    for ( int i = 0 ; i < 20 ; ++i )
+    {
+        box_t const qbox(point_t(i * 35 - 5, i * 17 - 5), point_t(i * 35 + 5, i * 17 + 5));
+
+        std::vector<point_value_t> result, expected;
+        rt.query(bgi::intersects(qbox), std::back_inserter(result));
+        for ( point_value_t const& v : values )
+            if ( bg::intersects(v.first, qbox) )
+                expected.push_back(v);
+
+        BOOST_CHECK(basictest::sorted_ids(result) == basictest::sorted_ids(expected));
+    }
+
+    std::vector<point_value_t> remaining;
+    for ( std::size_t i = 0 ; i < values.size() ; ++i )
+    {
+        if ( i % 2 == 0 )
+            BOOST_CHECK_EQUAL(rt.remove(values[i]), 1u);
+        else
+            remaining.push_back(values[i]);
+    }
+    basictest::check_rtree(rt, remaining);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_t;
+
+    test_rtree_for_point<point_t>(bgi::kmeans<4, 2>());
+    test_rtree_for_box<point_t>(bgi::kmeans<4, 2>());
+    test_rtree_for_point<point3d_t>(bgi::kmeans<8, 3>());
+    test_rtree_for_box<point3d_t>(bgi::kmeans<8, 3>());
+
+    test_clustered< bgi::kmeans<4, 2> >();
+    test_clustered< bgi::kmeans<16> >();
+    test_clustered< bgi::kmeans<5, 3> >();
+
+    return 0;
+}
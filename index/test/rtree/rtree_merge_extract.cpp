@@ -0,0 +1,197 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/index/arena_allocator.hpp>
+
+std::vector<box_value_t> generate_values(int first, int count, double offset_x)
+{
+    std::vector<box_value_t> values;
+    for ( int i = first ; i < first + count ; ++i )
+    {
+        box_value_t v = generate::scattered_value<box_value_t>::apply(i, 1000, 997);
+        bg::set<bg::min_corner, 0>(v.first, bg::get<bg::min_corner, 0>(v.first) + offset_x);
+        bg::set<bg::max_corner, 0>(v.first, bg::get<bg::max_corner, 0>(v.first) + offset_x);
+        values.push_back(v);
+    }
+    return values;
+}
+
+template <typename Rtree>
+Rtree create_tree(std::vector<box_value_t> const& values, bool packed,
+                  typename Rtree::parameters_type const& params,
+                  typename Rtree::allocator_type const& allocator)
+{
+    Rtree rt(params, bgi::indexable<box_value_t>(), bgi::equal_to<box_value_t>(), allocator);
+    if ( packed )
+    {
+        rt = Rtree(values, params, bgi::indexable<box_value_t>(), bgi::equal_to<box_value_t>(), allocator);
+    }
+    else
+    {
+        for ( box_value_t const& v : values )
+            rt.insert(v);
+    }
+    return rt;
+}
+
+template <typename Rtree>
+void test_merge(typename Rtree::parameters_type const& params,
+                typename Rtree::allocator_type const& allocator1,
+                typename Rtree::allocator_type const& allocator2)
+{
+    int const sizes[] = { 0, 1, 3, 40, 500, 3000 };
+
+    for ( int packed = 0 ; packed < 2 ; ++packed )
+    {
+        for ( int s1 : sizes )
+        {
+            for ( int s2 : sizes )
+            {
+                std::vector<box_value_t> values1 = generate_values(0, s1, 0);
+                std::vector<box_value_t> values2 = generate_values(s1, s2, 500);
+
+                Rtree rt1 = create_tree<Rtree>(values1, packed != 0, params, allocator1);
+                Rtree rt2 = create_tree<Rtree>(values2, packed != 0, params, allocator2);
+
+                rt1.merge(std::move(rt2));
+
+                std::vector<box_value_t> expected = values1;
+                expected.insert(expected.end(), values2.begin(), values2.end());
+                basictest::check_rtree(rt1, expected);
+                BOOST_CHECK(rt2.empty());
+
+                // the tree may still be modified
+                rt1.insert(values1.begin(), values1.end());
+                BOOST_CHECK_EQUAL(rt1.remove(values1), values1.size());
+                BOOST_CHECK_EQUAL(rt1.remove(expected), expected.size());
+                BOOST_CHECK(rt1.empty());
+            }
+        }
+    }
+
+    // free function
+    std::vector<box_value_t> values1 = generate_values(0, 700, 0);
+    std::vector<box_value_t> values2 = generate_values(700, 900, 250);
+    Rtree rt = bgi::merge(create_tree<Rtree>(values1, true, params, allocator1),
+                          create_tree<Rtree>(values2, false, params, allocator2));
+    values1.insert(values1.end(), values2.begin(), values2.end());
+    basictest::check_rtree(rt, values1);
+}
+
+template <typename Rtree, typename Predicates, typename Pred>
+void check_extract(Rtree & rt, std::vector<box_value_t> & expected,
+                   Predicates const& predicates, Pred const& pred)
+{
+    std::vector<box_value_t> expected_extracted, expected_rest;
+    for ( box_value_t const& v : expected )
+    {
+        if ( pred(v) )
+            expected_extracted.push_back(v);
+        else
+            expected_rest.push_back(v);
+    }
+
+    Rtree extracted = rt.extract(predicates);
+
+    basictest::check_rtree(extracted, expected_extracted);
+    basictest::check_rtree(rt, expected_rest);
+    expected = expected_rest;
+
+    // the extracted tree may be modified
+    extracted.insert(expected_rest.begin(), expected_rest.begin() + expected_rest.size() / 2);
+    BOOST_CHECK_EQUAL(extracted.remove(expected_extracted), expected_extracted.size());
+}
+
+template <typename Rtree>
+void test_extract(typename Rtree::parameters_type const& params,
+                  typename Rtree::allocator_type const& allocator)
+{
+    std::vector<box_value_t> values = generate_values(0, 3000, 0);
+
+    box_t const qbox(point_t(100, 200), point_t(500, 550));
+
+    for ( int packed = 0 ; packed < 2 ; ++packed )
+    {
+        Rtree rt = create_tree<Rtree>(values, packed != 0, params, allocator);
+        std::vector<box_value_t> expected = values;
+
+        // nothing
+        check_extract(rt, expected, bgi::intersects(box_t(point_t(-10, -10), point_t(-5, -5))),
+                      [](box_value_t const&) { return false; });
+
+        // a region, whole subtrees are moved
+        check_extract(rt, expected, bgi::intersects(qbox),
+                      [&](box_value_t const& v) { return bg::intersects(v.first, qbox); });
+
+        // satisfies() is checked for each value
+        check_extract(rt, expected, bgi::covered_by(box_t(point_t(0, 0), point_t(800, 1000)))
+                                    && bgi::satisfies([](box_value_t const& v) { return v.second % 3 == 0; }),
+                      [](box_value_t const& v) {
+                          return bg::covered_by(v.first, box_t(point_t(0, 0), point_t(800, 1000)))
+                              && v.second % 3 == 0;
+                      });
+
+        // everything but a region
+        check_extract(rt, expected, ! bgi::intersects(qbox),
+                      [&](box_value_t const& v) { return ! bg::intersects(v.first, qbox); });
+
+        // everything
+        check_extract(rt, expected, bgi::intersects(box_t(point_t(-10, -10), point_t(2000, 2000))),
+                      [](box_value_t const&) { return true; });
+        BOOST_CHECK(rt.empty());
+
+        // empty
+        Rtree extracted = bgi::extract(rt, bgi::intersects(qbox));
+        BOOST_CHECK(extracted.empty());
+    }
+
+    // split and merge back
+    Rtree rt = create_tree<Rtree>(values, true, params, allocator);
+    Rtree west = rt.extract(bgi::covered_by(box_t(point_t(-10, -10), point_t(480, 1000))));
+    BOOST_CHECK(! west.empty() && ! rt.empty());
+    rt.merge(std::move(west));
+    basictest::check_rtree(rt, values);
+}
+
+template <typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::rtree<box_value_t, Params> rtree_t;
+    typedef typename rtree_t::allocator_type allocator_t;
+
+    test_merge<rtree_t>(params, allocator_t(), allocator_t());
+    test_extract<rtree_t>(params, allocator_t());
+
+    // different arenas, the values are copied
+    typedef bgi::arena_allocator<box_value_t> arena_allocator_t;
+    typedef bgi::rtree<box_value_t, Params, bgi::indexable<box_value_t>,
+                       bgi::equal_to<box_value_t>, arena_allocator_t> arena_rtree_t;
+
+    arena_allocator_t arena(16 * 1024);
+    test_merge<arena_rtree_t>(params, arena, arena);
+    test_merge<arena_rtree_t>(params, arena, arena_allocator_t(16 * 1024));
+    test_extract<arena_rtree_t>(params, arena);
+}
+
+int test_main(int, char* [])
+{
+    test_rtree< bgi::linear<4, 2> >();
+    test_rtree< bgi::quadratic<16> >();
+    test_rtree< bgi::rstar<8, 3> >();
+    test_rtree< bgi::kmeans<8> >();
+    test_rtree(bgi::dynamic_linear(5, 2));
+    test_rtree(bgi::dynamic_rstar(16, 4));
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+
+// The replaced operators are inlined and mistaken for a mismatched pair
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// Counts the allocations in order to check that the queries reusing the workspace don't allocate
+std::size_t allocations_count = 0;
+
+void * operator new(std::size_t size)
+{
+    ++allocations_count;
+    if ( void * p = std::malloc(size ? size : 1) )
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void * p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void * p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+typedef point_value_t value_t;
+
+template <typename Rtree, typename It>
+std::vector<value_t> gather(Rtree const& rt, It first)
+{
+    std::vector<value_t> result;
+    for ( ; first != rt.qend() ; ++first )
+        result.push_back(*first);
+    return result;
+}
+
+template <typename Rtree, typename Predicates>
+void check_query(Rtree const& rt, Predicates const& predicates,
+                 typename Rtree::template nearest_workspace<Predicates> & workspace)
+{
+    std::vector<value_t> expected = gather(rt, rt.qbegin(predicates));
+    std::vector<value_t> result = gather(rt, rt.qbegin(predicates, workspace));
+
+    BOOST_CHECK_EQUAL(result.size(), expected.size());
+    for ( size_t i = 0 ; i < result.size() && i < expected.size() ; ++i )
+        BOOST_CHECK_EQUAL(result[i].second, expected[i].second);
+}
+
+template <typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::rtree<value_t, Params> rtree_t;
+    typedef typename rtree_t::template nearest_workspace<decltype(bgi::nearest(point_t(), 1))> workspace_t;
+
+    std::vector<value_t> values = generate::scattered_values<value_t>(3000);
+    rtree_t rt(values, params);
+
+    workspace_t workspace;
+
+    // the same results as the queries using their own memory
+    for ( int i = 0 ; i < 50 ; ++i )
+    {
+        point_t const pt((i * 71) % 1000, (i * 29) % 1000);
+        check_query(rt, bgi::nearest(pt, 1), workspace);
+        check_query(rt, bgi::nearest(pt, 10), workspace);
+        check_query(rt, bgi::nearest(pt, 100), workspace);
+        // the same workspace type with additional spatial predicates
+        check_query(rt, bgi::nearest(pt, 10) && bgi::intersects(box_t(point_t(0, 0), point_t(500, 500))), workspace);
+    }
+
+    // the queries which don't need more memory don't allocate
+    {
+        std::size_t const count = allocations_count;
+        std::size_t found = 0;
+        for ( int i = 0 ; i < 1000 ; ++i )
+        {
+            point_t const pt((i * 13) % 1000, (i * 7) % 1000);
+            for ( auto it = rt.qbegin(bgi::nearest(pt, 10), workspace) ; it != rt.qend() ; ++it )
+                ++found;
+        }
+        BOOST_CHECK_EQUAL(allocations_count, count);
+        BOOST_CHECK_EQUAL(found, 10000u);
+    }
+
+    // the query may be stopped and the workspace reused
+    {
+        auto it = rt.qbegin(bgi::nearest(point_t(500, 500), 100), workspace);
+        auto first = *it;
+        for ( int i = 0 ; i < 5 ; ++i )
+            ++it;
+
+        // the copy uses its own memory
+        auto copy = it;
+        BOOST_CHECK_EQUAL(gather(rt, copy).size(), 95u);
+        BOOST_CHECK_EQUAL(gather(rt, it).size(), 95u);
+
+        it = rt.qbegin(bgi::nearest(point_t(500, 500), 100), workspace);
+        BOOST_CHECK_EQUAL(it->second, first.second);
+        BOOST_CHECK_EQUAL(gather(rt, it).size(), 100u);
+    }
+
+    // the workspace used by two iterators at the same time
+    {
+        auto it1 = rt.qbegin(bgi::nearest(point_t(100, 100), 20), workspace);
+        auto it2 = rt.qbegin(bgi::nearest(point_t(900, 900), 20), workspace);
+        BOOST_CHECK_EQUAL(gather(rt, it1).size(), 20u);
+        BOOST_CHECK_EQUAL(gather(rt, it2).size(), 20u);
+    }
+
+    // comparison with the type-erased iterators
+    {
+        typename rtree_t::const_query_iterator it = rt.qbegin(bgi::nearest(point_t(0, 0), 3));
+        auto wit = rt.qbegin(bgi::nearest(point_t(0, 0), 3), workspace);
+        BOOST_CHECK(! (wit == rt.qend()) && ! (rt.qend() == wit));
+        for ( int i = 0 ; i < 3 ; ++i, ++it, ++wit )
+            BOOST_CHECK_EQUAL(wit->second, it->second);
+        BOOST_CHECK(wit == rt.qend() && rt.qend() == wit && wit == it);
+    }
+
+    // empty tree
+    rtree_t empty(params);
+    BOOST_CHECK(empty.qbegin(bgi::nearest(point_t(0, 0), 3), workspace) == empty.qend());
+}
+
+int test_main(int, char* [])
+{
+    test_rtree< bgi::linear<4, 2> >();
+    test_rtree< bgi::quadratic<16> >();
+    test_rtree< bgi::rstar<8, 3> >();
+    test_rtree(bgi::dynamic_rstar(16, 4));
+
+    return 0;
+}
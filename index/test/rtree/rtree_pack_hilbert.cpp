@@ -0,0 +1,164 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/geometry/index/detail/rtree/utilities/view.hpp>
+
+template <typename Value>
+struct value_less
+{
+    bool operator()(Value const& v1, Value const& v2) const
+    {
+        return v1.second < v2.second;
+    }
+};
+
+template <typename Value>
+Value make_value(int x, int y, int , std::integral_constant<std::size_t, 2>)
+{
+    return generate::value<Value>::apply(x, y);
+}
+
+template <typename Value>
+Value make_value(int x, int y, int z, std::integral_constant<std::size_t, 3>)
+{
+    return generate::value<Value>::apply(x, y, z);
+}
+
+template <typename Rtree, typename Predicates>
+void check_query(Rtree const& expected, Rtree const& rt, Predicates const& pred)
+{
+    typedef typename Rtree::value_type value_t;
+
+    std::vector<value_t> result, expected_result;
+    rt.query(pred, std::back_inserter(result));
+    expected.query(pred, std::back_inserter(expected_result));
+
+    std::sort(result.begin(), result.end(), value_less<value_t>());
+    std::sort(expected_result.begin(), expected_result.end(), value_less<value_t>());
+
+    BOOST_CHECK_EQUAL(result.size(), expected_result.size());
+    bool same = result.size() == expected_result.size();
+    for ( std::size_t i = 0 ; same && i < result.size() ; ++i )
+        same = result[i].second == expected_result[i].second;
+    BOOST_CHECK(same);
+}
+
+// the values may be different if there are many values in the same distance
+template <typename Rtree, typename Point>
+void check_nearest(Rtree const& expected, Rtree const& rt, Point const& pt, unsigned k)
+{
+    typedef typename Rtree::value_type value_t;
+
+    std::vector<value_t> result, expected_result;
+    rt.query(bgi::nearest(pt, k), std::back_inserter(result));
+    expected.query(bgi::nearest(pt, k), std::back_inserter(expected_result));
+
+    BOOST_CHECK_EQUAL(result.size(), expected_result.size());
+
+    std::vector<double> dists, expected_dists;
+    for ( std::size_t i = 0 ; i < result.size() ; ++i )
+        dists.push_back(bg::comparable_distance(pt, result[i].first));
+    for ( std::size_t i = 0 ; i < expected_result.size() ; ++i )
+        expected_dists.push_back(bg::comparable_distance(pt, expected_result[i].first));
+    std::sort(dists.begin(), dists.end());
+    std::sort(expected_dists.begin(), expected_dists.end());
+    BOOST_CHECK(dists == expected_dists);
+}
+
+template <typename Indexable, typename Params>
+void test_rtree(std::size_t count, Params const& params = Params())
+{
+    typedef std::pair<Indexable, int> value_t;
+    typedef bgi::rtree<value_t, Params> rtree_t;
+    typedef typename bg::point_type<Indexable>::type point_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef typename bgi::detail::rtree::utilities::view<rtree_t> view_t;
+
+    std::vector<value_t> values;
+    for ( std::size_t i = 0 ; i < count ; ++i )
+    {
+        int x = static_cast<int>((i * 7919) % 101);
+        int y = static_cast<int>((i * 104729) % 97);
+        int z = static_cast<int>((i * 31) % 89);
+        values.push_back(make_value<value_t>(x, y, z,
+            std::integral_constant<std::size_t, bg::dimension<point_t>::value>()));
+        values.back().second = static_cast<int>(i);
+    }
+
+    rtree_t expected(values.begin(), values.end(), params);
+    rtree_t rt(values.begin(), values.end(), bgi::hilbert_packing(), params);
+    rtree_t rt_rng(values, bgi::hilbert_packing(), params);
+
+    BOOST_CHECK_EQUAL(rt.size(), count);
+    BOOST_CHECK_EQUAL(rt_rng.size(), count);
+    BOOST_CHECK_EQUAL(view_t(rt).depth(), view_t(rt_rng).depth());
+
+    if ( count == 0 )
+    {
+        BOOST_CHECK(rt.empty());
+        return;
+    }
+
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt));
+    BOOST_CHECK(bg::equals(rt.bounds(), expected.bounds()));
+
+    box_t qbox = make_value<std::pair<box_t, int> >(20, 10, 30,
+        std::integral_constant<std::size_t, bg::dimension<point_t>::value>()).first;
+    bg::set<bg::max_corner, 0>(qbox, 60);
+    bg::set<bg::max_corner, 1>(qbox, 50);
+
+    check_query(expected, rt, bgi::intersects(qbox));
+    check_query(expected, rt, bgi::within(qbox));
+    check_nearest(expected, rt, qbox.min_corner(), 10);
+
+    // the tree can be modified after packing
+    rt.insert(values.front());
+    BOOST_CHECK_EQUAL(rt.size(), count + 1);
+    BOOST_CHECK_EQUAL(rt.remove(values.front()), 1u);
+    BOOST_CHECK_EQUAL(rt.remove(values.back()), 1u);
+    BOOST_CHECK_EQUAL(rt.size(), count - 1);
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+}
+
+template <typename Indexable, typename Params>
+void test_rtree_counts(Params const& params = Params())
+{
+    test_rtree<Indexable>(0, params);
+    test_rtree<Indexable>(1, params);
+    test_rtree<Indexable>(5, params);
+    test_rtree<Indexable>(17, params);
+    test_rtree<Indexable>(177, params);
+    test_rtree<Indexable>(5000, params);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> p2d;
+    typedef bg::model::box<p2d> b2d;
+    typedef bg::model::point<int, 3, bg::cs::cartesian> p3i;
+    typedef bg::model::box<p3i> b3i;
+
+    test_rtree_counts< p2d, bgi::linear<5, 2> >();
+    test_rtree_counts< b2d, bgi::quadratic<8> >();
+    test_rtree_counts< p3i, bgi::rstar<16> >();
+    test_rtree_counts< b3i, bgi::linear<4> >();
+
+    test_rtree_counts<p2d>(bgi::dynamic_linear(5, 2));
+    test_rtree_counts<b2d>(bgi::dynamic_quadratic(8));
+    test_rtree_counts<p3i>(bgi::dynamic_rstar(16));
+
+    return 0;
+}
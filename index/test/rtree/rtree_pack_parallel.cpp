@@ -0,0 +1,92 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <vector>
+
+#include <boost/geometry/index/parallel_packing.hpp>
+#include <boost/geometry/index/detail/rtree/utilities/view.hpp>
+
+template <typename Rtree>
+void check_equal_trees(Rtree const& expected, Rtree const& rt)
+{
+    typedef bgi::detail::rtree::utilities::view<Rtree> view_t;
+
+    BOOST_CHECK_EQUAL(rt.size(), expected.size());
+    BOOST_CHECK_EQUAL(view_t(rt).depth(), view_t(expected).depth());
+    if ( ! rt.empty() )
+    {
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+        BOOST_CHECK(bg::equals(rt.bounds(), expected.bounds()));
+    }
+
+    // values are traversed in the order in which they are stored in nodes
+    // so the trees are the same only if the sequences are the same
+    typename Rtree::const_iterator eit = expected.begin();
+    typename Rtree::const_iterator it = rt.begin();
+    bool same = true;
+    for ( ; it != rt.end() && eit != expected.end() ; ++it, ++eit )
+    {
+        if ( it->second != eit->second )
+        {
+            same = false;
+            break;
+        }
+    }
+    BOOST_CHECK(same);
+    BOOST_CHECK(it == rt.end() && eit == expected.end());
+}
+
+template <typename Params>
+void test_rtree(std::size_t count, Params const& params = Params())
+{
+    // coordinates are duplicated for more than 1000 values
+    std::vector<point_value_t> const values = generate::scattered_values<point_value_t>(int(count));
+
+    typedef bgi::rtree<point_value_t, Params> rtree_t;
+
+    rtree_t expected(values.begin(), values.end(), params);
+
+    std::size_t const threads[] = { 0, 1, 2, 3, 4, 8 };
+    for ( std::size_t i = 0 ; i < sizeof(threads) / sizeof(threads[0]) ; ++i )
+    {
+        rtree_t rt(values.begin(), values.end(), bgi::parallel_packing(threads[i]), params);
+        check_equal_trees(expected, rt);
+
+        rtree_t rt_rng(values, bgi::parallel_packing(threads[i]), params);
+        check_equal_trees(expected, rt_rng);
+
+        basictest::check_rtree(rt, values);
+    }
+}
+
+template <typename Params>
+void test_rtree_counts(Params const& params = Params())
+{
+    test_rtree<Params>(0, params);
+    test_rtree<Params>(1, params);
+    test_rtree<Params>(17, params);
+    test_rtree<Params>(177, params);
+    test_rtree<Params>(10000, params);
+}
+
+int test_main(int, char* [])
+{
+    test_rtree_counts< bgi::linear<4> >();
+    test_rtree_counts< bgi::quadratic<8> >();
+    test_rtree_counts< bgi::rstar<16> >();
+
+    test_rtree_counts(bgi::dynamic_linear(4));
+    test_rtree_counts(bgi::dynamic_quadratic(8));
+    test_rtree_counts(bgi::dynamic_rstar(16));
+
+    return 0;
+}
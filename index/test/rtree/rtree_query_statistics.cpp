@@ -0,0 +1,120 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/index/detail/rtree/utilities/statistics.hpp>
+
+void check_zero(bgi::query_statistics const& stats)
+{
+    BOOST_CHECK_EQUAL(stats.internal_nodes, 0u);
+    BOOST_CHECK_EQUAL(stats.leaves, 0u);
+    BOOST_CHECK_EQUAL(stats.boxes, 0u);
+    BOOST_CHECK_EQUAL(stats.values, 0u);
+    BOOST_CHECK_EQUAL(stats.queue_pushes, 0u);
+    BOOST_CHECK_EQUAL(stats.queue_pops, 0u);
+    BOOST_CHECK_EQUAL(stats.queue_max_size, 0u);
+}
+
+template <typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::rtree<box_value_t, Params> rtree_t;
+
+    std::vector<box_value_t> const values = generate::scattered_values<box_value_t>(3000);
+
+    box_t const qbox(point_t(100, 200), point_t(300, 350));
+    point_t const pt(500.5, 400.5);
+
+    // empty
+    {
+        rtree_t rt(params);
+        bgi::query_statistics stats;
+        std::vector<box_value_t> result;
+        BOOST_CHECK_EQUAL(rt.query(bgi::intersects(qbox), std::back_inserter(result), stats), 0u);
+        BOOST_CHECK_EQUAL(rt.query(bgi::nearest(pt, 5), std::back_inserter(result), stats), 0u);
+        check_zero(stats);
+    }
+
+    for ( int packed = 0 ; packed < 2 ; ++packed )
+    {
+        rtree_t rt(params);
+        if ( packed )
+            rt = rtree_t(values, params);
+        else
+            rt.insert(values);
+
+        std::size_t levels, nodes, leaves, count, min_count, max_count;
+        std::tie(levels, nodes, leaves, count, min_count, max_count) = bgi::detail::rtree::utilities::statistics(rt);
+
+        // all nodes are visited
+        {
+            bgi::query_statistics stats;
+            std::vector<box_value_t> result;
+            BOOST_CHECK_EQUAL(rt.query(bgi::intersects(rt.bounds()), std::back_inserter(result), stats), values.size());
+            BOOST_CHECK_EQUAL(stats.internal_nodes, nodes);
+            BOOST_CHECK_EQUAL(stats.leaves, leaves);
+            BOOST_CHECK_EQUAL(stats.boxes, nodes + leaves - 1); // the root isn't checked
+            BOOST_CHECK_EQUAL(stats.values, values.size());
+            BOOST_CHECK_EQUAL(stats.queue_pushes, 0u);
+
+            // the counters are incremented
+            bgi::query(rt, bgi::intersects(rt.bounds()), std::back_inserter(result), stats);
+            BOOST_CHECK_EQUAL(stats.leaves, 2 * leaves);
+            BOOST_CHECK_EQUAL(stats.values, 2 * values.size());
+
+            stats.clear();
+            check_zero(stats);
+        }
+
+        // the same results as without statistics
+        {
+            bgi::query_statistics stats;
+            std::vector<box_value_t> expected, result;
+            rt.query(bgi::intersects(qbox), std::back_inserter(expected));
+            rt.query(bgi::intersects(qbox), std::back_inserter(result), stats);
+            basictest::exactly_the_same_outputs(rt, result, expected);
+            BOOST_CHECK_GT(stats.leaves, 0u);
+            BOOST_CHECK_LT(stats.leaves, leaves);
+            BOOST_CHECK_LE(stats.internal_nodes, nodes);
+            BOOST_CHECK_LE(stats.values, stats.leaves * max_count);
+            BOOST_CHECK_GE(stats.values, result.size());
+        }
+
+        {
+            bgi::query_statistics stats;
+            std::vector<box_value_t> expected, result;
+            rt.query(bgi::nearest(pt, 10), std::back_inserter(expected));
+            rt.query(bgi::nearest(pt, 10), std::back_inserter(result), stats);
+            basictest::exactly_the_same_outputs(rt, result, expected);
+            BOOST_CHECK_GT(stats.leaves, 0u);
+            BOOST_CHECK_LT(stats.leaves, leaves);
+            // each visited node except of the root was pushed and popped
+            BOOST_CHECK_EQUAL(stats.queue_pops, stats.internal_nodes + stats.leaves - 1);
+            BOOST_CHECK_GE(stats.queue_pushes, stats.queue_pops);
+            BOOST_CHECK_GT(stats.queue_max_size, 0u);
+            BOOST_CHECK_LE(stats.queue_max_size, stats.queue_pushes);
+        }
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_rtree< bgi::linear<4, 2> >();
+    test_rtree< bgi::quadratic<16> >();
+    test_rtree< bgi::rstar<8, 3> >();
+    test_rtree(bgi::dynamic_rstar(16, 4));
+
+    return 0;
+}
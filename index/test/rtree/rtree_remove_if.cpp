@@ -0,0 +1,109 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+// Removes the values from expected and returns the number of removed values
+template <typename Predicate>
+std::size_t remove_expected(std::vector<box_value_t> & expected, Predicate const& pred)
+{
+    std::size_t const size = expected.size();
+    expected.erase(std::remove_if(expected.begin(), expected.end(), pred), expected.end());
+    return size - expected.size();
+}
+
+template <typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::rtree<box_value_t, Params> rtree_t;
+
+    std::vector<box_value_t> const values = generate::scattered_values<box_value_t>(3000);
+
+    box_t const qbox(point_t(100, 200), point_t(500, 550));
+    auto const is_odd = [](box_value_t const& v) { return v.second % 2 == 1; };
+    auto const always = [](box_value_t const&) { return true; };
+
+    // empty
+    {
+        rtree_t rt(params);
+        BOOST_CHECK_EQUAL(rt.remove_if(bgi::intersects(qbox), always), 0u);
+        BOOST_CHECK(rt.empty());
+    }
+
+    for ( int packed = 0 ; packed < 2 ; ++packed )
+    {
+        rtree_t rt(params);
+        if ( packed )
+            rt = rtree_t(values, params);
+        else
+            rt.insert(values);
+
+        std::vector<box_value_t> expected = values;
+
+        // nothing
+        BOOST_CHECK_EQUAL(rt.remove_if(bgi::intersects(box_t(point_t(-10, -10), point_t(-5, -5))), always), 0u);
+        basictest::check_rtree(rt, expected);
+
+        // a part of a region
+        std::size_t count = remove_expected(expected, [&](box_value_t const& v) {
+            return bg::intersects(v.first, qbox) && is_odd(v);
+        });
+        BOOST_CHECK(0 < count);
+        BOOST_CHECK_EQUAL(rt.remove_if(bgi::intersects(qbox), is_odd), count);
+        basictest::check_rtree(rt, expected);
+
+        // the rest of the region, satisfies() is checked as well
+        count = remove_expected(expected, [&](box_value_t const& v) {
+            return bg::within(v.first, qbox) && v.second % 3 != 0;
+        });
+        BOOST_CHECK_EQUAL(bgi::remove_if(rt, bgi::within(qbox) && bgi::satisfies([](box_value_t const& v) {
+                                                 return v.second % 3 != 0;
+                                             }), always),
+                          count);
+        basictest::check_rtree(rt, expected);
+
+        // outside of the region, most of the values
+        count = remove_expected(expected, [&](box_value_t const& v) {
+            return ! bg::intersects(v.first, qbox) && v.second % 5 != 0;
+        });
+        BOOST_CHECK_EQUAL(rt.remove_if(! bgi::intersects(qbox), [](box_value_t const& v) {
+                                           return v.second % 5 != 0;
+                                       }),
+                          count);
+        basictest::check_rtree(rt, expected);
+
+        // the tree may still be modified
+        rt.insert(values.begin(), values.begin() + 500);
+        expected.insert(expected.end(), values.begin(), values.begin() + 500);
+        basictest::check_rtree(rt, expected);
+
+        // everything
+        BOOST_CHECK_EQUAL(rt.remove_if(bgi::intersects(rt.bounds()), always), expected.size());
+        basictest::check_rtree(rt, std::vector<box_value_t>());
+
+        rt.insert(values);
+        basictest::check_rtree(rt, values);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_rtree< bgi::linear<4, 2> >();
+    test_rtree< bgi::quadratic<16> >();
+    test_rtree< bgi::rstar<8, 3> >();
+    test_rtree< bgi::kmeans<8> >();
+    test_rtree(bgi::dynamic_linear(5, 2));
+    test_rtree(bgi::dynamic_rstar(16, 4));
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <utility>
+#include <vector>
+
+template <typename Params>
+void test_rtree(Params const& params = Params())
+{
+    typedef bgi::rtree<point_value_t, Params> rtree_t;
+
+    std::vector<point_value_t> const values = generate::scattered_values<point_value_t>(3000);
+
+    // empty
+    {
+        rtree_t rt(params);
+        BOOST_CHECK_EQUAL(rt.update(values[0], values[1]), 0u);
+        BOOST_CHECK(rt.empty());
+    }
+
+    // one value in the root leaf
+    {
+        rtree_t rt(params);
+        rt.insert(values[0]);
+        BOOST_CHECK_EQUAL(rt.update(values[0], values[1]), 1u);
+        BOOST_CHECK_EQUAL(rt.count(values[0]), 0u);
+        BOOST_CHECK_EQUAL(rt.count(values[1]), 1u);
+        BOOST_CHECK(bg::equals(rt.bounds(), box_t(values[1].first, values[1].first)));
+    }
+
+    for ( int packed = 0 ; packed < 2 ; ++packed )
+    {
+        rtree_t rt(params);
+        if ( packed )
+            rt = rtree_t(values, params);
+        else
+            rt.insert(values);
+
+        std::vector<point_value_t> current = values;
+
+        // not found, the new value isn't inserted
+        BOOST_CHECK_EQUAL(rt.update(std::make_pair(point_t(-5, -5), 0), values[0]), 0u);
+        BOOST_CHECK_EQUAL(bgi::update(rt, std::make_pair(values[1].first, -1), values[0]), 0u);
+        basictest::check_rtree(rt, current, false);
+
+        // small moves, mostly in place, and big moves, relocation
+        for ( double step : { 0.5, 3.0, 100.0, 600.0 } )
+        {
+            for ( std::size_t i = 0 ; i < current.size() ; ++i )
+            {
+                point_value_t moved = current[i];
+                bg::set<0>(moved.first, bg::get<0>(moved.first) + ((i % 3) - 1.0) * step);
+                bg::set<1>(moved.first, bg::get<1>(moved.first) + ((i % 5) - 2.0) * step);
+                BOOST_CHECK_EQUAL(rt.update(current[i], moved), 1u);
+                current[i] = moved;
+            }
+            basictest::check_rtree(rt, current, false);
+        }
+
+        // remove everything
+        for ( auto const& v : current )
+            BOOST_CHECK_EQUAL(rt.remove(v), 1u);
+        BOOST_CHECK(rt.empty());
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_rtree< bgi::linear<4, 2> >();
+    test_rtree< bgi::quadratic<16> >();
+    test_rtree< bgi::rstar<8, 3> >();
+    test_rtree< bgi::kmeans<8> >();
+    test_rtree(bgi::dynamic_linear(5, 2));
+    test_rtree(bgi::dynamic_rstar(16, 4));
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/geometries/linestring.hpp>
+#include <boost/geometry/strategies/index/cartesian.hpp>
+#include <boost/geometry/strategies/index/geographic.hpp>
+#include <boost/geometry/strategies/index/spherical.hpp>
+
+template <typename Point>
+inline void fill(Point & pt, double x, double y)
+{
+    bg::set<0>(pt, x);
+    bg::set<1>(pt, y);
+}
+
+template <typename Point>
+inline void fill(bg::model::box<Point> & box, double x, double y)
+{
+    bg::set<0, 0>(box, x);
+    bg::set<0, 1>(box, y);
+    bg::set<1, 0>(box, x + 0.75);
+    bg::set<1, 1>(box, y + 0.5);
+}
+
+template <typename Rtree, typename Geometry, typename T, typename Strategy>
+void check_query(Rtree const& rt, std::vector<typename Rtree::value_type> const& values,
+                 Geometry const& g, T const& distance, Strategy const& strategy)
+{
+    typedef typename Rtree::value_type value_t;
+
+    std::vector<value_t> expected;
+    for ( value_t const& v : values )
+    {
+        if ( bg::distance(g, v, strategy) <= distance )
+            expected.push_back(v);
+    }
+
+    std::vector<value_t> found;
+    rt.query(bgi::within_distance(g, distance), std::back_inserter(found));
+    basictest::compare_outputs(rt, found, expected);
+}
+
+// Values in the range of longitudes [-20, 20] and latitudes [-10, 10]
+// so the same data is used for all coordinate systems.
+template <typename Rtree, typename Strategy>
+void test_rtree(typename Rtree::parameters_type const& params,
+                Strategy const& strategy,
+                double d_small, double d_big)
+{
+    typedef typename Rtree::value_type value_t;
+    typedef typename bg::point_type<value_t>::type point_t;
+
+    std::vector<value_t> values;
+    for ( int i = 0 ; i < 1500 ; ++i )
+    {
+        value_t v;
+        fill(v, (i * 37) % 400 / 10.0 - 20 + 0.013, (i * 53) % 199 / 10.0 - 10 + 0.007);
+        values.push_back(v);
+    }
+
+    Rtree rt(values, params);
+
+    point_t pt;
+    fill(pt, 1.1, 2.3);
+    check_query(rt, values, pt, 0.0, strategy);
+    check_query(rt, values, pt, d_small, strategy);
+    check_query(rt, values, pt, d_big, strategy);
+    // nothing is within a negative distance
+    check_query(rt, values, pt, -d_small, strategy);
+
+    bg::model::linestring<point_t> ls;
+    ls.push_back(pt);
+    fill(pt, 8.2, -3.4);
+    ls.push_back(pt);
+    check_query(rt, values, ls, d_small, strategy);
+
+    // within_distance() combined with other predicates
+    bg::model::box<point_t> qbox;
+    fill(qbox, 0, 0);
+    std::vector<value_t> found, expected;
+    rt.query(bgi::within_distance(pt, d_big) && !bgi::intersects(qbox), std::back_inserter(found));
+    for ( value_t const& v : values )
+    {
+        if ( bg::distance(pt, v, strategy) <= d_big && ! bg::intersects(v, qbox) )
+            expected.push_back(v);
+    }
+    basictest::compare_outputs(rt, found, expected);
+
+    // empty
+    Rtree empty(params);
+    BOOST_CHECK_EQUAL(empty.query(bgi::within_distance(pt, d_big), std::back_inserter(found)), 0u);
+}
+
+template <typename Point, typename Strategy>
+void test_rtrees(Strategy const& strategy, double d_small, double d_big)
+{
+    typedef bg::model::box<Point> box_t;
+
+    test_rtree< bgi::rtree<Point, bgi::rstar<8, 3> > >(bgi::rstar<8, 3>(), strategy, d_small, d_big);
+    test_rtree< bgi::rtree<box_t, bgi::linear<16, 4> > >(bgi::linear<16, 4>(), strategy, d_small, d_big);
+
+    // the strategy passed in the parameters
+    typedef bgi::parameters<bgi::quadratic<8, 3>, Strategy> params_t;
+    test_rtree< bgi::rtree<Point, params_t> >(params_t(bgi::quadratic<8, 3>(), strategy), strategy, d_small, d_big);
+    test_rtree< bgi::rtree<box_t, params_t> >(params_t(bgi::quadratic<8, 3>(), strategy), strategy, d_small, d_big);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_car;
+    typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > point_sph;
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_geo;
+
+    test_rtrees<point_car>(bg::strategies::index::cartesian<>(), 2.5, 10.0);
+    // distances on the unit sphere
+    test_rtrees<point_sph>(bg::strategies::index::spherical<>(), 0.04, 0.2);
+    // distances in meters on the WGS84 spheroid
+    test_rtrees<point_geo>(bg::strategies::index::geographic<>(), 250000.0, 1200000.0);
+
+    return 0;
+}
@@ -32,6 +32,13 @@
 //#include <boost/geometry/geometries/ring.hpp>
 //#include <boost/geometry/geometries/polygon.hpp>
 
+// Values used by the tests of single operations of the rtree
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+typedef bg::model::box<point_t> box_t;
+typedef std::pair<point_t, int> point_value_t;
+typedef std::pair<box_t, int> box_value_t;
+
 namespace generate {
 
 // Set point's coordinates
@@ -676,6 +683,46 @@ void rtree(Rtree & tree, Elements & input, Box & qbox)
     tree.insert(input.begin(), input.end());
 }
 
+// Value with id i scattered over the area [0, max_x) x [0, max_y), Boxes are 1.5 x 2
+
+template <typename Value>
+struct scattered_value
+{};
+
+template <typename T, typename C>
+struct scattered_value< std::pair<bg::model::point<T, 2, C>, int> >
+{
+    typedef bg::model::point<T, 2, C> P;
+    typedef std::pair<P, int> R;
+    static R apply(int i, int max_x, int max_y)
+    {
+        return std::make_pair(P((i * 37) % max_x, (i * 53) % max_y), i);
+    }
+};
+
+template <typename T, typename C>
+struct scattered_value< std::pair<bg::model::box< bg::model::point<T, 2, C> >, int> >
+{
+    typedef bg::model::point<T, 2, C> P;
+    typedef bg::model::box<P> B;
+    typedef std::pair<B, int> R;
+    static R apply(int i, int max_x, int max_y)
+    {
+        T const x = (i * 37) % max_x;
+        T const y = (i * 53) % max_y;
+        return std::make_pair(B(P(x, y), P(x + T(1.5), y + 2)), i);
+    }
+};
+
+template <typename Value>
+inline std::vector<Value> scattered_values(int count, int max_x = 1000, int max_y = 997)
+{
+    std::vector<Value> values;
+    for ( int i = 0 ; i < count ; ++i )
+        values.push_back(scattered_value<Value>::apply(i, max_x, max_y));
+    return values;
+}
+
 } // namespace generate
 
 namespace basictest
@@ -728,6 +775,55 @@ void exactly_the_same_outputs(Rtree const& rtree, Range1 const& output, Range2 c
     }
 }
 
+// The ids of Values being pairs, sorted
+template <typename Values>
+inline std::vector<int> sorted_ids(Values const& values)
+{
+    std::vector<int> result;
+    for ( auto const& v : values )
+        result.push_back(v.second);
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+// Checks the structure of the 2d rtree and compares the Values stored in it and the Values
+// intersecting the quarters of its bounds with the expected ones
+template <typename Rtree, typename Value>
+void check_rtree(Rtree const& rt, std::vector<Value> const& expected, bool check_min = true)
+{
+    typedef typename Rtree::bounds_type B;
+
+    BOOST_CHECK_EQUAL(rt.size(), expected.size());
+    BOOST_CHECK(sorted_ids(rt) == sorted_ids(expected));
+    if ( rt.empty() )
+        return;
+
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt, check_min));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+
+    B const bounds = rt.bounds();
+    double const min_x = bg::get<bg::min_corner, 0>(bounds);
+    double const min_y = bg::get<bg::min_corner, 1>(bounds);
+    double const w = bg::get<bg::max_corner, 0>(bounds) - min_x;
+    double const h = bg::get<bg::max_corner, 1>(bounds) - min_y;
+    for ( int i = 0 ; i < 4 ; ++i )
+    {
+        B qbox;
+        bg::set<bg::min_corner, 0>(qbox, min_x + w * (i % 2) / 2);
+        bg::set<bg::min_corner, 1>(qbox, min_y + h * (i / 2) / 2);
+        bg::set<bg::max_corner, 0>(qbox, min_x + w * (i % 2 + 1) / 2);
+        bg::set<bg::max_corner, 1>(qbox, min_y + h * (i / 2 + 1) / 2);
+
+        std::vector<Value> found, brute;
+        rt.query(bgi::intersects(qbox), std::back_inserter(found));
+        for ( auto const& v : expected )
+            if ( bg::intersects(rt.indexable_get()(v), qbox) )
+                brute.push_back(v);
+        compare_outputs(rt, found, brute);
+    }
+}
+
 // alternative version of std::copy taking iterators of differnet types
 template <typename First, typename Last, typename Out>
 void copy_alt(First first, Last last, Out out)
@@ -0,0 +1,139 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/strategies/parallel_turns.hpp>
+#include <boost/geometry/strategies/relate/cartesian.hpp>
+
+
+// Multi polygon of star-shaped polygons with many vertices
+template <typename MultiPolygon>
+MultiPolygon generate(double offset, int count)
+{
+    using polygon_t = typename boost::range_value<MultiPolygon>::type;
+    using point_t = typename bg::point_type<MultiPolygon>::type;
+
+    MultiPolygon result;
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            polygon_t poly;
+            double const cx = offset + i * 10.0;
+            double const cy = offset + j * 10.0;
+            int const n = 60;
+            for (int k = 0; k < n; k++)
+            {
+                double const a = 2.0 * 3.141592653589793 * k / n;
+                double const r = k % 2 == 0 ? 4.0 : 2.5;
+                bg::append(poly.outer(), point_t(cx + r * std::cos(a), cy + r * std::sin(a)));
+            }
+            bg::correct(poly);
+            result.push_back(poly);
+        }
+    }
+    return result;
+}
+
+template <typename MultiPolygon, typename Strategy>
+void test_turns(MultiPolygon const& mp1, MultiPolygon const& mp2, Strategy const& strategy, std::size_t threads)
+{
+    using point_t = typename bg::point_type<MultiPolygon>::type;
+    using turn_info = bg::detail::overlay::turn_info
+        <
+            point_t, typename bg::segment_ratio_type<point_t>::type
+        >;
+
+    bg::strategies::parallel_turns<Strategy> const parallel_strategy(strategy, threads);
+
+    std::vector<turn_info> expected, turns;
+    bg::detail::get_turns::no_interrupt_policy policy;
+    bg::get_turns
+        <
+            false, false, bg::detail::overlay::assign_null_policy
+        >(mp1, mp2, strategy, expected, policy);
+    bg::get_turns
+        <
+            false, false, bg::detail::overlay::assign_null_policy
+        >(mp1, mp2, parallel_strategy, turns, policy);
+
+    BOOST_CHECK(! expected.empty());
+    BOOST_CHECK_EQUAL(turns.size(), expected.size());
+    for (std::size_t i = 0; i < turns.size() && i < expected.size(); i++)
+    {
+        // the same turns in the same order
+        BOOST_CHECK(bg::get<0>(turns[i].point) == bg::get<0>(expected[i].point));
+        BOOST_CHECK(bg::get<1>(turns[i].point) == bg::get<1>(expected[i].point));
+        BOOST_CHECK(turns[i].method == expected[i].method);
+        for (int k = 0; k < 2; k++)
+        {
+            BOOST_CHECK(turns[i].operations[k].seg_id == expected[i].operations[k].seg_id);
+            BOOST_CHECK(turns[i].operations[k].operation == expected[i].operations[k].operation);
+        }
+    }
+
+    // the same results of the overlay operations
+    MultiPolygon expected_intersection, intersection;
+    bg::intersection(mp1, mp2, expected_intersection, strategy);
+    bg::intersection(mp1, mp2, intersection, parallel_strategy);
+    BOOST_CHECK_EQUAL(intersection.size(), expected_intersection.size());
+    BOOST_CHECK_EQUAL(bg::area(intersection), bg::area(expected_intersection));
+
+    MultiPolygon expected_union, union_;
+    bg::union_(mp1, mp2, expected_union, strategy);
+    bg::union_(mp1, mp2, union_, parallel_strategy);
+    BOOST_CHECK_EQUAL(union_.size(), expected_union.size());
+    BOOST_CHECK_EQUAL(bg::area(union_), bg::area(expected_union));
+}
+
+template <typename Point>
+void test_all()
+{
+    using polygon_t = bg::model::polygon<Point>;
+    using multi_polygon_t = bg::model::multi_polygon<polygon_t>;
+    using strategy_t = bg::strategies::relate::cartesian<>;
+
+    multi_polygon_t const mp1 = generate<multi_polygon_t>(0.0, 12);
+    multi_polygon_t const mp2 = generate<multi_polygon_t>(3.3, 12);
+
+    for (std::size_t threads : {0, 1, 2, 3, 8, 64})
+    {
+        test_turns(mp1, mp2, strategy_t(), threads);
+    }
+
+    // less pairs of sections than threads
+    multi_polygon_t const small1 = generate<multi_polygon_t>(0.0, 1);
+    multi_polygon_t const small2 = generate<multi_polygon_t>(1.5, 1);
+    test_turns(small1, small2, strategy_t(), 1000);
+
+    // no overlapping sections
+    multi_polygon_t const far = generate<multi_polygon_t>(1000.0, 2);
+    bg::strategies::parallel_turns<strategy_t> const parallel_strategy(4);
+    multi_polygon_t result;
+    bg::intersection(mp1, far, result, parallel_strategy);
+    BOOST_CHECK(result.empty());
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+
+    return 0;
+}
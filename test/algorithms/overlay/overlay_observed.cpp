@@ -0,0 +1,132 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/difference.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/observed_overlay.hpp>
+#include <boost/geometry/strategies/relate/cartesian.hpp>
+
+
+// Checks the order of the phases and the reported sizes
+struct recording_observer
+{
+    void phase_start(bg::overlay_phase phase)
+    {
+        BOOST_CHECK(! started);
+        BOOST_CHECK(static_cast<int>(phase) == expected);
+        started = true;
+    }
+
+    void phase_end(bg::overlay_phase phase, bg::overlay_counts const& c)
+    {
+        BOOST_CHECK(started);
+        BOOST_CHECK(static_cast<int>(phase) == expected);
+        started = false;
+        ++expected;
+        counts.push_back(c);
+    }
+
+    int expected = 0;
+    bool started = false;
+    std::vector<bg::overlay_counts> counts;
+};
+
+template <typename MultiPolygon>
+void test_observer(std::string const& wkt1, std::string const& wkt2,
+                   std::size_t expected_turns, std::size_t expected_traversed)
+{
+    MultiPolygon mp1, mp2;
+    bg::read_wkt(wkt1, mp1);
+    bg::read_wkt(wkt2, mp2);
+    bg::correct(mp1);
+    bg::correct(mp2);
+
+    using strategy_t = bg::strategies::relate::cartesian<>;
+
+    MultiPolygon expected, result;
+    bg::union_(mp1, mp2, expected, strategy_t());
+
+    recording_observer observer;
+    bg::strategies::observed_overlay<strategy_t, recording_observer> const strategy(observer);
+    bg::union_(mp1, mp2, result, strategy);
+
+    BOOST_CHECK_EQUAL(bg::area(result), bg::area(expected));
+    BOOST_CHECK_EQUAL(observer.expected, int(bg::overlay_phase_count));
+    BOOST_CHECK(! observer.started);
+    BOOST_CHECK_EQUAL(observer.counts.size(), bg::overlay_phase_count);
+    if (observer.counts.size() == bg::overlay_phase_count)
+    {
+        bg::overlay_counts const& first = observer.counts.front();
+        bg::overlay_counts const& last = observer.counts.back();
+        BOOST_CHECK_EQUAL(first.turns, expected_turns);
+        BOOST_CHECK_EQUAL(first.clusters, 0u);
+        BOOST_CHECK_EQUAL(last.turns, expected_turns);
+        BOOST_CHECK_EQUAL(last.traversed_rings, expected_traversed);
+        // the rings created by traversal and the input rings without turns
+        BOOST_CHECK_GE(last.selected_rings, last.traversed_rings);
+    }
+}
+
+template <typename MultiPolygon>
+void test_statistics()
+{
+    MultiPolygon mp1, mp2, result;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0)),((10 10,10 12,12 12,12 10,10 10)))", mp1);
+    bg::read_wkt("MULTIPOLYGON(((1 1,1 3,3 3,3 1,1 1)))", mp2);
+    bg::correct(mp1);
+    bg::correct(mp2);
+
+    using strategy_t = bg::strategies::relate::cartesian<>;
+
+    bg::overlay_statistics statistics;
+    bg::strategies::observed_overlay<strategy_t, bg::overlay_statistics> const strategy(statistics);
+
+    bg::union_(mp1, mp2, result, strategy);
+    result.clear();
+    bg::intersection(mp1, mp2, result, strategy);
+    result.clear();
+    bg::difference(mp1, mp2, result, strategy);
+
+    BOOST_CHECK_EQUAL(statistics.operations(), 3u);
+    BOOST_CHECK_EQUAL(statistics.counts().turns, 6u);
+    BOOST_CHECK_EQUAL(statistics.counts().traversed_rings, 3u);
+    BOOST_CHECK(statistics.duration() >= statistics.duration(bg::overlay_phase::get_turns));
+
+    statistics.clear();
+    BOOST_CHECK_EQUAL(statistics.operations(), 0u);
+    BOOST_CHECK_EQUAL(statistics.counts().turns, 0u);
+    BOOST_CHECK(statistics.duration() == bg::overlay_statistics::duration_type::zero());
+}
+
+int test_main(int, char* [])
+{
+    using point_t = bg::model::d2::point_xy<double>;
+    using multi_polygon_t = bg::model::multi_polygon<bg::model::polygon<point_t>>;
+
+    test_observer<multi_polygon_t>("MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0)))",
+                                   "MULTIPOLYGON(((1 1,1 3,3 3,3 1,1 1)))", 2, 1);
+    test_observer<multi_polygon_t>("MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0)),((10 10,10 12,12 12,12 10,10 10)))",
+                                   "MULTIPOLYGON(((1 1,1 3,3 3,3 1,1 1)))", 2, 1);
+    test_observer<multi_polygon_t>("MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0)))",
+                                   "MULTIPOLYGON(((5 5,5 6,6 6,6 5,5 5)))", 0, 0);
+
+    test_statistics<multi_polygon_t>();
+
+    return 0;
+}
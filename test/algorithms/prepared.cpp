@@ -0,0 +1,208 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/prepared.hpp>
+#include <boost/geometry/algorithms/relate.hpp>
+#include <boost/geometry/algorithms/relation.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+template <typename Geometry, typename Prepared, typename Point>
+void check_point(Geometry const& geometry, Prepared const& prepared, Point const& point)
+{
+    BOOST_CHECK_MESSAGE(bg::within(point, prepared) == bg::within(point, geometry),
+                        "within " << bg::wkt(point));
+    BOOST_CHECK_MESSAGE(bg::covered_by(point, prepared) == bg::covered_by(point, geometry),
+                        "covered_by " << bg::wkt(point));
+    BOOST_CHECK_MESSAGE(bg::intersects(point, prepared) == bg::intersects(point, geometry),
+                        "intersects " << bg::wkt(point));
+    BOOST_CHECK(bg::intersects(prepared, point) == bg::intersects(geometry, point));
+    BOOST_CHECK(bg::disjoint(point, prepared) == bg::disjoint(point, geometry));
+    BOOST_CHECK(bg::disjoint(prepared, point) == bg::disjoint(geometry, point));
+    BOOST_CHECK(bg::relation(point, prepared).str() == bg::relation(point, geometry).str());
+    BOOST_CHECK(bg::relate(point, prepared, bg::de9im::mask("T*F**F***"))
+             == bg::relate(point, geometry, bg::de9im::mask("T*F**F***")));
+    BOOST_CHECK(bg::relate(point, prepared, bg::de9im::static_mask<'F', 'T', 'F'>())
+             == bg::relate(point, geometry, bg::de9im::static_mask<'F', 'T', 'F'>()));
+}
+
+template <typename Other, typename Geometry, typename Prepared>
+void check_intersects(Geometry const& geometry, Prepared const& prepared, std::string const& wkt)
+{
+    Other other;
+    bg::read_wkt(wkt, other);
+    bg::correct(other);
+
+    BOOST_CHECK_MESSAGE(bg::intersects(other, prepared) == bg::intersects(other, geometry),
+                        "intersects " << wkt);
+    BOOST_CHECK_MESSAGE(bg::intersects(prepared, other) == bg::intersects(geometry, other),
+                        "intersects " << wkt);
+    BOOST_CHECK_MESSAGE(bg::disjoint(other, prepared) == bg::disjoint(other, geometry),
+                        "disjoint " << wkt);
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& wkt)
+{
+    using point_t = typename bg::point_type<Geometry>::type;
+    using multi_point_t = bg::model::multi_point<point_t>;
+    using segment_t = bg::model::segment<point_t>;
+    using linestring_t = bg::model::linestring<point_t>;
+    using multi_linestring_t = bg::model::multi_linestring<linestring_t>;
+    using box_t = bg::model::box<point_t>;
+    using ring_t = bg::model::ring<point_t>;
+    using polygon_t = bg::model::polygon<point_t>;
+    using multi_polygon_t = bg::model::multi_polygon<polygon_t>;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    bg::correct(geometry);
+
+    bg::prepared<Geometry> const prepared(geometry);
+
+    // points in the interiors, exteriors, on the edges and in the vertices
+    for (int x = -4; x <= 44; x++)
+    {
+        for (int y = -4; y <= 44; y++)
+        {
+            check_point(geometry, prepared, point_t(x * 0.5, y * 0.5));
+        }
+    }
+
+    for (char const* mp : {"MULTIPOINT(1 1,2 2)", "MULTIPOINT(0 0,3 3)", "MULTIPOINT(0 0,0 5)",
+                           "MULTIPOINT(3 3,50 50)", "MULTIPOINT()"})
+    {
+        multi_point_t multi_point;
+        bg::read_wkt(mp, multi_point);
+        BOOST_CHECK_MESSAGE(bg::within(multi_point, prepared) == bg::within(multi_point, geometry),
+                            "within " << mp);
+        BOOST_CHECK_MESSAGE(bg::covered_by(multi_point, prepared) == bg::covered_by(multi_point, geometry),
+                            "covered_by " << mp);
+        BOOST_CHECK_MESSAGE(bg::intersects(multi_point, prepared) == bg::intersects(multi_point, geometry),
+                            "intersects " << mp);
+    }
+
+    for (char const* s : {"SEGMENT(1 1,2 2)", "SEGMENT(-1 -1,50 50)", "SEGMENT(30 30,40 40)",
+                          "SEGMENT(6 6,7 7)", "SEGMENT(0 10,10 10)"})
+    {
+        check_intersects<segment_t>(geometry, prepared, s);
+    }
+
+    for (char const* ls : {"LINESTRING(1 1,2 2)", "LINESTRING(-1 -1,-1 50,50 50)",
+                           "LINESTRING(6 6,7 7,6 7)", "LINESTRING(-5 5,0 5)",
+                           "LINESTRING(-5 5,-1 5)"})
+    {
+        check_intersects<linestring_t>(geometry, prepared, ls);
+    }
+
+    check_intersects<multi_linestring_t>(geometry, prepared, "MULTILINESTRING((-5 -5,-6 -6),(6 6,7 7))");
+    check_intersects<multi_linestring_t>(geometry, prepared, "MULTILINESTRING((-5 -5,-6 -6),(30 30,40 40))");
+
+    for (char const* b : {"BOX(1 1,2 2)", "BOX(-5 -5,50 50)", "BOX(6 6,7 7)", "BOX(30 30,40 40)",
+                          "BOX(-5 -5,0 0)", "BOX(15.5 15.5,16.5 16.5)"})
+    {
+        check_intersects<box_t>(geometry, prepared, b);
+    }
+
+    for (char const* p : {"POLYGON((1 1,1 2,2 2,2 1,1 1))", "POLYGON((-5 -5,-5 50,50 50,50 -5,-5 -5))",
+                          "POLYGON((6 6,6 7,7 7,7 6,6 6))", "POLYGON((30 30,30 40,40 40,40 30,30 30))",
+                          "POLYGON((-5 -5,-5 50,50 50,50 -5,-5 -5),(-4 -4,49 -4,49 49,-4 49,-4 -4))",
+                          "POLYGON((15.5 15.5,15.5 16.5,16.5 16.5,16.5 15.5,15.5 15.5))"})
+    {
+        if (std::string(p).find("),(") == std::string::npos)
+        {
+            check_intersects<ring_t>(geometry, prepared, p);
+        }
+        check_intersects<polygon_t>(geometry, prepared, p);
+    }
+
+    check_intersects<multi_polygon_t>(geometry, prepared,
+        "MULTIPOLYGON(((30 30,30 40,40 40,40 30,30 30)),((6 6,6 7,7 7,7 6,6 6)))");
+    check_intersects<multi_polygon_t>(geometry, prepared,
+        "MULTIPOLYGON(((30 30,30 40,40 40,40 30,30 30)),((41 41,41 42,42 42,42 41,41 41)))");
+}
+
+template <typename Point>
+void test_all()
+{
+    using ring_t = bg::model::ring<Point>;
+    using polygon_t = bg::model::polygon<Point>;
+    using polygon_ccw_open_t = bg::model::polygon<Point, false, false>;
+    using multi_polygon_t = bg::model::multi_polygon<polygon_t>;
+
+    test_geometry<ring_t>("POLYGON((0 0,0 10,10 10,10 0,0 0))");
+    test_geometry<ring_t>("POLYGON((0 0,0 10,5 5,10 10,10 0,5 2,0 0))");
+    test_geometry<polygon_t>("POLYGON((0 0,0 10,10 10,10 0,0 0),(5 5,8 5,8 8,5 8,5 5))");
+    test_geometry<polygon_ccw_open_t>("POLYGON((0 0,0 10,10 10,10 0),(5 5,8 5,8 8,5 8))");
+    test_geometry<polygon_t>("POLYGON((0 0,0 20,20 20,20 0,0 0),(5 5,15 5,15 15,5 15,5 5),(2 2,3 2,3 3,2 3,2 2))");
+    test_geometry<multi_polygon_t>("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(5 5,8 5,8 8,5 8,5 5)),"
+                                   "((6 6,6 7,7 7,7 6,6 6)),((10 10,10 20,20 20,20 10,10 10)),"
+                                   "((15 15,15 16,16 16,16 15,15 15)))");
+    test_geometry<multi_polygon_t>("MULTIPOLYGON()");
+    test_geometry<polygon_t>("POLYGON((0 0,0 1,1 0))");
+
+    // large polygon with many segments
+    polygon_t star;
+    for (int i = 0; i < 1000; i++)
+    {
+        double const a = 2.0 * 3.141592653589793 * i / 1000;
+        double const r = i % 2 == 0 ? 10.0 : 8.0;
+        bg::append(star.outer(), Point(10.0 + r * std::cos(a), 10.0 + r * std::sin(a)));
+    }
+    bg::correct(star);
+    bg::prepared<polygon_t> const prepared_star(star);
+    for (int x = 0; x <= 400; x++)
+    {
+        for (int y = 0; y <= 40; y++)
+        {
+            check_point(star, prepared_star, Point(x * 0.05, y * 0.5));
+        }
+    }
+
+    // comb with long horizontal segments crossing many slabs of the grid
+    polygon_t comb;
+    bg::append(comb.outer(), Point(0, 0));
+    for (int i = 0; i < 100; i++)
+    {
+        bg::append(comb.outer(), Point(0.2 * i, 20));
+        bg::append(comb.outer(), Point(0.2 * i + 0.1, 1));
+    }
+    bg::append(comb.outer(), Point(20, 20));
+    bg::append(comb.outer(), Point(20, 0));
+    bg::correct(comb);
+    bg::prepared<polygon_t> const prepared_comb(comb);
+    for (int x = -1; x <= 201; x++)
+    {
+        for (int y = -1; y <= 41; y++)
+        {
+            check_point(comb, prepared_comb, Point(x * 0.1, y * 0.5));
+        }
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
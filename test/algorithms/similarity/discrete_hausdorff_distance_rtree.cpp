@@ -0,0 +1,85 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/geometries/linestring.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/geometries/multi_linestring.hpp>
+#include <boost/geometry/geometries/multi_point.hpp>
+
+#include "test_hausdorff_distance.hpp"
+
+// The brute force result compared with the result of the nearest neighbours batch query
+template <typename Linestring>
+void test_brute_force(Linestring const& ls1, Linestring const& ls2)
+{
+    double expected = 0;
+    for (auto const& p1 : ls1)
+    {
+        double dis_min = bg::distance(p1, ls2.front());
+        for (auto const& p2 : ls2)
+        {
+            dis_min = (std::min)(dis_min, double(bg::distance(p1, p2)));
+        }
+        expected = (std::max)(expected, dis_min);
+    }
+
+    test_hausdorff_distance(ls1, ls2, expected);
+}
+
+template <typename P>
+void test_all_cartesian()
+{
+    using linestring_2d = bg::model::linestring<P>;
+    using mlinestring_t = bg::model::multi_linestring<linestring_2d>;
+    using mpoint_t = bg::model::multi_point<P>;
+
+    test_geometry<P,mpoint_t>("POINT(3 1)","MULTIPOINT(0 0,3 4,4 3)", sqrt(5.0));
+    test_geometry<linestring_2d,linestring_2d >("LINESTRING(3 0,2 1,3 2)","LINESTRING(0 0,3 4,4 3)", 3);
+    test_geometry<mpoint_t,mpoint_t>("MULTIPOINT(3 0,2 1,3 2)","MULTIPOINT(0 0,3 4,4 3)", 3);
+    test_geometry<linestring_2d,mlinestring_t >("LINESTRING(1 1,2 2,4 3)","MULTILINESTRING((0 0,3 4,4 3),(1 1,2 2,4 3))", sqrt(5.0));
+    test_geometry<linestring_2d,linestring_2d >("LINESTRING(0 0, 1 0, 1 1, 0 1, 0 0)","LINESTRING(1 1, 0 1, 0 0, 1 0, 1 1)",0);
+    test_geometry<linestring_2d,linestring_2d >("LINESTRING(0 0, 1 0)","LINESTRING(0 0, 1 0)",0);
+
+    // many points, spatially coherent and scattered
+    linestring_2d ls1, ls2;
+    for (int i = 0 ; i < 2000 ; ++i)
+    {
+        bg::append(ls1, P(i % 500, (i * 7) % 13 + i / 500 * 20));
+        bg::append(ls2, P((i * 37) % 503, (i * 53) % 101));
+    }
+    test_brute_force(ls1, ls2);
+    test_brute_force(ls2, ls1);
+}
+
+template <typename P>
+void test_all_geographic()
+{
+    using linestring_2d = bg::model::linestring<P>;
+    using mpoint_t = bg::model::multi_point<P>;
+
+    test_geometry<P,mpoint_t>("POINT(3 1)","MULTIPOINT(0 0,3 4,4 3)", 247552);
+    test_geometry<linestring_2d,linestring_2d >("LINESTRING(3 0,2 1,3 2)","LINESTRING(0 0,3 4,4 3)", 333958);
+    test_geometry<mpoint_t,mpoint_t>("MULTIPOINT(3 0,2 1,3 2)","MULTIPOINT(0 0,3 4,4 3)", 333958);
+    test_geometry<linestring_2d,linestring_2d >("LINESTRING(0 0,3 4,4 3)","LINESTRING(4 3,3 4,0 0)",0);
+}
+
+int test_main(int, char* [])
+{
+    test_all_cartesian<bg::model::d2::point_xy<int,bg::cs::cartesian> >();
+    test_all_cartesian<bg::model::d2::point_xy<double,bg::cs::cartesian> >();
+
+    test_all_geographic<bg::model::d2::point_xy<double,bg::cs::geographic<bg::degree> > >();
+
+    return 0;
+}
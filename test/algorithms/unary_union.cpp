@@ -0,0 +1,193 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Adam Wulkiewicz, Lodz, Poland.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/algorithms/unary_union.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/parallel_turns.hpp>
+#include <boost/geometry/strategies/relate/cartesian.hpp>
+
+
+template <typename Polygon>
+Polygon square(double x, double y, double size)
+{
+    using point_t = typename bg::point_type<Polygon>::type;
+
+    Polygon result;
+    bg::append(result, point_t(x, y));
+    bg::append(result, point_t(x, y + size));
+    bg::append(result, point_t(x + size, y + size));
+    bg::append(result, point_t(x + size, y));
+    bg::append(result, point_t(x, y));
+    bg::correct(result);
+    return result;
+}
+
+// Squares in a grid with the exception of the squares of the inner grid,
+// in total a square with a square hole
+template <typename Polygon>
+std::vector<Polygon> frame(int count, int hole_first, int hole_last, double size)
+{
+    std::vector<Polygon> result;
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            if (i < hole_first || i > hole_last || j < hole_first || j > hole_last)
+            {
+                result.push_back(square<Polygon>(i, j, size));
+            }
+        }
+    }
+    return result;
+}
+
+template <typename Geometry, typename MultiPolygon, typename Strategy>
+void check(Geometry const& geometry, Strategy const& strategy, std::string const& caseid,
+           std::size_t expected_count, std::size_t expected_holes, double expected_area)
+{
+    MultiPolygon result;
+    bg::unary_union(geometry, result, strategy);
+
+    BOOST_CHECK_MESSAGE(result.size() == expected_count,
+                        caseid << " count expected: " << expected_count << " detected: " << result.size());
+    BOOST_CHECK_MESSAGE(bg::num_interior_rings(result) == expected_holes,
+                        caseid << " holes expected: " << expected_holes
+                               << " detected: " << bg::num_interior_rings(result));
+    BOOST_CHECK_CLOSE(bg::area(result), expected_area, 0.0001);
+    BOOST_CHECK_MESSAGE(bg::is_valid(result), caseid << " invalid " << bg::wkt(result));
+}
+
+template <typename Geometry, typename MultiPolygon>
+void test_one(Geometry const& geometry, std::string const& caseid,
+              std::size_t expected_count, std::size_t expected_holes, double expected_area)
+{
+    using strategy_t = bg::strategies::relate::cartesian<>;
+
+    {
+        MultiPolygon result;
+        bg::unary_union(geometry, result);
+        BOOST_CHECK_CLOSE(bg::area(result), expected_area, 0.0001);
+    }
+    check<Geometry, MultiPolygon>(geometry, strategy_t(), caseid,
+                                  expected_count, expected_holes, expected_area);
+    for (std::size_t threads : {1, 2, 3, 4})
+    {
+        check<Geometry, MultiPolygon>(geometry, bg::strategies::parallel_turns<strategy_t>(threads),
+                                      caseid + "_parallel", expected_count, expected_holes, expected_area);
+    }
+}
+
+template <typename Point>
+void test_all()
+{
+    using ring_t = bg::model::ring<Point>;
+    using polygon_t = bg::model::polygon<Point>;
+    using multi_polygon_t = bg::model::multi_polygon<polygon_t>;
+
+    // 10x10 overlapping squares
+    std::vector<polygon_t> const grid = frame<polygon_t>(10, 10, 10, 1.5);
+    test_one<std::vector<polygon_t>, multi_polygon_t>(grid, "grid", 1, 0, 10.5 * 10.5);
+
+    // the same, as multi-polygon
+    multi_polygon_t multi_grid;
+    multi_grid.assign(grid.begin(), grid.end());
+    test_one<multi_polygon_t, multi_polygon_t>(multi_grid, "multi_grid", 1, 0, 10.5 * 10.5);
+
+    // the same, as rings
+    std::vector<ring_t> rings;
+    for (polygon_t const& p : grid)
+    {
+        rings.push_back(p.outer());
+    }
+    test_one<std::vector<ring_t>, multi_polygon_t>(rings, "rings", 1, 0, 10.5 * 10.5);
+
+    // touching squares
+    test_one<std::vector<polygon_t>, multi_polygon_t>(frame<polygon_t>(8, 8, 8, 1.0),
+                                                      "touching", 1, 0, 64.0);
+
+    // hole in the middle
+    test_one<std::vector<polygon_t>, multi_polygon_t>(frame<polygon_t>(10, 3, 6, 1.5),
+                                                      "frame", 1, 1, 10.5 * 10.5 - 3.5 * 3.5);
+
+    // separate groups of overlapping squares
+    std::vector<polygon_t> groups;
+    for (int g = 0; g < 5; g++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            groups.push_back(square<polygon_t>(g * 10.0 + i, 0.0, 2.0));
+        }
+    }
+    test_one<std::vector<polygon_t>, multi_polygon_t>(groups, "groups", 5, 0, 5 * 5.0 * 2.0);
+
+    // multi-polygons overlapping each other
+    std::vector<multi_polygon_t> multi_polygons;
+    for (int i = 0; i < 10; i++)
+    {
+        multi_polygon_t mp;
+        mp.push_back(square<polygon_t>(i, 0.0, 1.5));
+        mp.push_back(square<polygon_t>(i, 5.0, 1.5));
+        multi_polygons.push_back(mp);
+    }
+    test_one<std::vector<multi_polygon_t>, multi_polygon_t>(multi_polygons, "multi_polygons",
+                                                            2, 0, 2 * 10.5 * 1.5);
+
+    // overlapping polygons of the same multi-polygon
+    std::vector<multi_polygon_t> overlapping(1);
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0)),((1 1,1 3,3 3,3 1,1 1)))", overlapping[0]);
+    bg::correct(overlapping[0]);
+    test_one<std::vector<multi_polygon_t>, multi_polygon_t>(overlapping, "overlapping_single", 1, 0, 7.0);
+    overlapping.push_back(overlapping[0]);
+    bg::read_wkt("MULTIPOLYGON(((10 0,10 1,11 1,11 0,10 0)),((2 2,2 4,4 4,4 2,2 2)))", overlapping[1]);
+    bg::correct(overlapping[1]);
+    test_one<std::vector<multi_polygon_t>, multi_polygon_t>(overlapping, "overlapping", 2, 0, 11.0);
+
+    // single geometry and empty geometries
+    std::vector<polygon_t> single(1, square<polygon_t>(0.0, 0.0, 1.0));
+    single.push_back(polygon_t());
+    test_one<std::vector<polygon_t>, multi_polygon_t>(single, "single", 1, 0, 1.0);
+    test_one<std::vector<polygon_t>, multi_polygon_t>(std::vector<polygon_t>(), "empty", 0, 0, 0.0);
+
+    // the same result as union of the geometries one by one
+    std::vector<polygon_t> pseudo_random;
+    for (int i = 0; i < 50; i++)
+    {
+        double const x = (i * 37) % 23;
+        double const y = (i * 13) % 17;
+        pseudo_random.push_back(square<polygon_t>(x, y, 1.0 + (i % 5) * 0.7));
+    }
+    multi_polygon_t expected;
+    for (polygon_t const& p : pseudo_random)
+    {
+        multi_polygon_t temp;
+        bg::union_(expected, p, temp);
+        expected = std::move(temp);
+    }
+    test_one<std::vector<polygon_t>, multi_polygon_t>(pseudo_random, "pseudo_random",
+                                                      expected.size(), bg::num_interior_rings(expected),
+                                                      bg::area(expected));
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}